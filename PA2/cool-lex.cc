@@ -1225,14 +1225,13 @@ YY_RULE_SETUP
 				return (ERROR);
 			}
 			memcpy(string_buf_ptr, yytext, strlen(yytext));
-				cool_yylval.symbol = stringtable.add_string(string_buf);
 			string_buf_ptr += strlen(yytext);
 		}
 	YY_BREAK
 case 14:
 /* rule 14 can match eol */
 YY_RULE_SETUP
-#line 185 "cool.flex"
+#line 184 "cool.flex"
 {
 		*string_buf_ptr = '\n';
 		string_buf_ptr++;
@@ -1241,7 +1240,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 15:
 YY_RULE_SETUP
-#line 191 "cool.flex"
+#line 190 "cool.flex"
 {
 			if (strlen(string_buf) == 1024) { 	
 				cool_yylval.symbol = stringtable.add_string(string_buf);
@@ -1291,7 +1290,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 16:
 YY_RULE_SETUP
-#line 239 "cool.flex"
+#line 238 "cool.flex"
 {
 			BEGIN(INITIAL);
 			cool_yylval.symbol = stringtable.add_string(string_buf);
@@ -1314,112 +1313,112 @@ YY_RULE_SETUP
 	YY_BREAK
 case 17:
 YY_RULE_SETUP
-#line 259 "cool.flex"
+#line 258 "cool.flex"
 {	return (DARROW);	}
 	YY_BREAK
 case 18:
 YY_RULE_SETUP
-#line 260 "cool.flex"
+#line 259 "cool.flex"
 {	return (CLASS);	}
 	YY_BREAK
 case 19:
 YY_RULE_SETUP
-#line 261 "cool.flex"
+#line 260 "cool.flex"
 {	return (ELSE);		}
 	YY_BREAK
 case 20:
 YY_RULE_SETUP
-#line 262 "cool.flex"
+#line 261 "cool.flex"
 {	return (FI);		}
 	YY_BREAK
 case 21:
 YY_RULE_SETUP
-#line 263 "cool.flex"
+#line 262 "cool.flex"
 {	return (IF);		}
 	YY_BREAK
 case 22:
 YY_RULE_SETUP
-#line 264 "cool.flex"
+#line 263 "cool.flex"
 {	return (IN);		}
 	YY_BREAK
 case 23:
 YY_RULE_SETUP
-#line 265 "cool.flex"
+#line 264 "cool.flex"
 {	return (INHERITS);	}
 	YY_BREAK
 case 24:
 YY_RULE_SETUP
-#line 266 "cool.flex"
+#line 265 "cool.flex"
 {	return (LET);		}
 	YY_BREAK
 case 25:
 YY_RULE_SETUP
-#line 267 "cool.flex"
+#line 266 "cool.flex"
 {	return (LOOP);		}
 	YY_BREAK
 case 26:
 YY_RULE_SETUP
-#line 268 "cool.flex"
+#line 267 "cool.flex"
 {	return (POOL);		}
 	YY_BREAK
 case 27:
 YY_RULE_SETUP
-#line 269 "cool.flex"
+#line 268 "cool.flex"
 {	return (THEN);		}
 	YY_BREAK
 case 28:
 YY_RULE_SETUP
-#line 270 "cool.flex"
+#line 269 "cool.flex"
 {	return (WHILE);		}
 	YY_BREAK
 case 29:
 YY_RULE_SETUP
-#line 271 "cool.flex"
+#line 270 "cool.flex"
 {	return (CASE);		}
 	YY_BREAK
 case 30:
 YY_RULE_SETUP
-#line 272 "cool.flex"
+#line 271 "cool.flex"
 {	return (ESAC);		}
 	YY_BREAK
 case 31:
 YY_RULE_SETUP
-#line 273 "cool.flex"
+#line 272 "cool.flex"
 {	return (OF);		}
 	YY_BREAK
 case 32:
 YY_RULE_SETUP
-#line 274 "cool.flex"
+#line 273 "cool.flex"
 {	return (NEW);		}
 	YY_BREAK
 case 33:
 YY_RULE_SETUP
-#line 275 "cool.flex"
+#line 274 "cool.flex"
 { 	return (ISVOID);	}
 	YY_BREAK
 case 34:
 YY_RULE_SETUP
-#line 276 "cool.flex"
+#line 275 "cool.flex"
 {	return (NOT);		}
 	YY_BREAK
 case 35:
 YY_RULE_SETUP
-#line 278 "cool.flex"
+#line 277 "cool.flex"
 {	return yytext[0];	}
 	YY_BREAK
 case 36:
 YY_RULE_SETUP
-#line 279 "cool.flex"
+#line 278 "cool.flex"
 {	return LE;	}
 	YY_BREAK
 case 37:
 YY_RULE_SETUP
-#line 280 "cool.flex"
+#line 279 "cool.flex"
 {					}
 	YY_BREAK
 case 38:
 YY_RULE_SETUP
-#line 282 "cool.flex"
+#line 281 "cool.flex"
 {
 			string_buf_ptr = string_buf;
 			BEGIN(IN_STRING);
@@ -1427,7 +1426,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 39:
 YY_RULE_SETUP
-#line 286 "cool.flex"
+#line 285 "cool.flex"
 {
 			cool_yylval.symbol = inttable.add_string(yytext);
 			return (INT_CONST); 
@@ -1435,7 +1434,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 40:
 YY_RULE_SETUP
-#line 290 "cool.flex"
+#line 289 "cool.flex"
 { 
 			if (yytext[0] == 't' || yytext[0] == 'T') {
 				cool_yylval.boolean = true;
@@ -1447,23 +1446,23 @@ YY_RULE_SETUP
 	YY_BREAK
 case 41:
 YY_RULE_SETUP
-#line 298 "cool.flex"
+#line 297 "cool.flex"
 {
-			cool_yylval.symbol = stringtable.add_string(yytext);
+			cool_yylval.symbol = idtable.add_string(yytext);
 			return (TYPEID);
 		}
 	YY_BREAK
 case 42:
 YY_RULE_SETUP
-#line 302 "cool.flex"
+#line 301 "cool.flex"
 {	
-			cool_yylval.symbol = stringtable.add_string(yytext);
+			cool_yylval.symbol = idtable.add_string(yytext);
 			return (OBJECTID);
 		}
 	YY_BREAK
 case 43:
 YY_RULE_SETUP
-#line 306 "cool.flex"
+#line 305 "cool.flex"
 {	
 			return (ASSIGN);
 		}
@@ -1471,14 +1470,14 @@ YY_RULE_SETUP
 case 44:
 /* rule 44 can match eol */
 YY_RULE_SETUP
-#line 309 "cool.flex"
+#line 308 "cool.flex"
 {
 			curr_lineno++;
 		}
 	YY_BREAK
 case 45:
 YY_RULE_SETUP
-#line 313 "cool.flex"
+#line 312 "cool.flex"
 {
 			cool_yylval.error_msg = "Unmatched *)";
 			return ERROR;
@@ -1486,7 +1485,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 46:
 YY_RULE_SETUP
-#line 317 "cool.flex"
+#line 316 "cool.flex"
 {
 			cool_yylval.error_msg = yytext; return ERROR;
 			}
@@ -1503,10 +1502,10 @@ YY_RULE_SETUP
   */
 case 47:
 YY_RULE_SETUP
-#line 334 "cool.flex"
+#line 333 "cool.flex"
 ECHO;
 	YY_BREAK
-#line 1510 "cool-lex.cc"
+#line 1509 "cool-lex.cc"
 case YY_STATE_EOF(INITIAL):
 	yyterminate();
 
@@ -2655,6 +2654,6 @@ void yyfree (void * ptr )
 
 /* %ok-for-header */
 
-#line 334 "cool.flex"
+#line 333 "cool.flex"
 
 
@@ -0,0 +1,296 @@
+//
+// See copyright.h for copyright notice and limitation of liability
+// and disclaimer of warranty provisions.
+//
+#include "copyright.h"
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  coolgen.cc
+//
+//  Writes a synthetic, type-correct Cool program to standard output, for
+//  measuring how the compiler scales with the size of its input:
+//
+//      coolgen [-c classes] [-d depth] [-f fan-out] [-m methods]
+//              [-e nesting] [-l let-width] [-k case-width]
+//              [-s strings] [-C comments] [-r seed] > big.cl
+//
+//    -c  number of classes (default 20)
+//    -d  depth of each inheritance tree below its root (default 3)
+//    -f  subclasses of each class in a tree (default 2)
+//    -m  methods of each class besides value() (default 4)
+//    -e  nesting depth of each method body (default 4)
+//    -l  bindings of each let (default 2)
+//    -k  branches of each case, besides Object (default 2)
+//    -s  string literals written by each method (default 1)
+//    -C  comment lines before each feature (default 0)
+//    -r  seed of the random choices (default 1)
+//
+//  The classes form complete trees of the given fan-out and depth, each
+//  rooted at a subclass of IO.  Every class has two attributes, its own
+//  methods m<class>_<n>(x : Int, y : Int) : Int, and an override of
+//  value(x : Int) : Int.  A method body is an Int expression built from
+//  arithmetic, comparisons, if, blocks, let, case and dispatches to the
+//  earlier methods of the class and to the methods of its ancestors, so
+//  every program terminates when run.  A body of nesting n has up to 4^n
+//  leaves.  The same options and seed always give the same program.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <string>
+#include <vector>
+
+struct Options {
+  int classes;
+  int depth;
+  int fanout;
+  int methods;
+  int nesting;
+  int let_width;
+  int case_width;
+  int strings;
+  int comments;
+  unsigned long seed;
+};
+
+static Options opt = { 20, 3, 2, 4, 4, 2, 2, 1, 0, 1 };
+
+//
+// xorshift64, so that a seed gives the same program on every platform.
+//
+static unsigned long long rng_state;
+
+static int rnd(int n)
+{
+  rng_state ^= rng_state << 13;
+  rng_state ^= rng_state >> 7;
+  rng_state ^= rng_state << 17;
+  return (int) (rng_state % (unsigned long long) n);
+}
+
+static std::vector<int> parent;         // -1 for the root of a tree
+static std::vector<std::string> names;  // class names
+
+static int cls;                         // the class being written
+static int method;                      // its method being written
+static int fresh;                       // counter for let and case names
+static int string_count;                // counter for string literals
+static std::vector<std::string> ints;   // Int names in scope
+
+static std::string int_expr(int depth);
+
+static std::string str(int n)
+{
+  char buf[32];
+  snprintf(buf, sizeof(buf), "%d", n);
+  return buf;
+}
+
+static std::string indent(int n)
+{
+  return std::string(2 * n, ' ');
+}
+
+//
+// A call of a method already written: an earlier one of this class or
+// any of an ancestor.  Returns "" if there is none.
+//
+static std::string dispatch(int depth)
+{
+  std::vector<std::string> callees;
+  for (int k = 0; k < method; k++)
+    callees.push_back("m" + str(cls) + "_" + str(k));
+  for (int a = parent[cls]; a >= 0; a = parent[a])
+    for (int k = 0; k < opt.methods; k++)
+      callees.push_back("m" + str(a) + "_" + str(k));
+  if (callees.empty())
+    return "";
+  return callees[rnd(callees.size())] + "(" + int_expr(depth - 1) + ", " +
+         int_expr(depth - 1) + ")";
+}
+
+static std::string let_expr(int depth)
+{
+  std::string s = "(let ";
+  size_t outer = ints.size();
+  for (int i = 0; i < opt.let_width; i++) {
+    std::string v = "l" + str(fresh++);
+    s += (i ? ", " : "") + v + " : Int <- " + int_expr(depth - 1);
+    ints.push_back(v);
+  }
+  s += " in " + int_expr(depth - 1) + ")";
+  ints.resize(outer);
+  return s;
+}
+
+//
+// A case on self with a branch for some of the classes, all distinct,
+// and one for Object, which always matches.
+//
+static std::string case_expr(int depth)
+{
+  std::string s = "case self of ";
+  std::vector<bool> used(opt.classes, false);
+  for (int i = 0; i < opt.case_width && i < opt.classes; i++) {
+    int c = rnd(opt.classes);
+    while (used[c])
+      c = (c + 1) % opt.classes;
+    used[c] = true;
+    s += "b" + str(fresh++) + " : " + names[c] + " => " +
+         int_expr(depth - 1) + "; ";
+  }
+  return s + "o" + str(fresh++) + " : Object => " + int_expr(depth - 1) +
+         "; esac";
+}
+
+static std::string leaf()
+{
+  switch (rnd(3)) {
+  case 0:  return str(rnd(100));
+  default: return ints[rnd(ints.size())];
+  }
+}
+
+static std::string int_expr(int depth)
+{
+  if (depth <= 0)
+    return leaf();
+  switch (rnd(8)) {
+  case 0:
+    return "(" + int_expr(depth - 1) + " + " + int_expr(depth - 1) + ")";
+  case 1:
+    return "(" + int_expr(depth - 1) + " * " + int_expr(depth - 1) + ")";
+  case 2:
+    return "(if " + int_expr(depth - 1) + " < " + int_expr(depth - 1) +
+           " then " + int_expr(depth - 1) + " else " + int_expr(depth - 1) +
+           " fi)";
+  case 3:
+    return "{ " + int_expr(depth - 1) + "; " + int_expr(depth - 1) + "; }";
+  case 4:
+    if (opt.let_width > 0)
+      return let_expr(depth);
+    break;
+  case 5:
+    return case_expr(depth);
+  case 6: {
+    std::string call = dispatch(depth);
+    if (call != "")
+      return call;
+    break;
+  }
+  case 7:
+    return "(~" + int_expr(depth - 1) + ")";
+  }
+  return "(" + int_expr(depth - 1) + " - " + leaf() + ")";
+}
+
+static void comments(int level)
+{
+  for (int i = 0; i < opt.comments; i++)
+    if (i % 2 == 0)
+      printf("%s-- comment %d of class %s\n", indent(level).c_str(), i,
+             names[cls].c_str());
+    else
+      printf("%s(* comment %d, (* nested *) of class %s *)\n",
+             indent(level).c_str(), i, names[cls].c_str());
+}
+
+static void write_method(int k)
+{
+  method = k;
+  ints.clear();
+  ints.push_back("x");
+  ints.push_back("y");
+  ints.push_back("a" + str(cls));
+  comments(1);
+  printf("  m%d_%d(x : Int, y : Int) : Int {\n    {\n", cls, k);
+  for (int i = 0; i < opt.strings; i++)
+    printf("      out_string(\"string %d of method m%d_%d, "
+           "with a tab\\t and a newline\\n\");\n", string_count++, cls, k);
+  printf("      %s;\n    }\n  };\n\n", int_expr(opt.nesting).c_str());
+}
+
+static void write_class(int c)
+{
+  cls = c;
+  printf("class %s inherits %s {\n", names[c].c_str(),
+         parent[c] < 0 ? "IO" : names[parent[c]].c_str());
+  comments(1);
+  printf("  a%d : Int <- %d;\n", c, c);
+  printf("  s%d : String <- \"class %s\";\n\n", c, names[c].c_str());
+  for (int k = 0; k < opt.methods; k++)
+    write_method(k);
+  method = opt.methods;
+  ints.clear();
+  ints.push_back("x");
+  ints.push_back("a" + str(c));
+  comments(1);
+  printf("  value(x : Int) : Int { %s };\n};\n\n",
+         int_expr(opt.nesting < 2 ? opt.nesting : 2).c_str());
+}
+
+static void usage(char *prog)
+{
+  fprintf(stderr, "usage: %s [-c classes] [-d depth] [-f fan-out] "
+          "[-m methods] [-e nesting]\n"
+          "       [-l let-width] [-k case-width] [-s strings] "
+          "[-C comments] [-r seed]\n", prog);
+  exit(1);
+}
+
+int main(int argc, char **argv)
+{
+  int c;
+  while ((c = getopt(argc, argv, "c:d:f:m:e:l:k:s:C:r:")) != -1) {
+    int n = optarg ? atoi(optarg) : 0;
+    switch (c) {
+    case 'c': opt.classes = n; break;
+    case 'd': opt.depth = n; break;
+    case 'f': opt.fanout = n; break;
+    case 'm': opt.methods = n; break;
+    case 'e': opt.nesting = n; break;
+    case 'l': opt.let_width = n; break;
+    case 'k': opt.case_width = n; break;
+    case 's': opt.strings = n; break;
+    case 'C': opt.comments = n; break;
+    case 'r': opt.seed = strtoul(optarg, NULL, 10); break;
+    default: usage(argv[0]);
+    }
+  }
+  if (optind != argc || opt.classes < 1 || opt.depth < 0 ||
+      opt.fanout < 1 || opt.methods < 0 || opt.nesting < 0 ||
+      opt.let_width < 0 || opt.case_width < 0 || opt.strings < 0 ||
+      opt.comments < 0)
+    usage(argv[0]);
+  rng_state = opt.seed * 2654435761ULL + 88172645463325252ULL;
+
+  // Class j of a tree is the child of class (j - 1) / fan-out, up to the
+  // depth; then the next tree begins.
+  long tree_size = 1, level = 1;
+  for (int d = 0; d < opt.depth && tree_size < opt.classes; d++) {
+    level *= opt.fanout;
+    tree_size += level;
+  }
+  for (int i = 0; i < opt.classes; i++) {
+    int j = (int) (i % tree_size);
+    parent.push_back(j == 0 ? -1 : i - j + (j - 1) / opt.fanout);
+    names.push_back("C" + str(i));
+  }
+
+  printf("(* generated by coolgen -c %d -d %d -f %d -m %d -e %d -l %d "
+         "-k %d -s %d -C %d -r %lu *)\n\n", opt.classes, opt.depth,
+         opt.fanout, opt.methods, opt.nesting, opt.let_width,
+         opt.case_width, opt.strings, opt.comments, opt.seed);
+  for (int i = 0; i < opt.classes; i++)
+    write_class(i);
+
+  printf("class Main inherits IO {\n  main() : Object {\n    {\n");
+  for (int i = 0; i < opt.classes; i++)
+    printf("      out_int(new %s.value(%d));\n      out_string(\"\\n\");\n",
+           names[i].c_str(), i);
+  printf("    }\n  };\n};\n");
+  exit(0);
+}
@@ -0,0 +1,91 @@
+// -*-Mode: C++;-*-
+//
+// See copyright.h for copyright notice and limitation of liability
+// and disclaimer of warranty provisions.
+//
+#include "copyright.h"
+
+#ifndef _COUNTERS_H_
+#define _COUNTERS_H_
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  counters.h
+//
+//  Counts the calls of the linear searches the compiler leans on -- the
+//  symbol table, the string tables, list_node::nth and semant's
+//  *_class_or_ancestry helpers -- how many of them found what they were
+//  looking for, and how many list cells or entries they looked at.  With
+//  --stats each phase prints them after its passes (stats.h):
+//
+//      counter                                  calls   hit %  visited/call
+//      SymbolTable::lookup                      20112    99.8          14.2
+//      ...
+//
+//  A search counts a visit for each cell it examines and one call, a hit
+//  or a miss, when it returns.  The counts are kept per thread, in a
+//  block the thread allocates the first time it counts, and are added up
+//  over all threads when they are reported.
+//
+//  The counters are compiled in only with -DCOUNTERS; without it
+//  COUNT_VISIT and COUNT_CALL are empty and the searches cost what they
+//  did before.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include "cool-io.h"
+
+enum Counter {
+  COUNTER_SYMTAB_LOOKUP,
+  COUNTER_SYMTAB_PROBE,
+  COUNTER_STRTAB_ADD,
+  COUNTER_STRTAB_LOOKUP_STRING,
+  COUNTER_STRTAB_LOOKUP,
+  COUNTER_LIST_NTH,
+  COUNTER_METHOD_ANCESTRY,
+  COUNTER_ATTRIBUTE_ANCESTRY,
+  COUNTER_METHOD_TYPE_ANCESTRY,
+  COUNTER_ATTRIBUTE_TYPE_ANCESTRY,
+  COUNTER_COUNT
+};
+
+#ifdef COUNTERS
+
+struct CounterValues {
+  unsigned long calls;
+  unsigned long hits;
+  unsigned long visited;
+};
+
+extern thread_local CounterValues *counter_block;  // COUNTER_COUNT of them
+CounterValues *counter_block_new();
+
+inline CounterValues *counters_here()
+{
+  return counter_block ? counter_block : counter_block_new();
+}
+
+#define COUNT_VISIT(c) (counters_here()[c].visited++)
+#define COUNT_CALL(c, hit)                                      \
+  do {                                                          \
+    CounterValues& count_values = counters_here()[c];           \
+    count_values.calls++;                                       \
+    if (hit)                                                    \
+      count_values.hits++;                                      \
+  } while (0)
+
+#else
+
+#define COUNT_VISIT(c)
+#define COUNT_CALL(c, hit)
+
+#endif
+
+//
+// Adds up the counts of all threads and writes the counters that were
+// called to `out', as a table or, if `json', as the elements of a JSON
+// array.  Writes nothing without -DCOUNTERS.
+//
+void counters_report(ostream& out, bool json);
+
+#endif
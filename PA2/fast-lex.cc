@@ -0,0 +1,551 @@
+//
+// See copyright.h for copyright notice and limitation of liability
+// and disclaimer of warranty provisions.
+//
+#include "copyright.h"
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  fast-lex.cc
+//
+//  A hand-written scanner for Cool, selected with -F.  cool_yylex_fast
+//  returns exactly the tokens, line numbers and error messages of the
+//  flex scanner in cool.flex, but it reads the whole file at once, scans
+//  identifiers with a table-driven loop and classifies keywords with a
+//  perfect hash instead of one DFA path per case-insensitive spelling.
+//
+//  The string and comment state (string_buf, string_is_bad,
+//  comment_balance, ...) is the one defined in cool-lex.cc, and the
+//  string actions below are those of cool.flex, so the two scanners also
+//  agree on the odd cases: state carried from one file to the next and
+//  characters echoed by flex's default rule.  The one difference is a
+//  string too long for string_buf; see string_buf_append.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+#include "cool-parse.h"
+#include "stringtab.h"
+#include "utilities.h"
+
+extern FILE *fin;
+extern int curr_lineno;
+extern YYSTYPE cool_yylval;
+
+// scanner state shared with cool-lex.cc
+extern char string_buf[];
+extern char *string_buf_ptr;
+extern char *curr_string_error_msg;
+extern bool string_is_bad;
+extern short int comment_balance;
+
+#define MAX_STR_CONST 1025      // size of string_buf, as in cool.flex
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  Keywords
+//
+//  The 17 keywords are placed in a 32 entry table by a hash of their
+//  length and their first and last letter, folded to lower case.  The
+//  table is checked at compile time, so a keyword that does not sit in
+//  its own slot is a build error rather than a wrong token.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+struct KeywordEntry {
+  const char *name;             // lower case spelling, NULL for empty slots
+  int len;
+  int token;
+};
+
+#define KEYWORD_SLOTS 32
+
+static constexpr int keyword_hash(char first, char last, int len)
+{
+  return ((first | 0x20) * 7 + (last | 0x20) * 17 + len) & (KEYWORD_SLOTS - 1);
+}
+
+static constexpr KeywordEntry keyword_table[KEYWORD_SLOTS] = {
+  { "pool", 4, POOL },         // 0
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { "fi", 2, FI },             // 5
+  { 0, 0, 0 },
+  { "if", 2, IF },             // 7
+  { "loop", 4, LOOP },         // 8
+  { "isvoid", 6, ISVOID },     // 9
+  { "inherits", 8, INHERITS }, // 10
+  { "let", 3, LET },           // 11
+  { "new", 3, NEW },           // 12
+  { 0, 0, 0 },
+  { "case", 4, CASE },         // 14
+  { "in", 2, IN },             // 15
+  { 0, 0, 0 },
+  { "of", 2, OF },             // 17
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { "not", 3, NOT },           // 25
+  { "esac", 4, ESAC },         // 26
+  { "while", 5, WHILE },       // 27
+  { "else", 4, ELSE },         // 28
+  { "class", 5, CLASS },       // 29
+  { "then", 4, THEN },         // 30
+  { 0, 0, 0 },
+};
+
+static constexpr bool keyword_slots_ok(int slot)
+{
+  return slot == KEYWORD_SLOTS ||
+    ((keyword_table[slot].name == 0 ||
+      keyword_hash(keyword_table[slot].name[0],
+                   keyword_table[slot].name[keyword_table[slot].len - 1],
+                   keyword_table[slot].len) == slot) &&
+     keyword_slots_ok(slot + 1));
+}
+
+static_assert(keyword_slots_ok(0), "keyword_table is not a perfect hash");
+
+#define MIN_KEYWORD_LEN 2
+#define MAX_KEYWORD_LEN 8
+
+//
+// Returns the keyword token spelled by s[0..len), ignoring case, or 0.
+// s is known to be an identifier, so or-ing 0x20 into a character
+// folds letters to lower case and never turns a digit or `_' into one.
+//
+static inline int keyword_token(const char *s, int len)
+{
+  if (len < MIN_KEYWORD_LEN || len > MAX_KEYWORD_LEN)
+    return 0;
+  const KeywordEntry& k = keyword_table[keyword_hash(s[0], s[len - 1], len)];
+  if (k.len != len)
+    return 0;
+  for (int i = 0; i < len; i++)
+    if ((s[i] | 0x20) != k.name[i])
+      return 0;
+  return k.token;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  Character classes
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#define CC_IDENT   0x01         // [a-zA-Z0-9_]
+#define CC_DIGIT   0x02         // [0-9]
+#define CC_BLANK   0x04         // [\f\r\t\v ]
+#define CC_STRSTOP 0x08         // ends a run of string characters: "\\\n\0
+#define CC_PRINT   0x10         // [\40-\176], skipped in -- comments
+
+static unsigned char char_class[256];
+static char char_text[256][2];  // one character strings for ERROR tokens
+
+static void init_char_classes()
+{
+  for (int c = 0; c < 256; c++) {
+    unsigned char cc = 0;
+    if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+        (c >= '0' && c <= '9') || c == '_')
+      cc |= CC_IDENT;
+    if (c >= '0' && c <= '9')
+      cc |= CC_DIGIT;
+    if (c == '\f' || c == '\r' || c == '\t' || c == '\v' || c == ' ')
+      cc |= CC_BLANK;
+    if (c == '"' || c == '\\' || c == '\n' || c == '\0')
+      cc |= CC_STRSTOP;
+    if (c >= 040 && c <= 0176)
+      cc |= CC_PRINT;
+    char_class[c] = cc;
+    char_text[c][0] = (char) c;
+    char_text[c][1] = '\0';
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  Input
+//
+//  The file is read into `input' on the first call after the previous
+//  file ended, with one spare byte so a lexeme can be terminated in
+//  place while it is entered in a string table.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+static std::vector<char> input;
+static char *cur, *lim;
+static bool loaded = false;
+
+enum { SCAN_INITIAL, SCAN_STRING, SCAN_COMMENT, SCAN_LINE_COMMENT };
+static int start_condition = SCAN_INITIAL;
+
+static void load_input()
+{
+  static bool classes_ready = false;
+  if (!classes_ready) {
+    init_char_classes();
+    classes_ready = true;
+  }
+
+  input.clear();
+  char chunk[65536];
+  size_t n;
+  while ((n = fread(chunk, 1, sizeof(chunk), fin)) > 0)
+    input.insert(input.end(), chunk, chunk + n);
+  size_t size = input.size();
+  input.push_back('\0');
+  cur = &input[0];
+  lim = cur + size;
+  loaded = true;
+}
+
+//
+// Enters s[0..len) in `table' the way the flex actions enter yytext.
+//
+template <class Elem>
+static inline Elem *add_lexeme(StringTable<Elem>& table, char *s, int len)
+{
+  char saved = s[len];
+  s[len] = '\0';
+  Elem *e = table.add_string(s);
+  s[len] = saved;
+  return e;
+}
+
+//
+// flex copies characters no rule matches to stdout.
+//
+static inline void echo(char c)
+{
+  fputc(c, stdout);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  The rules of cool.flex, one start condition at a time.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+static int scan_identifier()
+{
+  char *s = cur;
+  char *p = cur + 1;
+  while (p < lim && (char_class[(unsigned char) *p] & CC_IDENT))
+    p++;
+  int len = p - s;
+  cur = p;
+
+  int token = keyword_token(s, len);
+  if (token)
+    return token;
+
+  // t+[rR][uU][eE] and f[aA][lL][sS][eE]
+  if (s[0] == 't') {
+    int i = 1;
+    while (i < len && s[i] == 't')
+      i++;
+    if (len - i == 3 && (s[i] | 0x20) == 'r' && (s[i + 1] | 0x20) == 'u' &&
+        (s[i + 2] | 0x20) == 'e') {
+      cool_yylval.boolean = true;
+      return BOOL_CONST;
+    }
+  } else if (s[0] == 'f' && len == 5 && (s[1] | 0x20) == 'a' &&
+             (s[2] | 0x20) == 'l' && (s[3] | 0x20) == 's' &&
+             (s[4] | 0x20) == 'e') {
+    cool_yylval.boolean = false;
+    return BOOL_CONST;
+  }
+
+  cool_yylval.symbol = add_lexeme(idtable, s, len);
+  return (s[0] >= 'A' && s[0] <= 'Z') ? TYPEID : OBJECTID;
+}
+
+static int scan_initial()
+{
+  while (cur < lim) {
+    char c = *cur;
+    unsigned char cc = char_class[(unsigned char) c];
+
+    if (cc & CC_IDENT) {
+      if (!(cc & CC_DIGIT) && c != '_')
+        return scan_identifier();
+      if (cc & CC_DIGIT) {
+        char *s = cur;
+        while (cur < lim && (char_class[(unsigned char) *cur] & CC_DIGIT))
+          cur++;
+        cool_yylval.symbol = add_lexeme(inttable, s, cur - s);
+        return (INT_CONST);
+      }
+    }
+    if (cc & CC_BLANK) {
+      while (cur < lim && (char_class[(unsigned char) *cur] & CC_BLANK))
+        cur++;
+      continue;
+    }
+
+    char next = cur + 1 < lim ? cur[1] : '\0';
+    bool has_next = cur + 1 < lim;
+    cur++;
+    switch (c) {
+    case '\n':
+      curr_lineno++;
+      continue;
+    case '"':
+      string_buf_ptr = string_buf;
+      start_condition = SCAN_STRING;
+      return 0;
+    case '-':
+      if (has_next && next == '-') {
+        cur++;
+        start_condition = SCAN_LINE_COMMENT;
+        return 0;
+      }
+      return c;
+    case '(':
+      if (has_next && next == '*') {
+        cur++;
+        comment_balance++;
+        start_condition = SCAN_COMMENT;
+        return 0;
+      }
+      return c;
+    case '*':
+      if (has_next && next == ')') {
+        cur++;
+        cool_yylval.error_msg = "Unmatched *)";
+        return ERROR;
+      }
+      return c;
+    case '=':
+      if (has_next && next == '>') {
+        cur++;
+        return (DARROW);
+      }
+      return c;
+    case '<':
+      if (has_next && next == '=') {
+        cur++;
+        return LE;
+      }
+      if (has_next && next == '-') {
+        cur++;
+        return (ASSIGN);
+      }
+      return c;
+    case ';': case ',': case '{': case '}': case ':': case ')':
+    case '.': case '~': case '@': case '/': case '+':
+      return c;
+    default:
+      cool_yylval.error_msg = char_text[(unsigned char) c];
+      return ERROR;
+    }
+  }
+  return 0;
+}
+
+static void scan_line_comment()
+{
+  while (cur < lim) {
+    char c = *cur++;
+    if (c == '\n') {
+      curr_lineno++;
+      break;
+    }
+    if (!(char_class[(unsigned char) c] & CC_PRINT))
+      echo(c);
+  }
+  start_condition = SCAN_INITIAL;
+}
+
+//
+// Inside (* *).  A run of stars followed by any character other than
+// `*', `)' or a newline is skipped as a whole, so "*(*" does not open a
+// nested comment, just as in cool.flex.
+//
+static int scan_comment()
+{
+  while (cur < lim) {
+    char c = *cur;
+    if (c == '\n') {
+      curr_lineno++;
+      cur++;
+    } else if (c == '(') {
+      cur++;
+      if (cur < lim && *cur == '*') {
+        cur++;
+        comment_balance++;
+      }
+    } else if (c == '*') {
+      char *p = cur;
+      while (p < lim && *p == '*')
+        p++;
+      if (p == lim || *p == '\n') {
+        cur = p;
+      } else if (*p == ')') {
+        cur = p + 1;
+        comment_balance--;
+        if (comment_balance == 0) {
+          start_condition = SCAN_INITIAL;
+          return 0;
+        }
+      } else {
+        cur = p + 1;
+      }
+    } else {
+      cur++;
+    }
+  }
+  start_condition = SCAN_INITIAL;
+  cool_yylval.error_msg = "EOF in comment";
+  return (ERROR);
+}
+
+//
+// Appends s[0..len) to string_buf.  The flex actions copy without a
+// bound and run past the end of string_buf on very long strings; here
+// the excess is dropped and the string is reported as too long, which
+// is what flex reports for a string that just fills the buffer.
+//
+static inline void string_buf_append(const char *s, int len)
+{
+  int room = string_buf + MAX_STR_CONST - 1 - string_buf_ptr;
+  if (len > room) {
+    len = room;
+    cool_yylval.error_msg = "String constant too long";
+    curr_string_error_msg = "String constant too long";
+    string_is_bad = true;
+  }
+  memcpy(string_buf_ptr, s, len);
+  string_buf_ptr += len;
+}
+
+static int scan_string()
+{
+  for (;;) {
+    if (cur == lim) {
+      cool_yylval.error_msg = "EOF in string constant";
+      curr_string_error_msg = "EOF in string constant";
+      start_condition = SCAN_INITIAL;
+      return (ERROR);
+    }
+
+    char c = *cur;
+    switch (c) {
+    case '\0':
+      cur++;
+      cool_yylval.error_msg = "String contains null character";
+      curr_string_error_msg = "String contains null character";
+      string_is_bad = true;
+      break;
+
+    case '\n':
+      cur++;
+      cool_yylval.symbol = stringtable.add_string(string_buf);
+      cool_yylval.error_msg = "Unterminated string";
+      curr_string_error_msg = "Unterminated string";
+      string_buf_ptr = string_buf;
+      memset(string_buf, 0, strlen(string_buf));
+      start_condition = SCAN_INITIAL;
+      curr_lineno++;
+      return (ERROR);
+
+    case '"':
+      cur++;
+      start_condition = SCAN_INITIAL;
+      cool_yylval.symbol = stringtable.add_string(string_buf);
+      memset(string_buf, 0, strlen(string_buf));
+      string_buf_ptr = string_buf;
+      if (string_is_bad) {
+        cool_yylval.error_msg = curr_string_error_msg;
+        string_is_bad = false;
+        return ERROR;
+      }
+      return STR_CONST;
+
+    case '\\': {
+      if (cur + 1 == lim) {
+        // a lone backslash at the end of the file matches no rule
+        echo(c);
+        cur++;
+        break;
+      }
+      char escaped = cur[1];
+      cur += 2;
+      if (escaped == '\n') {
+        string_buf_append("\n", 1);
+        curr_lineno++;
+        break;
+      }
+
+      if (strlen(string_buf) == 1024) {
+        cool_yylval.symbol = stringtable.add_string(string_buf);
+        cool_yylval.error_msg = "String constant too long";
+        curr_string_error_msg = "String constant too long";
+        string_is_bad = true;
+      }
+
+      switch (escaped) {
+      case 'b':  escaped = '\b'; break;
+      case 't':  escaped = '\t'; break;
+      case 'n':  escaped = '\n'; break;
+      case 'f':  escaped = '\f'; break;
+      case 0:
+        cool_yylval.symbol = stringtable.add_string(string_buf);
+        cool_yylval.error_msg = "String contains escaped null character";
+        curr_string_error_msg = "String contains escaped null character";
+        string_is_bad = true;
+        // cool.flex restarts the buffer and then steps over its first
+        // character
+        string_buf_ptr = string_buf + 1;
+        continue;
+      }
+      string_buf_append(&escaped, 1);
+      break;
+    }
+
+    default: {
+      // [^"\\\n\0]*
+      char *s = cur;
+      while (cur < lim && !(char_class[(unsigned char) *cur] & CC_STRSTOP))
+        cur++;
+      string_buf_append(s, cur - s);
+      break;
+    }
+    }
+  }
+}
+
+//
+// Returns the next token, or 0 at the end of the file.  Like the flex
+// scanner, it starts over on `fin' after returning 0.
+//
+int cool_yylex_fast()
+{
+  if (!loaded)
+    load_input();
+
+  for (;;) {
+    int token = 0;
+    switch (start_condition) {
+    case SCAN_INITIAL:
+      if (cur == lim) {
+        loaded = false;
+        return 0;
+      }
+      token = scan_initial();
+      break;
+    case SCAN_STRING:
+      token = scan_string();
+      break;
+    case SCAN_COMMENT:
+      token = scan_comment();
+      break;
+    case SCAN_LINE_COMMENT:
+      scan_line_comment();
+      break;
+    }
+    if (token)
+      return token;
+  }
+}
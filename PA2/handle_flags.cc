@@ -8,7 +8,11 @@
 #include <stdlib.h>
 #include "cool-io.h"
 #include <unistd.h>
+#include <string.h>
+#include <getopt.h>
 #include "cgen_gc.h"
+#include "stats.h"
+#include "trace.h"
 
 //
 // coolc provides a debugging switch for each phase of the compiler,
@@ -30,7 +34,14 @@ extern int cool_yydebug;        // for the parser
        bool disable_reg_alloc;  // Don't do register allocation
 
        int cgen_optimize;       // optimize switch for code generator 
+       int cgen_inline_cache;   // cache the target of each dynamic dispatch
        char *out_filename;      // file name for generated code
+       int binary_stream;       // write the binary token stream (-b)
+       int fast_lexer;          // use the hand-written scanner (-F)
+       int pipeline_parse;      // scan on a thread of its own (-P)
+       int parse_jobs;          // parse the input files on this many threads (-j n)
+       int compiler_stats;      // report time and memory of each pass (--stats)
+       char *trace_filename;    // write a trace of the passes here (--trace)
        Memmgr cgen_Memmgr = GC_NOGC;      // enable/disable garbage collection
        Memmgr_Test cgen_Memmgr_Test = GC_NORMAL;  // normal/test GC
        Memmgr_Debug cgen_Memmgr_Debug = GC_QUICK; // check heap frequently
@@ -39,6 +50,16 @@ extern int cool_yydebug;        // for the parser
 extern int optind, opterr;
 extern char *optarg;
 
+// options with no one-letter form
+enum { OPT_STATS = 256, OPT_TRACE, OPT_INLINE_CACHE };
+
+static struct option long_options[] = {
+  { "stats", optional_argument, NULL, OPT_STATS },  // --stats[=text|json]
+  { "trace", required_argument, NULL, OPT_TRACE },  // --trace=file.json
+  { "inline-cache", no_argument, NULL, OPT_INLINE_CACHE },
+  { NULL, 0, NULL, 0 }
+};
+
 void handle_flags(int argc, char *argv[]) {
   int c;
   int unknownopt = 0;
@@ -50,10 +71,18 @@ void handle_flags(int argc, char *argv[]) {
   semant_debug = 0;
   cgen_debug = 0;
   cgen_optimize = 0;
+  cgen_inline_cache = 0;
   disable_reg_alloc = 0;
-  
+  binary_stream = 0;
+  fast_lexer = 0;
+  pipeline_parse = 0;
+  parse_jobs = 1;
+  compiler_stats = STATS_OFF;
+  trace_filename = NULL;
 
-  while ((c = getopt(argc, argv, "lpscvrOo:gtT")) != -1) {
+
+  while ((c = getopt_long(argc, argv, "lpscvrOo:gtTbFPj:", long_options,
+                          NULL)) != -1) {
     switch (c) {
 #ifdef DEBUG
     case 'l':
@@ -99,6 +128,40 @@ void handle_flags(int argc, char *argv[]) {
     case 'O':  // enable optimization
       cgen_optimize = 1;
       break;
+    case 'b':  // binary instead of text output between phases
+      binary_stream = 1;
+      break;
+    case 'F':  // scan with fast-lex.cc instead of the flex scanner
+      fast_lexer = 1;
+      break;
+    case 'P':  // overlap scanning and parsing (cool_yyparse_pipelined)
+      pipeline_parse = 1;
+      break;
+    case 'j':  // parse files concurrently (cool_yyparse_files)
+      parse_jobs = atoi(optarg);
+      if (parse_jobs < 1)
+        unknownopt = 1;
+      break;
+    case OPT_INLINE_CACHE:  // monomorphic inline caches at dispatches
+      cgen_inline_cache = 1;
+      break;
+    case OPT_STATS:  // per-pass time and memory on stderr (stats.h)
+      if (optarg == NULL || strcmp(optarg, "text") == 0)
+        compiler_stats = STATS_TEXT;
+      else if (strcmp(optarg, "json") == 0)
+        compiler_stats = STATS_JSON;
+      else
+        unknownopt = 1;
+      break;
+#ifdef TRACE
+    case OPT_TRACE:  // Chrome trace of the passes (trace.h)
+      trace_filename = optarg;
+      break;
+#else
+    case OPT_TRACE:
+      cerr << "No tracing available\n";
+      break;
+#endif
     case '?':
       unknownopt = 1;
       break;
@@ -111,9 +174,13 @@ void handle_flags(int argc, char *argv[]) {
   if (unknownopt) {
       cerr << "usage: " << argv[0] << 
 #ifdef DEBUG
-	  " [-lvpscOgtTr -o outname] [input-files]\n";
+	  " [-lvpscOgtTrbFP -j n -o outname --stats[=json] --trace=file"
+	  " --inline-cache]"
+	  " [input-files]\n";
 #else
-      " [-OgtT -o outname] [input-files]\n";
+      " [-OgtTbFP -j n -o outname --stats[=json] --trace=file"
+      " --inline-cache]"
+      " [input-files]\n";
 #endif
       exit(1);
   }
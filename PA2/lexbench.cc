@@ -0,0 +1,174 @@
+//
+// See copyright.h for copyright notice and limitation of liability
+// and disclaimer of warranty provisions.
+//
+#include "copyright.h"
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  lexbench.cc
+//
+//  Compares the flex scanner (cool-lex.cc) with the hand-written one
+//  (fast-lex.cc) on a set of Cool files:
+//
+//      lexbench [-n passes] file.cl ...
+//
+//  The token dumps of both scanners are compared first; any difference
+//  is reported and the benchmark is not run.  Then each scanner reads
+//  all the files `passes' times (default 100) and the time per pass and
+//  throughput are printed.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <sstream>
+#include <string>
+#include "cool-parse.h"
+#include "utilities.h"
+
+int curr_lineno = 1;
+char *curr_filename = "<stdin>";
+FILE *fin;
+YYSTYPE cool_yylval;
+int cool_yydebug;
+
+extern int yy_flex_debug;
+extern int cool_yylex();
+extern int cool_yylex_fast();
+
+// scanner state defined in cool-lex.cc
+#define MAX_STR_CONST 1025
+extern char string_buf[];
+extern char *string_buf_ptr;
+extern char *curr_string_error_msg;
+extern bool string_is_bad;
+extern short int comment_balance;
+
+extern void dump_cool_token(ostream& out, int lineno,
+			    int token, YYSTYPE yylval);
+
+struct Scanner {
+  const char *name;
+  int (*next_token)();
+};
+
+static Scanner scanners[] = {
+  { "flex", cool_yylex },
+  { "fast", cool_yylex_fast },
+};
+
+#define NSCANNERS ((int) (sizeof(scanners) / sizeof(scanners[0])))
+
+//
+// Both scanners share this state, so every run starts from a clean copy.
+//
+static void reset_scanner_state()
+{
+  memset(string_buf, 0, MAX_STR_CONST);
+  string_buf_ptr = string_buf;
+  curr_string_error_msg = "";
+  string_is_bad = false;
+  comment_balance = 0;
+}
+
+static void open_input(char *name)
+{
+  fin = fopen(name, "r");
+  if (fin == NULL) {
+    cerr << "Could not open input file " << name << endl;
+    exit(1);
+  }
+  curr_lineno = 1;
+}
+
+static std::string dump_tokens(Scanner& s, int nfiles, char **files)
+{
+  std::ostringstream out;
+  int token;
+
+  reset_scanner_state();
+  for (int i = 0; i < nfiles; i++) {
+    open_input(files[i]);
+    out << "#name \"" << files[i] << "\"" << endl;
+    while ((token = s.next_token()) != 0)
+      dump_cool_token(out, curr_lineno, token, cool_yylval);
+    fclose(fin);
+  }
+  return out.str();
+}
+
+//
+// Scans all files once and returns the number of tokens seen.
+//
+static long scan_files(Scanner& s, int nfiles, char **files)
+{
+  long tokens = 0;
+
+  reset_scanner_state();
+  for (int i = 0; i < nfiles; i++) {
+    open_input(files[i]);
+    while (s.next_token() != 0)
+      tokens++;
+    fclose(fin);
+  }
+  return tokens;
+}
+
+int main(int argc, char **argv)
+{
+  int passes = 100;
+  int first = 1;
+
+  yy_flex_debug = 0;
+
+  if (argc > 2 && strcmp(argv[1], "-n") == 0) {
+    passes = atoi(argv[2]);
+    first = 3;
+  }
+  if (first >= argc || passes <= 0) {
+    cerr << "usage: " << argv[0] << " [-n passes] file.cl ...\n";
+    exit(1);
+  }
+  int nfiles = argc - first;
+  char **files = argv + first;
+
+  long bytes = 0;
+  for (int i = 0; i < nfiles; i++) {
+    open_input(files[i]);
+    fseek(fin, 0, SEEK_END);
+    bytes += ftell(fin);
+    fclose(fin);
+  }
+
+  std::string expected = dump_tokens(scanners[0], nfiles, files);
+  for (int s = 1; s < NSCANNERS; s++) {
+    if (dump_tokens(scanners[s], nfiles, files) != expected) {
+      cerr << "lexbench: " << scanners[s].name << " and " << scanners[0].name
+	   << " scanners disagree on the token stream\n";
+      exit(1);
+    }
+  }
+
+  cout << nfiles << " files, " << bytes << " bytes, " << passes
+       << " passes\n";
+  for (int s = 0; s < NSCANNERS; s++) {
+    long tokens = 0;
+    std::chrono::steady_clock::time_point start =
+      std::chrono::steady_clock::now();
+    for (int p = 0; p < passes; p++)
+      tokens = scan_files(scanners[s], nfiles, files);
+    double seconds = std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - start).count();
+
+    char line[200];
+    snprintf(line, sizeof(line),
+	     "%-5s %8ld tokens  %10.3f ms/pass  %8.2f MB/s\n",
+	     scanners[s].name, tokens, seconds * 1000 / passes,
+	     bytes * (double) passes / seconds / 1e6);
+    cout << line;
+  }
+  exit(0);
+}
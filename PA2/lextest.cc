@@ -11,6 +11,11 @@
 //  Reads input from file argument.
 //
 //  Option -l prints summary of flex actions.
+//  Option -b writes the binary token stream (token-stream.h) instead
+//  of the text dump.
+//  Option -F scans with the hand-written scanner in fast-lex.cc.
+//  Option --stats reports the time and memory taken (stats.h), and
+//  --trace=file writes when the scan began and ended (trace.h).
 //
 //////////////////////////////////////////////////////////////////////////////
 
@@ -18,6 +23,8 @@
 #include <unistd.h>     // for getopt
 #include "cool-parse.h" // bison-generated file; defines tokens
 #include "utilities.h"
+#include "token-stream.h"
+#include "stats.h"
 
 //
 //  The lexer keeps this global variable up to date with the line number
@@ -32,6 +39,7 @@ FILE *fin;   // This is the file pointer from which the lexer reads its input.
 //  token each time it is called.
 //
 extern int cool_yylex();
+extern int cool_yylex_fast();   // fast-lex.cc; same tokens as cool_yylex
 YYSTYPE cool_yylval;           // Not compiled with parser, so must define this.
 
 extern int optind;  // used for option processing (man 3 getopt for more info)
@@ -42,6 +50,8 @@ extern int optind;  // used for option processing (man 3 getopt for more info)
 //
 extern int yy_flex_debug;      // Flex debugging; see flex documentation.
 extern int lex_verbose;        // Controls printing of tokens.
+extern int binary_stream;      // Controls the format of the token dump.
+extern int fast_lexer;         // Selects cool_yylex_fast.
 void handle_flags(int argc, char *argv[]);
 
 //
@@ -59,8 +69,11 @@ extern void dump_cool_token(ostream& out, int lineno,
 
 int main(int argc, char** argv) {
 	int token;
+	TokenStreamWriter writer;
 	
 	handle_flags(argc,argv);
+	int (*next_token)() = fast_lexer ? cool_yylex_fast : cool_yylex;
+	StatsPass *lex = new StatsPass("lex");
 
 	while (optind < argc) {
 	    fin = fopen(argv[optind], "r");
@@ -77,13 +90,26 @@ int main(int argc, char** argv) {
 	    //
 	    // Scan and print all tokens.
 	    //
-	    cout << "#name \"" << argv[optind] << "\"" << endl;
-	    while ((token = cool_yylex()) != 0) {
-		dump_cool_token(cout, curr_lineno, token, cool_yylval);
+	    if (binary_stream) {
+		writer.begin_file(argv[optind]);
+		while ((token = next_token()) != 0) {
+		    writer.put(curr_lineno, token, cool_yylval);
+		}
+	    } else {
+		cout << "#name \"" << argv[optind] << "\"" << endl;
+		while ((token = next_token()) != 0) {
+		    dump_cool_token(cout, curr_lineno, token, cool_yylval);
+		}
 	    }
 	    fclose(fin);
 	    optind++;
 	}
+	if (binary_stream) {
+	    writer.flush(cout);
+	}
+	delete lex;
+	stats_report("lexer");
+	trace_write();
 	exit(0);
 }
 
@@ -0,0 +1,103 @@
+#!/bin/sh
+#
+#  scalebench.sh [-p option] [-o name] [-g "coolgen options"] [value ...]
+#
+#  Measures how each phase of the compiler scales with the size of its
+#  input.  For each value, coolgen writes a program with its option
+#  `option' (default c, the number of classes) set to the value and the
+#  others set by -g or left at their defaults; the program then goes
+#  through the lexer, parser, semant and cgen, each run with --stats=json.
+#  The wall time and peak resident set size of every phase are written,
+#  one line per value, to name.dat (default scale.dat):
+#
+#      value  bytes  lex_ms parse_ms semant_ms cgen_ms  lex_kb ... cgen_kb
+#
+#  and, if gnuplot is installed, plotted against the size of the program
+#  in name.png on log-log axes, where a phase that is quadratic in its
+#  input has twice the slope of one that is linear.
+#
+#  The phases are ./lexer, ../PA3/parser, ../PA4/semant and ../PA5/cgen,
+#  as built by the Makefiles of the assignments; set LEXER, PARSER,
+#  SEMANT and CGEN to run others.  The programs are kept in name-*.cl.
+#
+
+LEXER=${LEXER-./lexer}
+PARSER=${PARSER-../PA3/parser}
+SEMANT=${SEMANT-../PA4/semant}
+CGEN=${CGEN-../PA5/cgen}
+COOLGEN=${COOLGEN-./coolgen}
+
+option=c
+name=scale
+genopts=
+while getopts p:o:g: flag; do
+  case $flag in
+  p) option=$OPTARG ;;
+  o) name=$OPTARG ;;
+  g) genopts=$OPTARG ;;
+  *) echo "usage: $0 [-p option] [-o name] [-g \"coolgen options\"] [value ...]" >&2
+     exit 1 ;;
+  esac
+done
+shift `expr $OPTIND - 1`
+[ $# -eq 0 ] && set -- 25 50 100 200 400 800
+
+# Adds up the wall time, and takes the largest peak RSS, of the top-level
+# passes of the --stats=json report in file $1.
+phase_stats() {
+  awk '/^\{"phase"/ {
+         s = $0
+         while (match(s, /"depth": 0, [^}]*/)) {
+           pass = substr(s, RSTART, RLENGTH)
+           s = substr(s, RSTART + RLENGTH)
+           if (match(pass, /"wall_ms": [0-9.]+/))
+             wall += substr(pass, RSTART + 11, RLENGTH - 11)
+           if (match(pass, /"peak_rss_kb": [0-9]+/) &&
+               substr(pass, RSTART + 15, RLENGTH - 15) + 0 > peak)
+             peak = substr(pass, RSTART + 15, RLENGTH - 15) + 0
+         }
+       }
+       END { printf "%.3f %d\n", wall, peak }' "$1"
+}
+
+echo "# value bytes lex_ms parse_ms semant_ms cgen_ms lex_kb parse_kb semant_kb cgen_kb" > $name.dat
+for value in "$@"; do
+  prog=$name-$value
+  $COOLGEN $genopts -$option $value > $prog.cl || exit 1
+  $LEXER --stats=json $prog.cl > $prog.tok 2> $prog.lex.json &&
+  $PARSER --stats=json < $prog.tok > $prog.ast 2> $prog.parse.json &&
+  $SEMANT --stats=json < $prog.ast > $prog.sem 2> $prog.semant.json &&
+  $CGEN --stats=json < $prog.sem > $prog.s 2> $prog.cgen.json || {
+    echo "$0: the compiler failed on $prog.cl" >&2
+    exit 1
+  }
+  set -- `phase_stats $prog.lex.json` `phase_stats $prog.parse.json` \
+         `phase_stats $prog.semant.json` `phase_stats $prog.cgen.json`
+  echo "$value `wc -c < $prog.cl` $1 $3 $5 $7 $2 $4 $6 $8" >> $name.dat
+  rm -f $prog.tok $prog.ast $prog.sem $prog.s $prog.*.json
+done
+cat $name.dat
+
+if command -v gnuplot > /dev/null 2>&1; then
+  gnuplot <<EOF
+set terminal png size 1000,450
+set output "$name.png"
+set multiplot layout 1,2
+set logscale xy
+set key top left
+set xlabel "program size (bytes)"
+set ylabel "wall time (ms)"
+plot "$name.dat" using 2:3 with linespoints title "lex", \
+     "" using 2:4 with linespoints title "parse", \
+     "" using 2:5 with linespoints title "semant", \
+     "" using 2:6 with linespoints title "cgen"
+set ylabel "peak RSS (KB)"
+plot "$name.dat" using 2:7 with linespoints title "lex", \
+     "" using 2:8 with linespoints title "parse", \
+     "" using 2:9 with linespoints title "semant", \
+     "" using 2:10 with linespoints title "cgen"
+unset multiplot
+EOF
+  echo "plotted in $name.png"
+fi
+exit 0
@@ -0,0 +1,284 @@
+//
+// See copyright.h for copyright notice and limitation of liability
+// and disclaimer of warranty provisions.
+//
+#include "copyright.h"
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  token-stream.cc
+//
+//  Writer and reader for the binary token stream; see token-stream.h
+//  for the layout.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include <string.h>
+#include "token-stream.h"
+#include "utilities.h"
+
+extern int curr_lineno;
+extern char *curr_filename;
+
+//
+// Token codes are stored in one byte.  Single character tokens keep
+// their ASCII value; the named tokens (258 and up) are moved into the
+// range above 127.  Code 1 marks the start of a new input file.
+//
+#define TOKEN_STREAM_FILE  1
+#define FIRST_NAMED_TOKEN  CLASS
+
+static int token_stream_code(int token)
+{
+  return token < 128 ? token : token - FIRST_NAMED_TOKEN + 128;
+}
+
+static int token_stream_token(int code)
+{
+  return code < 128 ? code : code - 128 + FIRST_NAMED_TOKEN;
+}
+
+static void put_varint(std::string& out, unsigned int v)
+{
+  while (v >= 0x80) {
+    out += (char) (v | 0x80);
+    v >>= 7;
+  }
+  out += (char) v;
+}
+
+static unsigned int zigzag(int v)
+{
+  return ((unsigned int) v << 1) ^ (unsigned int) (v >> 31);
+}
+
+static int unzigzag(unsigned int v)
+{
+  return (int) (v >> 1) ^ -(int) (v & 1);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  TokenStreamWriter
+//
+//////////////////////////////////////////////////////////////////////////////
+
+int TokenStreamWriter::intern(TokenStreamKind kind, const char *s, int len)
+{
+  std::pair<char,std::string> key((char) kind, std::string(s, len));
+  std::map<std::pair<char,std::string>, int>::iterator it = string_index.find(key);
+  if (it != string_index.end())
+    return it->second;
+
+  int index = strings.size();
+  strings.push_back(key);
+  string_index[key] = index;
+  return index;
+}
+
+void TokenStreamWriter::begin_file(char *filename)
+{
+  tokens += (char) TOKEN_STREAM_FILE;
+  put_varint(tokens, zigzag(1 - last_line));
+  put_varint(tokens, intern(TS_TEXT, filename, strlen(filename)));
+  last_line = 1;
+  token_count++;
+}
+
+void TokenStreamWriter::put(int lineno, int token, YYSTYPE yylval)
+{
+  tokens += (char) token_stream_code(token);
+  put_varint(tokens, zigzag(lineno - last_line));
+  last_line = lineno;
+  token_count++;
+
+  switch (token) {
+  case (STR_CONST):
+    put_varint(tokens, intern(TS_STR, yylval.symbol->get_string(), yylval.symbol->get_len()));
+    break;
+  case (INT_CONST):
+    put_varint(tokens, intern(TS_INT, yylval.symbol->get_string(), yylval.symbol->get_len()));
+    break;
+  case (TYPEID):
+  case (OBJECTID):
+    put_varint(tokens, intern(TS_ID, yylval.symbol->get_string(), yylval.symbol->get_len()));
+    break;
+  case (BOOL_CONST):
+    tokens += (char) (yylval.boolean ? 1 : 0);
+    break;
+  case (ERROR):
+    put_varint(tokens, intern(TS_TEXT, yylval.error_msg, strlen(yylval.error_msg)));
+    break;
+  }
+}
+
+void TokenStreamWriter::flush(ostream& out)
+{
+  std::string header(TOKEN_STREAM_MAGIC, 4);
+  put_varint(header, TOKEN_STREAM_VERSION);
+
+  put_varint(header, strings.size());
+  for (size_t i = 0; i < strings.size(); i++) {
+    header += strings[i].first;
+    put_varint(header, strings[i].second.size());
+    header += strings[i].second;
+  }
+  put_varint(header, token_count);
+
+  out.write(header.data(), header.size());
+  out.write(tokens.data(), tokens.size());
+  out.flush();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  TokenStreamReader
+//
+//////////////////////////////////////////////////////////////////////////////
+
+//
+// Reads a varint at `pos'.  Running off the end of the buffer is a
+// malformed stream and stops the compiler.
+//
+static unsigned int get_varint(std::vector<char>& buf, size_t& pos)
+{
+  unsigned int v = 0;
+  for (int shift = 0; shift < 35; shift += 7) {
+    if (pos >= buf.size())
+      fatal_error("Truncated binary token stream\n");
+    unsigned char c = buf[pos++];
+    v |= (unsigned int) (c & 0x7f) << shift;
+    if (!(c & 0x80))
+      return v;
+  }
+  fatal_error("Malformed varint in binary token stream\n");
+  return 0;
+}
+
+//
+// Loads the stream in `f', replacing any stream loaded before.  The file
+// names and error messages of the old stream stay allocated, since
+// tokens already returned may still point to them.
+//
+bool TokenStreamReader::load(FILE *f)
+{
+  char chunk[65536];
+  size_t n;
+  buf.clear();
+  pos = 0;
+  remaining = 0;
+  line = 0;
+  while ((n = fread(chunk, 1, sizeof(chunk), f)) > 0)
+    buf.insert(buf.end(), chunk, chunk + n);
+
+  if (buf.size() < 4 || memcmp(&buf[0], TOKEN_STREAM_MAGIC, 4) != 0)
+    return false;
+  pos = 4;
+  if (get_varint(buf, pos) != TOKEN_STREAM_VERSION)
+    return false;
+
+  unsigned int count = get_varint(buf, pos);
+  symbols.resize(count);
+  texts.resize(count);
+  for (unsigned int i = 0; i < count; i++) {
+    if (pos >= buf.size())
+      return false;
+    char kind = buf[pos++];
+    unsigned int len = get_varint(buf, pos);
+    if (pos + len > buf.size())
+      return false;
+
+    char *s = new char[len + 1];
+    memcpy(s, &buf[pos], len);
+    s[len] = '\0';
+    pos += len;
+
+    symbols[i] = NULL;
+    texts[i] = NULL;
+    switch (kind) {
+    case TS_ID:   symbols[i] = idtable.add_string(s, len);     delete [] s; break;
+    case TS_INT:  symbols[i] = inttable.add_string(s, len);    delete [] s; break;
+    case TS_STR:  symbols[i] = stringtable.add_string(s, len); delete [] s; break;
+    case TS_TEXT: texts[i] = s; break;
+    default:      return false;
+    }
+  }
+
+  remaining = get_varint(buf, pos);
+  return true;
+}
+
+//
+// Reads an index into the string section.
+//
+unsigned int TokenStreamReader::get_index()
+{
+  unsigned int index = get_varint(buf, pos);
+  if (index >= symbols.size())
+    fatal_error("Bad string index in binary token stream\n");
+  return index;
+}
+
+//
+// Returns the next token (0 at the end of the stream) and fills in its
+// semantic value and line number.  File markers are consumed here and
+// only update `filename'.
+//
+int TokenStreamReader::next(YYSTYPE *yylval, int *lineno, char **filename)
+{
+  while (remaining > 0) {
+    remaining--;
+    if (pos >= buf.size())
+      fatal_error("Truncated binary token stream\n");
+
+    int code = (unsigned char) buf[pos++];
+    line += unzigzag(get_varint(buf, pos));
+    *lineno = line;
+
+    if (code == TOKEN_STREAM_FILE) {
+      *filename = texts[get_index()];
+      continue;
+    }
+
+    int token = token_stream_token(code);
+    switch (token) {
+    case (STR_CONST):
+    case (INT_CONST):
+    case (TYPEID):
+    case (OBJECTID):
+      yylval->symbol = symbols[get_index()];
+      break;
+    case (BOOL_CONST):
+      if (pos >= buf.size())
+        fatal_error("Truncated binary token stream\n");
+      yylval->boolean = buf[pos++];
+      break;
+    case (ERROR):
+      yylval->error_msg = texts[get_index()];
+      break;
+    }
+    return token;
+  }
+  return 0;
+}
+
+bool token_stream_is_binary(FILE *f)
+{
+  int c = getc(f);
+  if (c == EOF)
+    return false;
+  ungetc(c, f);
+  return c == TOKEN_STREAM_MAGIC[0];
+}
+
+static TokenStreamReader token_stream_reader;
+
+bool token_stream_open(FILE *f)
+{
+  return token_stream_reader.load(f);
+}
+
+int cool_yylex_binary()
+{
+  return token_stream_reader.next(&cool_yylval, &curr_lineno, &curr_filename);
+}
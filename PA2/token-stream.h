@@ -0,0 +1,107 @@
+// -*-Mode: C++;-*-
+//
+// See copyright.h for copyright notice and limitation of liability
+// and disclaimer of warranty provisions.
+//
+#include "copyright.h"
+
+#ifndef _TOKEN_STREAM_H_
+#define _TOKEN_STREAM_H_
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  token-stream.h
+//
+//  A compact binary encoding of the token stream passed from the lexer to
+//  the parser.  It replaces the text lines written by dump_cool_token
+//  when the phases are run with -b, so the parser does not have to
+//  re-scan formatted text.
+//
+//  Layout (all integers are unsigned LEB128 varints):
+//
+//     magic       4 bytes, "\0CTS"; no text token stream starts with \0
+//     version     TOKEN_STREAM_VERSION
+//     strings     count, then for every entry:
+//                    kind (one byte, a TokenStreamKind), length, bytes
+//     tokens      count, then for every token:
+//                    code (one byte, see token_stream_code)
+//                    line delta from the previous token (zigzag encoded)
+//                    STR_CONST, INT_CONST, TYPEID, OBJECTID, ERROR and
+//                    the file marker: index into the string section
+//                    BOOL_CONST: one byte, 0 or 1
+//
+//  Each distinct symbol is written once in the string section, so a
+//  token refers to its lexeme by index.  A file marker plays the role of
+//  the `#name "file"' line of the text format.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <string>
+#include <vector>
+#include <map>
+#include "cool-io.h"
+#include "cool-parse.h"
+#include "stringtab.h"
+
+#define TOKEN_STREAM_MAGIC    "\0CTS"
+#define TOKEN_STREAM_VERSION  1
+
+enum TokenStreamKind { TS_ID, TS_INT, TS_STR, TS_TEXT };
+
+//
+// TokenStreamWriter collects the tokens of all input files and writes
+// the whole stream, string section first, when flush is called.
+//
+class TokenStreamWriter {
+private:
+  std::vector<std::pair<char,std::string> > strings;  // in index order
+  std::map<std::pair<char,std::string>, int> string_index;
+  std::string tokens;                     // encoded token section
+  int token_count;
+  int last_line;
+
+  int intern(TokenStreamKind kind, const char *s, int len);
+public:
+  TokenStreamWriter() : token_count(0), last_line(0) { }
+  void begin_file(char *filename);
+  void put(int lineno, int token, YYSTYPE yylval);
+  void flush(ostream& out);
+};
+
+//
+// TokenStreamReader loads an encoded stream and hands its tokens back
+// one at a time, re-entering every lexeme in the proper string table.
+//
+class TokenStreamReader {
+private:
+  std::vector<char> buf;
+  size_t pos;
+  std::vector<Symbol> symbols;            // lexeme of each string entry
+  std::vector<char *> texts;              // error messages and file names
+  int remaining;
+  int line;
+
+  unsigned int get_index();
+public:
+  TokenStreamReader() : pos(0), remaining(0), line(0) { }
+  bool load(FILE *f);
+  int next(YYSTYPE *yylval, int *lineno, char **filename);
+};
+
+//
+// Returns true if the stream in `f' starts with the binary magic.
+// Only one character is consumed and it is pushed back.
+//
+bool token_stream_is_binary(FILE *f);
+
+//
+// The parser reads a binary stream by loading it with token_stream_open
+// and then pulling tokens from cool_yylex_binary instead of cool_yylex.
+// cool_yylex_binary keeps cool_yylval, curr_lineno and curr_filename up
+// to date exactly like the text scanner does.
+//
+bool token_stream_open(FILE *f);
+int cool_yylex_binary();
+
+#endif
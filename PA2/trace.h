@@ -0,0 +1,91 @@
+// -*-Mode: C++;-*-
+//
+// See copyright.h for copyright notice and limitation of liability
+// and disclaimer of warranty provisions.
+//
+#include "copyright.h"
+
+#ifndef _TRACE_H_
+#define _TRACE_H_
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  trace.h
+//
+//  With --trace=file.json a phase records when each of its passes (every
+//  StatsPass, see stats.h), each class semant validates and each class
+//  cgen codes begins and ends, on which thread, and writes them to
+//  file.json in the Chrome trace event format when it is done.  The file
+//  loads in chrome://tracing and in the Perfetto UI.
+//
+//  An event is recorded when its TraceScope goes out of scope, as one
+//  complete ("ph": "X") event, in a ring buffer of the thread it ran on.
+//  A thread keeps its last TRACE_RING_SIZE events; older ones are
+//  overwritten.  Recording takes no lock.
+//
+//  Tracing is compiled in only with -DTRACE, which `make TRACE=1' adds
+//  to CFLAGS (run make clean when switching).  Without it TRACE_SCOPE is
+//  empty and --trace is refused, as the debugging switches are without
+//  -DDEBUG.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#define TRACE_RING_SIZE 65536   // events kept per thread
+
+extern char *trace_filename;    // set by --trace in handle_flags
+
+#ifdef TRACE
+
+#include <time.h>
+
+inline long long trace_clock()  // nanoseconds
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+//
+// Records an event of category `cat' from `start' to `end'.  The strings
+// must live until trace_write: string literals or symbol names.
+//
+void trace_event(const char *cat, const char *name, long long start,
+                 long long end);
+
+//
+// Records the event `name' from construction to destruction, if --trace
+// was given.
+//
+class TraceScope {
+private:
+  const char *cat;
+  const char *name;
+  long long start;              // -1 if not tracing
+public:
+  TraceScope(const char *c, const char *n)
+    : cat(c), name(n), start(trace_filename ? trace_clock() : -1) { }
+  ~TraceScope() {
+    if (start >= 0)
+      trace_event(cat, name, start, trace_clock());
+  }
+};
+
+#define TRACE_JOIN2(a, b) a##b
+#define TRACE_JOIN(a, b) TRACE_JOIN2(a, b)
+#define TRACE_SCOPE(cat, name) \
+  TraceScope TRACE_JOIN(trace_scope_, __LINE__)(cat, name)
+
+//
+// Writes the events of all threads to trace_filename; does nothing
+// without --trace.
+//
+void trace_write();
+
+#else
+
+#define TRACE_SCOPE(cat, name)
+inline void trace_write() { }
+
+#endif
+
+#endif
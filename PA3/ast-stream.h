@@ -0,0 +1,166 @@
+// -*-Mode: C++;-*-
+//
+// See copyright.h for copyright notice and limitation of liability
+// and disclaimer of warranty provisions.
+//
+#include "copyright.h"
+
+#ifndef _AST_STREAM_H_
+#define _AST_STREAM_H_
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  ast-stream.h
+//
+//  A compact binary encoding of the abstract syntax tree passed from the
+//  parser to semant and from semant to cgen.  It replaces the text
+//  written by dump_with_types when the phases are run with -b, so the
+//  next phase does not have to re-parse formatted text with ast-lex.cc
+//  and ast-parse.cc.
+//
+//  Layout (all integers are unsigned LEB128 varints):
+//
+//     magic       4 bytes, "\0CAS"; no text AST starts with \0
+//     version     AST_STREAM_VERSION
+//     symbols     count, then for every entry:
+//                    kind (one byte, an AstSymbolKind), length, bytes
+//                    and a terminating \0
+//     classes     count, then for every class the offset of its record
+//                 from the start of the node section
+//     nodes       the tree in pre-order, starting with the program.
+//                 Every node is
+//                    tag (one byte, an AstNodeTag)
+//                    line delta from the previous node (zigzag encoded)
+//                 followed by its fields in the order dump_with_types
+//                 prints them:
+//                    Symbol: index into the symbol section
+//                    list: number of elements, then the elements
+//                    node: the node, recursively
+//                 and, for expressions only, 0 if the type is not set,
+//                 else one plus the index of the type in the symbol
+//                 section.  A Boolean constant is the varint 0 or 1,
+//                 not a symbol.  The line delta of a class is taken
+//                 from 0, not from the node before it.
+//
+//  Each distinct symbol is written once.  The symbols are \0-terminated
+//  so the reader can enter them in the string tables straight from its
+//  input buffer; it builds the nodes with the constructors of
+//  cool-tree.h while walking the buffer once.
+//
+//  The class index lets a reader decode the classes one at a time and in
+//  any order: cgen maps the file and decodes the features of a class
+//  only when it is about to code it (see AstStreamReader::read_classes).
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <string>
+#include <vector>
+#include <map>
+#include "cool-io.h"
+#include "cool-tree.h"
+#include "stringtab.h"
+
+#define AST_STREAM_MAGIC    "\0CAS"
+#define AST_STREAM_VERSION  2
+
+enum AstSymbolKind { AS_ID, AS_INT, AS_STR };
+
+enum AstNodeTag {
+  AST_PROGRAM = 1, AST_CLASS, AST_METHOD, AST_ATTR, AST_FORMAL, AST_BRANCH,
+  AST_BINDING, AST_ASSIGN, AST_STATIC_DISPATCH, AST_DISPATCH, AST_COND,
+  AST_LOOP, AST_TYPCASE, AST_BLOCK, AST_LET, AST_PLUS, AST_SUB, AST_MUL,
+  AST_DIVIDE, AST_NEG, AST_LT, AST_EQ, AST_LEQ, AST_COMP, AST_INT_CONST,
+  AST_BOOL_CONST, AST_STRING_CONST, AST_NEW, AST_ISVOID, AST_NO_EXPR,
+  AST_OBJECT
+};
+
+//
+// AstStreamWriter collects the encoded nodes handed to it by the
+// write_binary methods of the tree and writes the whole stream, symbol
+// section first, when flush is called.
+//
+class AstStreamWriter {
+private:
+  std::vector<std::pair<char,Symbol> > symbols;   // in index order
+  std::map<Symbol, int> symbol_index;
+  std::string nodes;                      // encoded node section
+  std::vector<size_t> class_offsets;      // of each class in `nodes'
+  int last_line;
+
+  static void put_varint(std::string& out, unsigned int v);
+  int intern(AstSymbolKind kind, Symbol s);
+public:
+  AstStreamWriter() : last_line(0) { }
+  void begin_class();
+  void put_node(AstNodeTag tag, int lineno);
+  void put_type(Symbol type);
+  void put_id(Symbol s)   { put_varint(nodes, intern(AS_ID, s)); }
+  void put_int(Symbol s)  { put_varint(nodes, intern(AS_INT, s)); }
+  void put_int(int n)     { put_varint(nodes, n); }
+  void put_str(Symbol s)  { put_varint(nodes, intern(AS_STR, s)); }
+  void put_length(int n)  { put_varint(nodes, n); }
+  void flush(ostream& out);
+};
+
+//
+// AstStreamReader decodes a stream loaded into memory back into a tree,
+// either all at once (read) or a class at a time (read_classes and
+// read_features).  Malformed input stops the compiler with fatal_error.
+//
+class AstStreamReader {
+private:
+  const char *pos;
+  const char *end;
+  const char *nodes;                      // start of the node section
+  std::vector<Symbol> symbols;
+  std::vector<size_t> class_offsets;
+  int line;
+  int program_line;
+  bool tracking;                          // keep what is made in `made'
+  std::vector<tree_node *> made;          // for release
+
+  unsigned int get_varint();
+  int get_byte();
+  Symbol get_symbol();
+  int get_tag();
+
+  template <class T> T at_line(T node, int lineno);
+  template <class T> T keep(T node);
+
+  Class_ read_class();
+  Features read_features();
+  Feature read_feature();
+  Formal read_formal();
+  Case read_case();
+  Binding read_binding();
+  Expression read_expression();
+  Expressions read_expressions();
+public:
+  AstStreamReader()
+    : pos(NULL), end(NULL), nodes(NULL), line(0), program_line(0),
+      tracking(false) { }
+  void open(const char *buf, size_t len);
+  Program read();
+  Program read_classes();
+  Features read_features(int i);
+  void release();
+};
+
+//
+// Returns true if the stream in `f' starts with the binary magic.
+// Only one character is consumed and it is pushed back.
+//
+bool ast_stream_is_binary(FILE *f);
+
+//
+// Returns the rest of `f' in memory, mapped if `f' is a regular file.
+//
+const char *ast_stream_map(FILE *f, size_t *len);
+
+//
+// Reads a whole binary AST from `f'.
+//
+Program ast_stream_read(FILE *f);
+
+#endif
@@ -1,8 +1,8 @@
-/* A Bison parser, made by GNU Bison 3.3.2.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison implementation for Yacc-like parsers in C
 
-   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2019 Free Software Foundation,
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
    Inc.
 
    This program is free software: you can redistribute it and/or modify
@@ -16,7 +16,7 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -34,6 +34,10 @@
 /* C LALR(1) parser skeleton written by Richard Stallman, by
    simplifying the original so-called "semantic" parser.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
 /* All symbols defined below should begin with yy or YY, to avoid
    infringing on user name space.  This should be done even for local
    variables, as they might otherwise be expanded by user macros.
@@ -41,23 +45,20 @@
    define necessary library symbols; they are noted "INFRINGES ON
    USER NAME SPACE" below.  */
 
-/* Undocumented macros, especially those whose name start with YY_,
-   are private implementation details.  Do not rely on them.  */
-
-/* Identify Bison output.  */
-#define YYBISON 1
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
 
-/* Bison version.  */
-#define YYBISON_VERSION "3.3.2"
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
 
 /* Skeleton name.  */
 #define YYSKELETON_NAME "yacc.c"
 
 /* Pure parsers.  */
-#define YYPURE 0
+#define YYPURE 2
 
 /* Push parsers.  */
-#define YYPUSH 0
+#define YYPUSH 1
 
 /* Pull parsers.  */
 #define YYPULL 1
@@ -65,22 +66,30 @@
 
 /* Substitute the variable and function names.  */
 #define yyparse         cool_yyparse
+#define yypush_parse    cool_yypush_parse
+#define yypull_parse    cool_yypull_parse
+#define yypstate_new    cool_yypstate_new
+#define yypstate_clear  cool_yypstate_clear
+#define yypstate_delete cool_yypstate_delete
+#define yypstate        cool_yypstate
 #define yylex           cool_yylex
 #define yyerror         cool_yyerror
 #define yydebug         cool_yydebug
 #define yynerrs         cool_yynerrs
 
-#define yylval          cool_yylval
-#define yychar          cool_yychar
-#define yylloc          cool_yylloc
-
 /* First part of user prologue.  */
-#line 6 "cool.y" /* yacc.c:337  */
+#line 6 "cool.y"
 
   #include <iostream>
+  #include <sstream>
+  #include <string>
+  #include <vector>
   #include "cool-tree.h"
   #include "stringtab.h"
   #include "utilities.h"
+  #include "token-queue.h"
+  #include "parser-context.h"
+  #include "trace.h"
   
   extern char *curr_filename;
   //#define IN_DEBUG
@@ -94,9 +103,10 @@
   #define cool_yylloc curr_lineno  /* use the curr_lineno from the lexer
   for the location of tokens */
     
-    extern int node_lineno;          /* set before constructing a tree node
+    extern thread_local int node_lineno; /* set before constructing a tree node
     to whatever you want the line number
-    for the tree node to be */
+    for the tree node to be; one per thread,
+    see cool_yyparse_files */
       
       
       #define YYLLOC_DEFAULT(Current, Rhs, N)         \
@@ -151,18 +161,31 @@
     
     
     
-    void yyerror(char *s);        /*  defined below; called for each parse error */
+    void yyerror(YYLTYPE *loc, ParserContext *ctx, char *s); /* defined below; called for each parse error */
     extern int yylex();           /*  the entry point to the lexer  */
     
-    /************************************************************************/
-    /*                DONT CHANGE ANYTHING IN THIS SECTION                  */
+    /* The parser pulls its tokens through cool_token_source.  It is the
+    text token scanner unless parser-phase.cc finds a binary token stream
+    on its input (see token-stream.h). */
+    int (*cool_token_source)() = yylex;
+    #undef yylex
     
-    Program ast_root;	      /* the result of the parse  */
-    Classes parse_results;        /* for use in semantic analysis */
-    int omerrs = 0;               /* number of errors in lexing and parsing */
+    /* The result of the parse and the number of errors, which used to be
+    the globals ast_root, parse_results and omerrs, are kept in the
+    ParserContext (parser-context.h) passed to the parser. */
     
 
-#line 166 "cool.tab.c" /* yacc.c:337  */
+#line 179 "cool.tab.c"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
 # ifndef YY_NULLPTR
 #  if defined __cplusplus
 #   if 201103L <= __cplusplus
@@ -175,167 +198,186 @@
 #  endif
 # endif
 
-/* Enabling verbose error messages.  */
-#ifdef YYERROR_VERBOSE
-# undef YYERROR_VERBOSE
-# define YYERROR_VERBOSE 1
-#else
-# define YYERROR_VERBOSE 0
-#endif
-
-/* In a future release of Bison, this section will be replaced
-   by #include "cool.tab.h".  */
-#ifndef YY_COOL_YY_COOL_TAB_H_INCLUDED
-# define YY_COOL_YY_COOL_TAB_H_INCLUDED
-/* Debug traces.  */
-#ifndef YYDEBUG
-# define YYDEBUG 1
-#endif
-#if YYDEBUG
-extern int cool_yydebug;
-#endif
-
-/* Token type.  */
-#ifndef YYTOKENTYPE
-# define YYTOKENTYPE
-  enum yytokentype
-  {
-    CLASS = 258,
-    ELSE = 259,
-    FI = 260,
-    IF = 261,
-    IN = 262,
-    INHERITS = 263,
-    LET = 264,
-    LOOP = 265,
-    POOL = 266,
-    THEN = 267,
-    WHILE = 268,
-    CASE = 269,
-    ESAC = 270,
-    OF = 271,
-    DARROW = 272,
-    NEW = 273,
-    ISVOID = 274,
-    STR_CONST = 275,
-    INT_CONST = 276,
-    BOOL_CONST = 277,
-    TYPEID = 278,
-    OBJECTID = 279,
-    ASSIGN = 280,
-    NOT = 281,
-    LE = 282,
-    ERROR = 283
-  };
-#endif
-/* Tokens.  */
-#define CLASS 258
-#define ELSE 259
-#define FI 260
-#define IF 261
-#define IN 262
-#define INHERITS 263
-#define LET 264
-#define LOOP 265
-#define POOL 266
-#define THEN 267
-#define WHILE 268
-#define CASE 269
-#define ESAC 270
-#define OF 271
-#define DARROW 272
-#define NEW 273
-#define ISVOID 274
-#define STR_CONST 275
-#define INT_CONST 276
-#define BOOL_CONST 277
-#define TYPEID 278
-#define OBJECTID 279
-#define ASSIGN 280
-#define NOT 281
-#define LE 282
-#define ERROR 283
-
-/* Value type.  */
-#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-
-union YYSTYPE
+#include "cool.tab.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
 {
-#line 93 "cool.y" /* yacc.c:352  */
-
-      Boolean boolean;
-      Symbol symbol;
-      Program program;
-      Class_ class_;
-      Classes classes;
-      Feature feature;
-      Features features;
-      Formal formal;
-      Formals formals;
-      Case case_;
-      Cases cases;
-      Expression expression;
-      Expressions expressions;
-      char *error_msg;
-    
-
-#line 283 "cool.tab.c" /* yacc.c:352  */
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_CLASS = 3,                      /* CLASS  */
+  YYSYMBOL_ELSE = 4,                       /* ELSE  */
+  YYSYMBOL_FI = 5,                         /* FI  */
+  YYSYMBOL_IF = 6,                         /* IF  */
+  YYSYMBOL_IN = 7,                         /* IN  */
+  YYSYMBOL_INHERITS = 8,                   /* INHERITS  */
+  YYSYMBOL_LET = 9,                        /* LET  */
+  YYSYMBOL_LOOP = 10,                      /* LOOP  */
+  YYSYMBOL_POOL = 11,                      /* POOL  */
+  YYSYMBOL_THEN = 12,                      /* THEN  */
+  YYSYMBOL_WHILE = 13,                     /* WHILE  */
+  YYSYMBOL_CASE = 14,                      /* CASE  */
+  YYSYMBOL_ESAC = 15,                      /* ESAC  */
+  YYSYMBOL_OF = 16,                        /* OF  */
+  YYSYMBOL_DARROW = 17,                    /* DARROW  */
+  YYSYMBOL_NEW = 18,                       /* NEW  */
+  YYSYMBOL_ISVOID = 19,                    /* ISVOID  */
+  YYSYMBOL_STR_CONST = 20,                 /* STR_CONST  */
+  YYSYMBOL_INT_CONST = 21,                 /* INT_CONST  */
+  YYSYMBOL_BOOL_CONST = 22,                /* BOOL_CONST  */
+  YYSYMBOL_TYPEID = 23,                    /* TYPEID  */
+  YYSYMBOL_OBJECTID = 24,                  /* OBJECTID  */
+  YYSYMBOL_ASSIGN = 25,                    /* ASSIGN  */
+  YYSYMBOL_NOT = 26,                       /* NOT  */
+  YYSYMBOL_LE = 27,                        /* LE  */
+  YYSYMBOL_ERROR = 28,                     /* ERROR  */
+  YYSYMBOL_29_ = 29,                       /* '<'  */
+  YYSYMBOL_30_ = 30,                       /* '='  */
+  YYSYMBOL_31_ = 31,                       /* '+'  */
+  YYSYMBOL_32_ = 32,                       /* '-'  */
+  YYSYMBOL_33_ = 33,                       /* '*'  */
+  YYSYMBOL_34_ = 34,                       /* '/'  */
+  YYSYMBOL_35_ = 35,                       /* '~'  */
+  YYSYMBOL_36_ = 36,                       /* '{'  */
+  YYSYMBOL_37_ = 37,                       /* '}'  */
+  YYSYMBOL_38_ = 38,                       /* ';'  */
+  YYSYMBOL_39_ = 39,                       /* '('  */
+  YYSYMBOL_40_ = 40,                       /* ')'  */
+  YYSYMBOL_41_ = 41,                       /* ':'  */
+  YYSYMBOL_42_ = 42,                       /* ','  */
+  YYSYMBOL_43_ = 43,                       /* '.'  */
+  YYSYMBOL_44_ = 44,                       /* '@'  */
+  YYSYMBOL_YYACCEPT = 45,                  /* $accept  */
+  YYSYMBOL_program = 46,                   /* program  */
+  YYSYMBOL_class_list = 47,                /* class_list  */
+  YYSYMBOL_class = 48,                     /* class  */
+  YYSYMBOL_feature_list = 49,              /* feature_list  */
+  YYSYMBOL_feature = 50,                   /* feature  */
+  YYSYMBOL_formal_list = 51,               /* formal_list  */
+  YYSYMBOL_formal_items = 52,              /* formal_items  */
+  YYSYMBOL_formal = 53,                    /* formal  */
+  YYSYMBOL_expression_list = 54,           /* expression_list  */
+  YYSYMBOL_expression_list_as_args = 55,   /* expression_list_as_args  */
+  YYSYMBOL_let_binding_list = 56,          /* let_binding_list  */
+  YYSYMBOL_let_binding = 57,               /* let_binding  */
+  YYSYMBOL_case_expression = 58,           /* case_expression  */
+  YYSYMBOL_case_instance_list = 59,        /* case_instance_list  */
+  YYSYMBOL_case_instance = 60,             /* case_instance  */
+  YYSYMBOL_expression = 61,                /* expression  */
+  YYSYMBOL_block_expression = 62           /* block_expression  */
 };
+typedef enum yysymbol_kind_t yysymbol_kind_t;
 
-typedef union YYSTYPE YYSTYPE;
-# define YYSTYPE_IS_TRIVIAL 1
-# define YYSTYPE_IS_DECLARED 1
-#endif
 
-/* Location type.  */
-#if ! defined YYLTYPE && ! defined YYLTYPE_IS_DECLARED
-typedef struct YYLTYPE YYLTYPE;
-struct YYLTYPE
-{
-  int first_line;
-  int first_column;
-  int last_line;
-  int last_column;
-};
-# define YYLTYPE_IS_DECLARED 1
-# define YYLTYPE_IS_TRIVIAL 1
-#endif
-
-
-extern YYSTYPE cool_yylval;
-extern YYLTYPE cool_yylloc;
-int cool_yyparse (void);
 
-#endif /* !YY_COOL_YY_COOL_TAB_H_INCLUDED  */
+/* Unqualified %code blocks.  */
+#line 139 "cool.y"
 
+      YYSTYPE cool_yylval;          /* value of the token last scanned */
+      int curr_lineno;              /* and its line; the impure parser got
+      this from cool_yylloc */
+      
+      static Symbol Object_symbol;  /* entered by init_parse_symbols */
+      static Symbol self_symbol;
+      
+      static void init_parse_symbols();
+      static int cool_next_token(YYSTYPE *lvalp, YYLTYPE *llocp,
+      ParserContext *ctx);
+      #define yylex cool_next_token
+      #define MAX_PARSE_ERRORS 50   /* give up after this many */
+      
+      /* utilities.cc */
+      extern void print_cool_token(ostream& out, int tok, YYSTYPE yylval);
+    
 
+#line 295 "cool.tab.c"
 
 #ifdef short
 # undef short
 #endif
 
-#ifdef YYTYPE_UINT8
-typedef YYTYPE_UINT8 yytype_uint8;
-#else
-typedef unsigned char yytype_uint8;
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
 #endif
 
-#ifdef YYTYPE_INT8
-typedef YYTYPE_INT8 yytype_int8;
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
 #else
 typedef signed char yytype_int8;
 #endif
 
-#ifdef YYTYPE_UINT16
-typedef YYTYPE_UINT16 yytype_uint16;
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
 #else
-typedef unsigned short yytype_uint16;
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
+#else
+typedef short yytype_uint8;
 #endif
 
-#ifdef YYTYPE_INT16
-typedef YYTYPE_INT16 yytype_int16;
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
 #else
-typedef short yytype_int16;
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
 #endif
 
 #ifndef YYSIZE_T
@@ -343,7 +385,7 @@ typedef short yytype_int16;
 #  define YYSIZE_T __SIZE_TYPE__
 # elif defined size_t
 #  define YYSIZE_T size_t
-# elif ! defined YYSIZE_T
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
 #  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
 #  define YYSIZE_T size_t
 # else
@@ -351,7 +393,20 @@ typedef short yytype_int16;
 # endif
 #endif
 
-#define YYSIZE_MAXIMUM ((YYSIZE_T) -1)
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_uint8 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
 
 #ifndef YY_
 # if defined YYENABLE_NLS && YYENABLE_NLS
@@ -365,38 +420,43 @@ typedef short yytype_int16;
 # endif
 #endif
 
-#ifndef YY_ATTRIBUTE
-# if (defined __GNUC__                                               \
-      && (2 < __GNUC__ || (__GNUC__ == 2 && 96 <= __GNUC_MINOR__)))  \
-     || defined __SUNPRO_C && 0x5110 <= __SUNPRO_C
-#  define YY_ATTRIBUTE(Spec) __attribute__(Spec)
-# else
-#  define YY_ATTRIBUTE(Spec) /* empty */
-# endif
-#endif
 
 #ifndef YY_ATTRIBUTE_PURE
-# define YY_ATTRIBUTE_PURE   YY_ATTRIBUTE ((__pure__))
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
 #endif
 
 #ifndef YY_ATTRIBUTE_UNUSED
-# define YY_ATTRIBUTE_UNUSED YY_ATTRIBUTE ((__unused__))
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
 #endif
 
 /* Suppress unused-variable warnings by "using" E.  */
 #if ! defined lint || defined __GNUC__
-# define YYUSE(E) ((void) (E))
+# define YY_USE(E) ((void) (E))
 #else
-# define YYUSE(E) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
-#if defined __GNUC__ && ! defined __ICC && 407 <= __GNUC__ * 100 + __GNUC_MINOR__
 /* Suppress an incorrect diagnostic about yylval being uninitialized.  */
-# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN \
-    _Pragma ("GCC diagnostic push") \
-    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")\
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
     _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
-# define YY_IGNORE_MAYBE_UNINITIALIZED_END \
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
     _Pragma ("GCC diagnostic pop")
 #else
 # define YY_INITIAL_VALUE(Value) Value
@@ -409,34 +469,24 @@ typedef short yytype_int16;
 # define YY_INITIAL_VALUE(Value) /* Nothing. */
 #endif
 
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
 
-#if ! defined yyoverflow || YYERROR_VERBOSE
 
-/* The parser invokes alloca or malloc; define the necessary symbols.  */
+#define YY_ASSERT(E) ((void) (0 && (E)))
 
-# ifdef YYSTACK_USE_ALLOCA
-#  if YYSTACK_USE_ALLOCA
-#   ifdef __GNUC__
-#    define YYSTACK_ALLOC __builtin_alloca
-#   elif defined __BUILTIN_VA_ARG_INCR
-#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
-#   elif defined _AIX
-#    define YYSTACK_ALLOC __alloca
-#   elif defined _MSC_VER
-#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
-#    define alloca _alloca
-#   else
-#    define YYSTACK_ALLOC alloca
-#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
-#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
-      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
-#     ifndef EXIT_SUCCESS
-#      define EXIT_SUCCESS 0
-#     endif
-#    endif
-#   endif
-#  endif
-# endif
+#if !defined yyoverflow
+
+/* The parser invokes alloca or malloc; define the necessary symbols.  */
 
 # ifdef YYSTACK_ALLOC
    /* Pacify GCC's 'empty if-body' warning.  */
@@ -475,8 +525,7 @@ void free (void *); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 # endif
-#endif /* ! defined yyoverflow || YYERROR_VERBOSE */
-
+#endif /* !defined yyoverflow */
 
 #if (! defined yyoverflow \
      && (! defined __cplusplus \
@@ -486,18 +535,19 @@ void free (void *); /* INFRINGES ON USER NAME SPACE */
 /* A type that is properly aligned for any stack member.  */
 union yyalloc
 {
-  yytype_int16 yyss_alloc;
+  yy_state_t yyss_alloc;
   YYSTYPE yyvs_alloc;
   YYLTYPE yyls_alloc;
 };
 
 /* The size of the maximum gap between one aligned stack and the next.  */
-# define YYSTACK_GAP_MAXIMUM (sizeof (union yyalloc) - 1)
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
 
 /* The size of an array large to enough to hold all stacks, each with
    N elements.  */
 # define YYSTACK_BYTES(N) \
-     ((N) * (sizeof (yytype_int16) + sizeof (YYSTYPE) + sizeof (YYLTYPE)) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE) \
+             + YYSIZEOF (YYLTYPE)) \
       + 2 * YYSTACK_GAP_MAXIMUM)
 
 # define YYCOPY_NEEDED 1
@@ -510,11 +560,11 @@ union yyalloc
 # define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
     do                                                                  \
       {                                                                 \
-        YYSIZE_T yynewbytes;                                            \
+        YYPTRDIFF_T yynewbytes;                                         \
         YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
         Stack = &yyptr->Stack_alloc;                                    \
-        yynewbytes = yystacksize * sizeof (*Stack) + YYSTACK_GAP_MAXIMUM; \
-        yyptr += yynewbytes / sizeof (*yyptr);                          \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
       }                                                                 \
     while (0)
 
@@ -526,12 +576,12 @@ union yyalloc
 # ifndef YYCOPY
 #  if defined __GNUC__ && 1 < __GNUC__
 #   define YYCOPY(Dst, Src, Count) \
-      __builtin_memcpy (Dst, Src, (Count) * sizeof (*(Src)))
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
 #  else
 #   define YYCOPY(Dst, Src, Count)              \
       do                                        \
         {                                       \
-          YYSIZE_T yyi;                         \
+          YYPTRDIFF_T yyi;                      \
           for (yyi = 0; yyi < (Count); yyi++)   \
             (Dst)[yyi] = (Src)[yyi];            \
         }                                       \
@@ -543,28 +593,31 @@ union yyalloc
 /* YYFINAL -- State number of the termination state.  */
 #define YYFINAL  7
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   425
+#define YYLAST   399
 
 /* YYNTOKENS -- Number of terminals.  */
 #define YYNTOKENS  45
 /* YYNNTS -- Number of nonterminals.  */
-#define YYNNTS  16
+#define YYNNTS  18
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  63
+#define YYNRULES  66
 /* YYNSTATES -- Number of states.  */
-#define YYNSTATES  153
+#define YYNSTATES  155
 
-#define YYUNDEFTOK  2
+/* YYMAXUTOK -- Last valid token kind.  */
 #define YYMAXUTOK   284
 
+
 /* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
    as returned by yylex, with out-of-bounds checking.  */
-#define YYTRANSLATE(YYX)                                                \
-  ((unsigned) (YYX) <= YYMAXUTOK ? yytranslate[YYX] : YYUNDEFTOK)
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
 
 /* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
    as returned by yylex.  */
-static const yytype_uint8 yytranslate[] =
+static const yytype_int8 yytranslate[] =
 {
        0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -598,270 +651,266 @@ static const yytype_uint8 yytranslate[] =
 };
 
 #if YYDEBUG
-  /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
-static const yytype_uint16 yyrline[] =
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
 {
-       0,   166,   166,   169,   172,   178,   181,   183,   186,   189,
-     193,   195,   200,   202,   204,   206,   211,   212,   214,   218,
-     222,   224,   226,   230,   232,   236,   238,   240,   242,   244,
-     248,   252,   254,   257,   259,   263,   265,   267,   269,   271,
-     273,   275,   277,   279,   281,   283,   285,   287,   289,   291,
-     293,   295,   297,   299,   301,   303,   305,   307,   309,   311,
-     313,   315,   317,   321
+       0,   215,   215,   222,   224,   229,   231,   233,   235,   237,
+     241,   243,   248,   250,   252,   254,   260,   261,   263,   267,
+     269,   273,   277,   279,   281,   284,   289,   291,   299,   301,
+     305,   307,   309,   314,   318,   320,   324,   326,   330,   332,
+     334,   336,   338,   340,   342,   344,   346,   348,   350,   352,
+     354,   356,   358,   360,   362,   364,   366,   368,   370,   372,
+     374,   376,   378,   380,   382,   384,   388
 };
 #endif
 
-#if YYDEBUG || YYERROR_VERBOSE || 0
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
 /* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
    First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
 static const char *const yytname[] =
 {
-  "$end", "error", "$undefined", "CLASS", "ELSE", "FI", "IF", "IN",
-  "INHERITS", "LET", "LOOP", "POOL", "THEN", "WHILE", "CASE", "ESAC", "OF",
-  "DARROW", "NEW", "ISVOID", "STR_CONST", "INT_CONST", "BOOL_CONST",
-  "TYPEID", "OBJECTID", "ASSIGN", "NOT", "LE", "ERROR", "'<'", "'='",
-  "'+'", "'-'", "'*'", "'/'", "'~'", "'{'", "'}'", "';'", "'('", "')'",
-  "':'", "','", "'.'", "'@'", "$accept", "program", "class_list", "class",
-  "feature_list", "feature", "formal_list", "formal", "expression_list",
-  "expression_list_as_args", "let_init_list", "case_expression",
+  "\"end of file\"", "error", "\"invalid token\"", "CLASS", "ELSE", "FI",
+  "IF", "IN", "INHERITS", "LET", "LOOP", "POOL", "THEN", "WHILE", "CASE",
+  "ESAC", "OF", "DARROW", "NEW", "ISVOID", "STR_CONST", "INT_CONST",
+  "BOOL_CONST", "TYPEID", "OBJECTID", "ASSIGN", "NOT", "LE", "ERROR",
+  "'<'", "'='", "'+'", "'-'", "'*'", "'/'", "'~'", "'{'", "'}'", "';'",
+  "'('", "')'", "':'", "','", "'.'", "'@'", "$accept", "program",
+  "class_list", "class", "feature_list", "feature", "formal_list",
+  "formal_items", "formal", "expression_list", "expression_list_as_args",
+  "let_binding_list", "let_binding", "case_expression",
   "case_instance_list", "case_instance", "expression", "block_expression", YY_NULLPTR
 };
-#endif
 
-# ifdef YYPRINT
-/* YYTOKNUM[NUM] -- (External) token number corresponding to the
-   (internal) symbol number NUM (which must be that of a token).  */
-static const yytype_uint16 yytoknum[] =
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
 {
-       0,   256,   284,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280,   281,   282,   283,    60,
-      61,    43,    45,    42,    47,   126,   123,   125,    59,    40,
-      41,    58,    44,    46,    64
-};
-# endif
+  return yytname[yysymbol];
+}
+#endif
 
-#define YYPACT_NINF -108
+#define YYPACT_NINF (-63)
 
-#define yypact_value_is_default(Yystate) \
-  (!!((Yystate) == (-108)))
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
 
-#define YYTABLE_NINF -32
+#define YYTABLE_NINF (-67)
 
-#define yytable_value_is_error(Yytable_value) \
-  (!!((Yytable_value) == (-32)))
+#define yytable_value_is_error(Yyn) \
+  ((Yyn) == YYTABLE_NINF)
 
-  /* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
-     STATE-NUM.  */
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
 static const yytype_int16 yypact[] =
 {
-      30,  -108,   -10,    24,    70,  -108,    14,  -108,  -108,    34,
-       1,    18,  -108,    12,    23,    35,    36,    10,    55,    75,
-    -108,    64,    31,    65,    68,    72,    66,    67,    89,  -108,
-    -108,  -108,    77,   100,    80,    55,   250,  -108,  -108,   102,
-    -108,   250,     3,   250,   250,   103,   250,  -108,  -108,  -108,
-     -11,   250,   250,   130,   250,  -108,   373,    91,   272,     3,
-      87,  -108,   128,   293,  -108,    49,   250,   178,   373,    49,
-      92,  -108,   301,    95,   319,   250,   250,   250,   250,   250,
-     250,   250,   105,   117,   250,   250,  -108,   118,   250,    22,
-     373,  -108,   106,   337,   130,    98,  -108,  -108,   381,   381,
-     381,    57,    57,    49,    49,   108,    99,   355,    33,    -6,
-     264,   250,   104,   148,   126,  -108,   250,  -108,  -108,   202,
-     143,  -108,   250,   250,   250,     3,  -108,   373,   145,  -108,
-       5,  -108,  -108,   134,   131,    51,   373,   146,  -108,   164,
-    -108,  -108,   226,  -108,   250,     3,   250,  -108,   142,   373,
-    -108,   373,  -108
+      18,   -63,     4,    54,    67,   -63,    15,   -63,   -63,     7,
+       0,    21,   -63,    30,    26,     1,    37,     2,    71,    76,
+     -63,    72,    73,   -63,    77,    10,    82,    85,    75,   -63,
+     101,   -63,   -63,   -63,    89,   107,    90,    71,   224,   -63,
+     -63,   109,   -63,   224,     8,   224,   224,   117,   224,   -63,
+     -63,   -63,   -11,   224,   224,   115,   224,   -63,   347,   102,
+     246,     8,   103,     6,   -63,   185,   267,   -63,    70,   224,
+     139,   347,    70,   104,    83,   275,   106,   293,   224,   224,
+     224,   224,   224,   224,   224,   122,   124,   224,   224,   -63,
+     126,   224,     8,   224,    64,   347,   -63,    43,   347,   -63,
+     118,   311,   -63,   -63,   -63,   355,   355,   355,   191,   191,
+      70,    70,   116,   119,   329,    29,   141,   347,   -63,   238,
+     224,   123,     5,   129,   -63,   224,   -63,   -63,   163,   144,
+     -63,   224,   224,   -63,   347,   147,   -63,   133,   -63,   347,
+     -63,    58,   134,    47,   347,   169,   -63,   -63,   187,   -63,
+     224,   -63,    66,   347,   -63
 };
 
-  /* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
-     Performed when YYTABLE does not specify something else to do.  Zero
-     means the default is an error.  */
-static const yytype_uint8 yydefact[] =
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int8 yydefact[] =
 {
        0,     9,     0,     0,     0,     3,     0,     1,     4,     0,
        0,     0,    15,     0,     0,     0,     0,     0,    16,     0,
-       7,     0,     0,     0,     0,     0,     0,    17,    13,     5,
-      11,     8,     0,     0,     0,    16,     0,     6,    19,     0,
-      18,     0,     0,     0,     0,     0,     0,    38,    36,    37,
-      45,     0,     0,     0,     0,    48,    14,     0,     0,     0,
-       0,    39,     0,     0,    52,    53,     0,     0,    61,    58,
-       0,    63,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,    29,     0,     0,     0,
-      40,    46,     0,    23,     0,     0,    49,    35,    60,    59,
-      62,    54,    55,    56,    57,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,    47,     0,    22,    21,     0,
-       0,    12,     0,     0,     0,     0,    51,    34,     0,    30,
-       0,    24,    41,     0,     0,     0,    25,     0,    26,     0,
-      32,    42,     0,    50,     0,     0,     0,    43,     0,    27,
-      28,    33,    44
+       7,     0,     0,    10,     0,     0,     0,     0,    17,    19,
+      13,     5,    11,     8,     0,     0,     0,    18,     0,     6,
+      21,     0,    20,     0,     0,     0,     0,     0,     0,    41,
+      39,    40,    48,     0,     0,     0,     0,    51,    14,     0,
+       0,     0,     0,     0,    28,     0,     0,    55,    56,     0,
+       0,    64,    61,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    32,
+       0,     0,     0,     0,     0,    43,    49,     0,    26,    24,
+       0,     0,    22,    52,    38,    63,    62,    65,    57,    58,
+      59,    60,     0,     0,     0,     0,    30,    42,    29,     0,
+       0,     0,     0,     0,    50,     0,    25,    23,     0,     0,
+      12,     0,     0,    54,    37,     0,    33,     0,    34,    27,
+      44,     0,     0,     0,    31,     0,    35,    45,     0,    53,
+       0,    46,     0,    36,    47
 };
 
-  /* YYPGOTO[NTERM-NUM].  */
+/* YYPGOTO[NTERM-NUM].  */
 static const yytype_int16 yypgoto[] =
 {
-    -108,  -108,  -108,   179,     4,  -108,   150,  -108,     2,  -107,
-     -56,  -108,    56,  -108,   -36,  -108
+     -63,   -63,   -63,   176,   171,    -3,   -63,   -63,   153,   -63,
+     -62,   -63,   -57,   -63,   -63,    69,   -38,   -63
 };
 
-  /* YYDEFGOTO[NTERM-NUM].  */
+/* YYDEFGOTO[NTERM-NUM].  */
 static const yytype_int8 yydefgoto[] =
 {
-      -1,     3,     4,     5,    15,    16,    26,    27,    71,    92,
-      61,    55,   113,   114,    93,    73
+       0,     3,     4,     5,    15,    16,    27,    28,    29,    74,
+      97,    63,    64,    57,   122,   123,    98,    76
 };
 
-  /* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
-     positive, shift that token.  If negative, reduce the rule whose
-     number is the opposite.  If YYTABLE_NINF, syntax error.  */
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
 static const yytype_int16 yytable[] =
 {
-      56,   123,    12,    86,    59,    58,   111,    62,    63,   131,
-      65,    12,   133,     6,    66,    68,    69,    72,    74,   124,
-     -31,    24,     9,   111,     7,    13,    30,    60,    67,   112,
-      90,     1,    12,     2,    13,   148,   125,   122,    14,    98,
-      99,   100,   101,   102,   103,   104,   112,    23,   107,   108,
-      10,    18,   110,    19,    17,    13,   143,    11,    72,    72,
-      75,    20,    76,    77,    78,    79,    80,    81,   -10,   138,
-      -2,     1,    21,     2,    22,   127,    82,    83,    75,    25,
-      76,    77,    78,    79,    80,    81,   135,   136,   137,   150,
-      80,    81,    82,    83,    82,    83,   117,   118,    28,    70,
-      82,    83,    29,    31,    41,    32,    34,    42,   149,    35,
-     151,    43,    44,    33,    36,    37,    45,    46,    47,    48,
-      49,    39,    50,    38,    51,    57,    64,    84,    87,   105,
-      94,    70,    96,    52,    53,   -20,    41,    54,    88,    42,
-     106,   109,   120,    43,    44,   128,   115,   119,    45,    46,
-      47,    48,    49,   144,    50,    75,    51,    76,    77,    78,
-      79,    80,    81,   129,   130,    52,    53,   134,   139,    54,
-     142,    82,    83,    75,   141,    76,    77,    78,    79,    80,
-      81,   146,   152,     8,    41,    40,   140,    42,   145,    82,
-      83,    43,    44,     0,     0,     0,    45,    46,    47,    48,
-      49,     0,    50,     0,    51,     0,     0,     0,    41,     0,
-       0,    42,     0,    52,    53,    43,    44,    54,    91,     0,
-      45,    46,    47,    48,    49,     0,    50,     0,    51,     0,
-       0,     0,    41,     0,     0,    42,     0,    52,    53,    43,
-      44,    54,   132,     0,    45,    46,    47,    48,    49,     0,
-      50,     0,    51,     0,     0,     0,    41,     0,     0,    42,
-       0,    52,    53,    43,    44,    54,   147,     0,    45,    46,
-      47,    48,    49,     0,    50,   126,    51,     0,     0,     0,
-       0,     0,     0,     0,    85,    52,    53,     0,     0,    54,
-       0,    75,     0,    76,    77,    78,    79,    80,    81,    75,
-       0,    76,    77,    78,    79,    80,    81,    82,    83,    89,
-       0,     0,     0,     0,     0,    82,    83,     0,     0,     0,
-      75,     0,    76,    77,    78,    79,    80,    81,    75,     0,
-      76,    77,    78,    79,    80,    81,    82,    83,     0,    95,
-       0,     0,     0,     0,    82,    83,    75,     0,    76,    77,
-      78,    79,    80,    81,     0,     0,     0,     0,     0,    97,
-       0,     0,    82,    83,    75,     0,    76,    77,    78,    79,
-      80,    81,     0,     0,     0,     0,     0,     0,     0,   116,
-      82,    83,    75,     0,    76,    77,    78,    79,    80,    81,
-       0,     0,   121,     0,     0,     0,     0,     0,    82,    83,
-      75,     0,    76,    77,    78,    79,    80,    81,   -32,     0,
-     -32,   -32,    78,    79,    80,    81,    82,    83,     0,     0,
-       0,     0,     0,     0,    82,    83
+      58,    12,    12,    12,    89,    60,   120,    65,    66,    61,
+      68,    12,    22,    91,    69,    71,    72,    75,    77,     1,
+     136,     2,    22,     9,    13,    13,    13,     6,    70,   121,
+      11,    95,    62,   131,    13,   118,   101,    14,    21,    24,
+     105,   106,   107,   108,   109,   110,   111,    34,    92,   114,
+     115,    10,   149,   117,     7,   119,    78,    17,    79,    80,
+      81,    82,    83,    84,    20,   120,   141,    -2,     1,    18,
+       2,    19,    85,    86,    78,    23,    79,    80,    81,    82,
+      83,    84,   134,   124,   100,   125,   152,   139,   121,    43,
+      85,    86,    44,   143,   144,    26,    45,    46,   147,    30,
+     125,    47,    48,    49,    50,    51,   154,    52,   125,    53,
+      31,    32,   153,    85,    86,    33,    73,    37,    54,    55,
+     -66,    43,    56,    35,    44,    36,    38,    39,    45,    46,
+      40,    41,    59,    47,    48,    49,    50,    51,    87,    52,
+      67,    53,    99,   103,    90,    43,   112,   113,    44,   116,
+      54,    55,    45,    46,    56,   128,   126,    47,    48,    49,
+      50,    51,   129,    52,   135,    53,   132,   138,   142,    43,
+     145,   146,    44,   148,    54,    55,    45,    46,    56,    96,
+       8,    47,    48,    49,    50,    51,   150,    52,    25,    53,
+      42,   137,     0,    43,     0,    93,    44,     0,    54,    55,
+      45,    46,    56,   140,     0,    47,    48,    49,    50,    51,
+       0,    52,    78,    53,    79,    80,    81,    82,    83,    84,
+       0,     0,    54,    55,    83,    84,    56,   151,    85,    86,
+      43,     0,     0,    44,    85,    86,     0,    45,    46,     0,
+       0,     0,    47,    48,    49,    50,    51,     0,    52,   133,
+      53,     0,     0,     0,     0,     0,     0,     0,    88,    54,
+      55,     0,     0,    56,     0,    78,     0,    79,    80,    81,
+      82,    83,    84,    78,     0,    79,    80,    81,    82,    83,
+      84,    85,    86,    94,     0,     0,     0,     0,     0,    85,
+      86,     0,     0,     0,    78,     0,    79,    80,    81,    82,
+      83,    84,    78,     0,    79,    80,    81,    82,    83,    84,
+      85,    86,     0,   102,     0,     0,     0,     0,    85,    86,
+      78,     0,    79,    80,    81,    82,    83,    84,     0,     0,
+       0,     0,     0,   104,     0,     0,    85,    86,    78,     0,
+      79,    80,    81,    82,    83,    84,     0,     0,     0,   127,
+       0,     0,     0,     0,    85,    86,    78,     0,    79,    80,
+      81,    82,    83,    84,     0,     0,   130,     0,     0,     0,
+       0,     0,    85,    86,    78,     0,    79,    80,    81,    82,
+      83,    84,   -67,     0,   -67,   -67,    81,    82,    83,    84,
+      85,    86,     0,     0,     0,     0,     0,     0,    85,    86
 };
 
 static const yytype_int16 yycheck[] =
 {
-      36,     7,     1,    59,     1,    41,     1,    43,    44,   116,
-      46,     1,   119,    23,    25,    51,    52,    53,    54,    25,
-      15,    17,     8,     1,     0,    24,    22,    24,    39,    24,
-      66,     1,     1,     3,    24,   142,    42,     4,    37,    75,
-      76,    77,    78,    79,    80,    81,    24,    37,    84,    85,
-      36,    39,    88,    41,    36,    24,     5,    23,    94,    95,
-      27,    38,    29,    30,    31,    32,    33,    34,    37,   125,
-       0,     1,    37,     3,    38,   111,    43,    44,    27,    24,
-      29,    30,    31,    32,    33,    34,   122,   123,   124,   145,
-      33,    34,    43,    44,    43,    44,    94,    95,    23,     1,
-      43,    44,    38,    38,     6,    37,    40,     9,   144,    42,
-     146,    13,    14,    41,    25,    38,    18,    19,    20,    21,
-      22,    41,    24,    23,    26,    23,    23,    36,    41,    24,
-      38,     1,    37,    35,    36,    37,     6,    39,    10,     9,
-      23,    23,    43,    13,    14,    41,    40,    39,    18,    19,
-      20,    21,    22,     7,    24,    27,    26,    29,    30,    31,
-      32,    33,    34,    15,    38,    35,    36,    24,    23,    39,
-      39,    43,    44,    27,    40,    29,    30,    31,    32,    33,
-      34,    17,    40,     4,     6,    35,   130,     9,    42,    43,
-      44,    13,    14,    -1,    -1,    -1,    18,    19,    20,    21,
-      22,    -1,    24,    -1,    26,    -1,    -1,    -1,     6,    -1,
-      -1,     9,    -1,    35,    36,    13,    14,    39,    40,    -1,
-      18,    19,    20,    21,    22,    -1,    24,    -1,    26,    -1,
-      -1,    -1,     6,    -1,    -1,     9,    -1,    35,    36,    13,
-      14,    39,    40,    -1,    18,    19,    20,    21,    22,    -1,
-      24,    -1,    26,    -1,    -1,    -1,     6,    -1,    -1,     9,
-      -1,    35,    36,    13,    14,    39,    40,    -1,    18,    19,
-      20,    21,    22,    -1,    24,    11,    26,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    12,    35,    36,    -1,    -1,    39,
-      -1,    27,    -1,    29,    30,    31,    32,    33,    34,    27,
-      -1,    29,    30,    31,    32,    33,    34,    43,    44,    16,
-      -1,    -1,    -1,    -1,    -1,    43,    44,    -1,    -1,    -1,
-      27,    -1,    29,    30,    31,    32,    33,    34,    27,    -1,
-      29,    30,    31,    32,    33,    34,    43,    44,    -1,    38,
+      38,     1,     1,     1,    61,    43,     1,    45,    46,     1,
+      48,     1,    15,     7,    25,    53,    54,    55,    56,     1,
+      15,     3,    25,     8,    24,    24,    24,    23,    39,    24,
+      23,    69,    24,     4,    24,    92,    74,    37,    37,    37,
+      78,    79,    80,    81,    82,    83,    84,    37,    42,    87,
+      88,    36,     5,    91,     0,    93,    27,    36,    29,    30,
+      31,    32,    33,    34,    38,     1,   128,     0,     1,    39,
+       3,    41,    43,    44,    27,    38,    29,    30,    31,    32,
+      33,    34,   120,    40,     1,    42,   148,   125,    24,     6,
+      43,    44,     9,   131,   132,    24,    13,    14,    40,    23,
+      42,    18,    19,    20,    21,    22,    40,    24,    42,    26,
+      38,    38,   150,    43,    44,    38,     1,    42,    35,    36,
+      37,     6,    39,    41,     9,    40,    25,    38,    13,    14,
+      23,    41,    23,    18,    19,    20,    21,    22,    36,    24,
+      23,    26,    38,    37,    41,     6,    24,    23,     9,    23,
+      35,    36,    13,    14,    39,    39,    38,    18,    19,    20,
+      21,    22,    43,    24,    41,    26,    25,    38,    24,     6,
+      23,    38,     9,    39,    35,    36,    13,    14,    39,    40,
+       4,    18,    19,    20,    21,    22,    17,    24,    17,    26,
+      37,   122,    -1,     6,    -1,    10,     9,    -1,    35,    36,
+      13,    14,    39,    40,    -1,    18,    19,    20,    21,    22,
+      -1,    24,    27,    26,    29,    30,    31,    32,    33,    34,
+      -1,    -1,    35,    36,    33,    34,    39,    40,    43,    44,
+       6,    -1,    -1,     9,    43,    44,    -1,    13,    14,    -1,
+      -1,    -1,    18,    19,    20,    21,    22,    -1,    24,    11,
+      26,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    12,    35,
+      36,    -1,    -1,    39,    -1,    27,    -1,    29,    30,    31,
+      32,    33,    34,    27,    -1,    29,    30,    31,    32,    33,
+      34,    43,    44,    16,    -1,    -1,    -1,    -1,    -1,    43,
+      44,    -1,    -1,    -1,    27,    -1,    29,    30,    31,    32,
+      33,    34,    27,    -1,    29,    30,    31,    32,    33,    34,
+      43,    44,    -1,    38,    -1,    -1,    -1,    -1,    43,    44,
+      27,    -1,    29,    30,    31,    32,    33,    34,    -1,    -1,
+      -1,    -1,    -1,    40,    -1,    -1,    43,    44,    27,    -1,
+      29,    30,    31,    32,    33,    34,    -1,    -1,    -1,    38,
       -1,    -1,    -1,    -1,    43,    44,    27,    -1,    29,    30,
-      31,    32,    33,    34,    -1,    -1,    -1,    -1,    -1,    40,
+      31,    32,    33,    34,    -1,    -1,    37,    -1,    -1,    -1,
       -1,    -1,    43,    44,    27,    -1,    29,    30,    31,    32,
-      33,    34,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    42,
-      43,    44,    27,    -1,    29,    30,    31,    32,    33,    34,
-      -1,    -1,    37,    -1,    -1,    -1,    -1,    -1,    43,    44,
-      27,    -1,    29,    30,    31,    32,    33,    34,    27,    -1,
-      29,    30,    31,    32,    33,    34,    43,    44,    -1,    -1,
-      -1,    -1,    -1,    -1,    43,    44
+      33,    34,    27,    -1,    29,    30,    31,    32,    33,    34,
+      43,    44,    -1,    -1,    -1,    -1,    -1,    -1,    43,    44
 };
 
-  /* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-     symbol of state STATE-NUM.  */
-static const yytype_uint8 yystos[] =
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int8 yystos[] =
 {
        0,     1,     3,    46,    47,    48,    23,     0,    48,     8,
       36,    23,     1,    24,    37,    49,    50,    36,    39,    41,
-      38,    37,    38,    37,    49,    24,    51,    52,    23,    38,
-      49,    38,    37,    41,    40,    42,    25,    38,    23,    41,
-      51,     6,     9,    13,    14,    18,    19,    20,    21,    22,
-      24,    26,    35,    36,    39,    56,    59,    23,    59,     1,
-      24,    55,    59,    59,    23,    59,    25,    39,    59,    59,
-       1,    53,    59,    60,    59,    27,    29,    30,    31,    32,
-      33,    34,    43,    44,    36,    12,    55,    41,    10,    16,
-      59,    40,    54,    59,    38,    38,    37,    40,    59,    59,
-      59,    59,    59,    59,    59,    24,    23,    59,    59,    23,
-      59,     1,    24,    57,    58,    40,    42,    53,    53,    39,
-      43,    37,     4,     7,    25,    42,    11,    59,    41,    15,
-      38,    54,    40,    54,    24,    59,    59,    59,    55,    23,
-      57,    40,    39,     5,     7,    42,    17,    40,    54,    59,
-      55,    59,    40
+      38,    37,    50,    38,    37,    49,    24,    51,    52,    53,
+      23,    38,    38,    38,    37,    41,    40,    42,    25,    38,
+      23,    41,    53,     6,     9,    13,    14,    18,    19,    20,
+      21,    22,    24,    26,    35,    36,    39,    58,    61,    23,
+      61,     1,    24,    56,    57,    61,    61,    23,    61,    25,
+      39,    61,    61,     1,    54,    61,    62,    61,    27,    29,
+      30,    31,    32,    33,    34,    43,    44,    36,    12,    57,
+      41,     7,    42,    10,    16,    61,    40,    55,    61,    38,
+       1,    61,    38,    37,    40,    61,    61,    61,    61,    61,
+      61,    61,    24,    23,    61,    61,    23,    61,    57,    61,
+       1,    24,    59,    60,    40,    42,    38,    38,    39,    43,
+      37,     4,    25,    11,    61,    41,    15,    60,    38,    61,
+      40,    55,    24,    61,    61,    23,    38,    40,    39,     5,
+      17,    40,    55,    61,    40
 };
 
-  /* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
-static const yytype_uint8 yyr1[] =
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr1[] =
 {
        0,    45,    46,    47,    47,    48,    48,    48,    48,    48,
       49,    49,    50,    50,    50,    50,    51,    51,    51,    52,
-      53,    53,    53,    54,    54,    55,    55,    55,    55,    55,
-      56,    57,    57,    58,    58,    59,    59,    59,    59,    59,
-      59,    59,    59,    59,    59,    59,    59,    59,    59,    59,
-      59,    59,    59,    59,    59,    59,    59,    59,    59,    59,
-      59,    59,    59,    60
+      52,    53,    54,    54,    54,    54,    55,    55,    56,    56,
+      57,    57,    57,    58,    59,    59,    60,    60,    61,    61,
+      61,    61,    61,    61,    61,    61,    61,    61,    61,    61,
+      61,    61,    61,    61,    61,    61,    61,    61,    61,    61,
+      61,    61,    61,    61,    61,    61,    62
 };
 
-  /* YYR2[YYN] -- Number of symbols on the right hand side of rule YYN.  */
-static const yytype_uint8 yyr2[] =
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
 {
        0,     2,     1,     1,     2,     6,     8,     5,     7,     1,
-       2,     3,     9,     3,     5,     1,     0,     1,     3,     3,
-       2,     3,     3,     1,     3,     5,     5,     7,     7,     2,
-       5,     2,     3,     5,     2,     3,     1,     1,     1,     2,
-       3,     5,     6,     7,     8,     1,     3,     4,     1,     3,
-       7,     5,     2,     2,     3,     3,     3,     3,     2,     3,
-       3,     2,     3,     1
+       2,     3,     9,     3,     5,     1,     0,     1,     2,     1,
+       3,     3,     2,     3,     2,     3,     1,     3,     1,     3,
+       3,     5,     2,     5,     2,     3,     5,     2,     3,     1,
+       1,     1,     4,     3,     5,     6,     7,     8,     1,     3,
+       4,     1,     3,     7,     5,     2,     2,     3,     3,     3,
+       3,     2,     3,     3,     2,     3,     1
 };
 
 
+enum { YYENOMEM = -2 };
+
 #define yyerrok         (yyerrstatus = 0)
 #define yyclearin       (yychar = YYEMPTY)
-#define YYEMPTY         (-2)
-#define YYEOF           0
 
 #define YYACCEPT        goto yyacceptlab
 #define YYABORT         goto yyabortlab
 #define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
 
 
 #define YYRECOVERING()  (!!yyerrstatus)
@@ -878,15 +927,14 @@ static const yytype_uint8 yyr2[] =
       }                                                           \
     else                                                          \
       {                                                           \
-        yyerror (YY_("syntax error: cannot back up")); \
+        yyerror (&yylloc, ctx, YY_("syntax error: cannot back up")); \
         YYERROR;                                                  \
       }                                                           \
   while (0)
 
-/* Error token number */
-#define YYTERROR        1
-#define YYERRCODE       256
-
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
 
 /* YYLLOC_DEFAULT -- Set CURRENT to span from RHS[1] to RHS[N].
    If N is 0, then set CURRENT to the empty location which ends
@@ -930,12 +978,19 @@ do {                                            \
 } while (0)
 
 
-/* YY_LOCATION_PRINT -- Print the location on the stream.
+/* YYLOCATION_PRINT -- Print the location on the stream.
    This macro was not mandated originally: define only if we know
    we won't break user code: when these are the locations we know.  */
 
-#ifndef YY_LOCATION_PRINT
-# if defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL
+# ifndef YYLOCATION_PRINT
+
+#  if defined YY_LOCATION_PRINT
+
+   /* Temporary convenience wrapper in case some people defined the
+      undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YYLOCATION_PRINT(File, Loc)  YY_LOCATION_PRINT(File, *(Loc))
+
+#  elif defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL
 
 /* Print *YYLOCP on YYO.  Private, do not rely on its existence. */
 
@@ -963,24 +1018,32 @@ yy_location_print_ (FILE *yyo, YYLTYPE const * const yylocp)
         res += YYFPRINTF (yyo, "-%d", end_col);
     }
   return res;
- }
+}
 
-#  define YY_LOCATION_PRINT(File, Loc)          \
-  yy_location_print_ (File, &(Loc))
+#   define YYLOCATION_PRINT  yy_location_print_
 
-# else
-#  define YY_LOCATION_PRINT(File, Loc) ((void) 0)
-# endif
-#endif
+    /* Temporary convenience wrapper in case some people defined the
+       undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YY_LOCATION_PRINT(File, Loc)  YYLOCATION_PRINT(File, &(Loc))
+
+#  else
 
+#   define YYLOCATION_PRINT(File, Loc) ((void) 0)
+    /* Temporary convenience wrapper in case some people defined the
+       undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YY_LOCATION_PRINT  YYLOCATION_PRINT
 
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)                    \
+#  endif
+# endif /* !defined YYLOCATION_PRINT */
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
 do {                                                                      \
   if (yydebug)                                                            \
     {                                                                     \
       YYFPRINTF (stderr, "%s ", Title);                                   \
       yy_symbol_print (stderr,                                            \
-                  Type, Value, Location); \
+                  Kind, Value, Location, ctx); \
       YYFPRINTF (stderr, "\n");                                           \
     }                                                                     \
 } while (0)
@@ -991,18 +1054,18 @@ do {                                                                      \
 `-----------------------------------*/
 
 static void
-yy_symbol_value_print (FILE *yyo, int yytype, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp)
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp, ParserContext *ctx)
 {
   FILE *yyoutput = yyo;
-  YYUSE (yyoutput);
-  YYUSE (yylocationp);
+  YY_USE (yyoutput);
+  YY_USE (yylocationp);
+  YY_USE (ctx);
   if (!yyvaluep)
     return;
-# ifdef YYPRINT
-  if (yytype < YYNTOKENS)
-    YYPRINT (yyo, yytoknum[yytype], *yyvaluep);
-# endif
-  YYUSE (yytype);
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
@@ -1011,14 +1074,15 @@ yy_symbol_value_print (FILE *yyo, int yytype, YYSTYPE const * const yyvaluep, YY
 `---------------------------*/
 
 static void
-yy_symbol_print (FILE *yyo, int yytype, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp)
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp, ParserContext *ctx)
 {
   YYFPRINTF (yyo, "%s %s (",
-             yytype < YYNTOKENS ? "token" : "nterm", yytname[yytype]);
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
 
-  YY_LOCATION_PRINT (yyo, *yylocationp);
+  YYLOCATION_PRINT (yyo, yylocationp);
   YYFPRINTF (yyo, ": ");
-  yy_symbol_value_print (yyo, yytype, yyvaluep, yylocationp);
+  yy_symbol_value_print (yyo, yykind, yyvaluep, yylocationp, ctx);
   YYFPRINTF (yyo, ")");
 }
 
@@ -1028,7 +1092,7 @@ yy_symbol_print (FILE *yyo, int yytype, YYSTYPE const * const yyvaluep, YYLTYPE
 `------------------------------------------------------------------*/
 
 static void
-yy_stack_print (yytype_int16 *yybottom, yytype_int16 *yytop)
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
 {
   YYFPRINTF (stderr, "Stack now");
   for (; yybottom <= yytop; yybottom++)
@@ -1051,21 +1115,22 @@ do {                                                            \
 `------------------------------------------------*/
 
 static void
-yy_reduce_print (yytype_int16 *yyssp, YYSTYPE *yyvsp, YYLTYPE *yylsp, int yyrule)
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp, YYLTYPE *yylsp,
+                 int yyrule, ParserContext *ctx)
 {
-  unsigned long yylno = yyrline[yyrule];
+  int yylno = yyrline[yyrule];
   int yynrhs = yyr2[yyrule];
   int yyi;
-  YYFPRINTF (stderr, "Reducing stack by rule %d (line %lu):\n",
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
              yyrule - 1, yylno);
   /* The symbols being reduced.  */
   for (yyi = 0; yyi < yynrhs; yyi++)
     {
       YYFPRINTF (stderr, "   $%d = ", yyi + 1);
       yy_symbol_print (stderr,
-                       yystos[yyssp[yyi + 1 - yynrhs]],
-                       &yyvsp[(yyi + 1) - (yynrhs)]
-                       , &(yylsp[(yyi + 1) - (yynrhs)])                       );
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)],
+                       &(yylsp[(yyi + 1) - (yynrhs)]), ctx);
       YYFPRINTF (stderr, "\n");
     }
 }
@@ -1073,15 +1138,15 @@ yy_reduce_print (yytype_int16 *yyssp, YYSTYPE *yyvsp, YYLTYPE *yylsp, int yyrule
 # define YY_REDUCE_PRINT(Rule)          \
 do {                                    \
   if (yydebug)                          \
-    yy_reduce_print (yyssp, yyvsp, yylsp, Rule); \
+    yy_reduce_print (yyssp, yyvsp, yylsp, Rule, ctx); \
 } while (0)
 
 /* Nonzero means print parse trace.  It is left uninitialized so that
    multiple parsers can coexist.  */
 int yydebug;
 #else /* !YYDEBUG */
-# define YYDPRINTF(Args)
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
 # define YY_STACK_PRINT(Bottom, Top)
 # define YY_REDUCE_PRINT(Rule)
 #endif /* !YYDEBUG */
@@ -1102,325 +1167,214 @@ int yydebug;
 #ifndef YYMAXDEPTH
 # define YYMAXDEPTH 10000
 #endif
+/* Parser data structure.  */
+struct yypstate
+  {
+    /* Number of syntax errors so far.  */
+    int yynerrs;
 
+    yy_state_fast_t yystate;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus;
 
-#if YYERROR_VERBOSE
-
-# ifndef yystrlen
-#  if defined __GLIBC__ && defined _STRING_H
-#   define yystrlen strlen
-#  else
-/* Return the length of YYSTR.  */
-static YYSIZE_T
-yystrlen (const char *yystr)
-{
-  YYSIZE_T yylen;
-  for (yylen = 0; yystr[yylen]; yylen++)
-    continue;
-  return yylen;
-}
-#  endif
-# endif
-
-# ifndef yystpcpy
-#  if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
-#   define yystpcpy stpcpy
-#  else
-/* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
-   YYDEST.  */
-static char *
-yystpcpy (char *yydest, const char *yysrc)
-{
-  char *yyd = yydest;
-  const char *yys = yysrc;
-
-  while ((*yyd++ = *yys++) != '\0')
-    continue;
-
-  return yyd - 1;
-}
-#  endif
-# endif
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
 
-# ifndef yytnamerr
-/* Copy to YYRES the contents of YYSTR after stripping away unnecessary
-   quotes and backslashes, so that it's suitable for yyerror.  The
-   heuristic is that double-quoting is unnecessary unless the string
-   contains an apostrophe, a comma, or backslash (other than
-   backslash-backslash).  YYSTR is taken from yytname.  If YYRES is
-   null, do not copy; instead, return the length of what the result
-   would have been.  */
-static YYSIZE_T
-yytnamerr (char *yyres, const char *yystr)
-{
-  if (*yystr == '"')
-    {
-      YYSIZE_T yyn = 0;
-      char const *yyp = yystr;
-
-      for (;;)
-        switch (*++yyp)
-          {
-          case '\'':
-          case ',':
-            goto do_not_strip_quotes;
-
-          case '\\':
-            if (*++yyp != '\\')
-              goto do_not_strip_quotes;
-            else
-              goto append;
-
-          append:
-          default:
-            if (yyres)
-              yyres[yyn] = *yyp;
-            yyn++;
-            break;
-
-          case '"':
-            if (yyres)
-              yyres[yyn] = '\0';
-            return yyn;
-          }
-    do_not_strip_quotes: ;
-    }
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize;
 
-  if (! yyres)
-    return yystrlen (yystr);
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss;
+    yy_state_t *yyssp;
 
-  return (YYSIZE_T) (yystpcpy (yyres, yystr) - yyres);
-}
-# endif
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs;
+    YYSTYPE *yyvsp;
 
-/* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
-   about the unexpected token YYTOKEN for the state stack whose top is
-   YYSSP.
+    /* The location stack: array, bottom, top.  */
+    YYLTYPE yylsa[YYINITDEPTH];
+    YYLTYPE *yyls;
+    YYLTYPE *yylsp;
+    /* Whether this instance has not started parsing yet.
+     * If 2, it corresponds to a finished parsing.  */
+    int yynew;
+  };
 
-   Return 0 if *YYMSG was successfully written.  Return 1 if *YYMSG is
-   not large enough to hold the message.  In that case, also set
-   *YYMSG_ALLOC to the required number of bytes.  Return 2 if the
-   required number of bytes is too large to store.  */
-static int
-yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
-                yytype_int16 *yyssp, int yytoken)
-{
-  YYSIZE_T yysize0 = yytnamerr (YY_NULLPTR, yytname[yytoken]);
-  YYSIZE_T yysize = yysize0;
-  enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-  /* Internationalized format string. */
-  const char *yyformat = YY_NULLPTR;
-  /* Arguments of yyformat. */
-  char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
-  /* Number of reported tokens (one for the "unexpected", one per
-     "expected"). */
-  int yycount = 0;
-
-  /* There are many possibilities here to consider:
-     - If this state is a consistent state with a default action, then
-       the only way this function was invoked is if the default action
-       is an error action.  In that case, don't check for expected
-       tokens because there are none.
-     - The only way there can be no lookahead present (in yychar) is if
-       this state is a consistent state with a default action.  Thus,
-       detecting the absence of a lookahead is sufficient to determine
-       that there is no unexpected or expected token to report.  In that
-       case, just report a simple "syntax error".
-     - Don't assume there isn't a lookahead just because this state is a
-       consistent state with a default action.  There might have been a
-       previous inconsistent state, consistent state with a non-default
-       action, or user semantic action that manipulated yychar.
-     - Of course, the expected token list depends on states to have
-       correct lookahead information, and it depends on the parser not
-       to perform extra reductions after fetching a lookahead from the
-       scanner and before detecting a syntax error.  Thus, state merging
-       (from LALR or IELR) and default reductions corrupt the expected
-       token list.  However, the list is correct for canonical LR with
-       one exception: it will still contain any token that will not be
-       accepted due to an error action in a later state.
-  */
-  if (yytoken != YYEMPTY)
-    {
-      int yyn = yypact[*yyssp];
-      yyarg[yycount++] = yytname[yytoken];
-      if (!yypact_value_is_default (yyn))
-        {
-          /* Start YYX at -YYN if negative to avoid negative indexes in
-             YYCHECK.  In other words, skip the first -YYN actions for
-             this state because they are default actions.  */
-          int yyxbegin = yyn < 0 ? -yyn : 0;
-          /* Stay within bounds of both yycheck and yytname.  */
-          int yychecklim = YYLAST - yyn + 1;
-          int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
-          int yyx;
-
-          for (yyx = yyxbegin; yyx < yyxend; ++yyx)
-            if (yycheck[yyx + yyn] == yyx && yyx != YYTERROR
-                && !yytable_value_is_error (yytable[yyx + yyn]))
-              {
-                if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                  {
-                    yycount = 1;
-                    yysize = yysize0;
-                    break;
-                  }
-                yyarg[yycount++] = yytname[yyx];
-                {
-                  YYSIZE_T yysize1 = yysize + yytnamerr (YY_NULLPTR, yytname[yyx]);
-                  if (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM)
-                    yysize = yysize1;
-                  else
-                    return 2;
-                }
-              }
-        }
-    }
 
-  switch (yycount)
-    {
-# define YYCASE_(N, S)                      \
-      case N:                               \
-        yyformat = S;                       \
-      break
-    default: /* Avoid compiler warnings. */
-      YYCASE_(0, YY_("syntax error"));
-      YYCASE_(1, YY_("syntax error, unexpected %s"));
-      YYCASE_(2, YY_("syntax error, unexpected %s, expecting %s"));
-      YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
-      YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
-      YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
-# undef YYCASE_
-    }
 
-  {
-    YYSIZE_T yysize1 = yysize + yystrlen (yyformat);
-    if (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM)
-      yysize = yysize1;
-    else
-      return 2;
-  }
 
-  if (*yymsg_alloc < yysize)
-    {
-      *yymsg_alloc = 2 * yysize;
-      if (! (yysize <= *yymsg_alloc
-             && *yymsg_alloc <= YYSTACK_ALLOC_MAXIMUM))
-        *yymsg_alloc = YYSTACK_ALLOC_MAXIMUM;
-      return 1;
-    }
 
-  /* Avoid sprintf, as that infringes on the user's name space.
-     Don't have undefined behavior even if the translation
-     produced a string with the wrong number of "%s"s.  */
-  {
-    char *yyp = *yymsg;
-    int yyi = 0;
-    while ((*yyp = *yyformat) != '\0')
-      if (*yyp == '%' && yyformat[1] == 's' && yyi < yycount)
-        {
-          yyp += yytnamerr (yyp, yyarg[yyi++]);
-          yyformat += 2;
-        }
-      else
-        {
-          yyp++;
-          yyformat++;
-        }
-  }
-  return 0;
-}
-#endif /* YYERROR_VERBOSE */
 
 /*-----------------------------------------------.
 | Release the memory associated to this symbol.  |
 `-----------------------------------------------*/
 
 static void
-yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep, YYLTYPE *yylocationp)
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep, YYLTYPE *yylocationp, ParserContext *ctx)
 {
-  YYUSE (yyvaluep);
-  YYUSE (yylocationp);
+  YY_USE (yyvaluep);
+  YY_USE (yylocationp);
+  YY_USE (ctx);
   if (!yymsg)
     yymsg = "Deleting";
-  YY_SYMBOL_PRINT (yymsg, yytype, yyvaluep, yylocationp);
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
 
   YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
-  YYUSE (yytype);
+  YY_USE (yykind);
   YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
 
 
-/* The lookahead symbol.  */
-int yychar;
 
-/* The semantic value of the lookahead symbol.  */
-YYSTYPE yylval;
-/* Location data for the lookahead symbol.  */
-YYLTYPE yylloc
+int
+yyparse (ParserContext *ctx)
+{
+  yypstate *yyps = yypstate_new ();
+  if (!yyps)
+    {
+      static YYLTYPE yyloc_default
+# if defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL
+  = { 1, 1, 1, 1 }
+# endif
+;
+      YYLTYPE yylloc = yyloc_default;
+      yyerror (&yylloc, ctx, YY_("memory exhausted"));
+      return 2;
+    }
+  int yystatus = yypull_parse (yyps, ctx);
+  yypstate_delete (yyps);
+  return yystatus;
+}
+
+int
+yypull_parse (yypstate *yyps, ParserContext *ctx)
+{
+  YY_ASSERT (yyps);
+  static YYLTYPE yyloc_default
 # if defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL
   = { 1, 1, 1, 1 }
 # endif
 ;
-/* Number of syntax errors so far.  */
-int yynerrs;
+  YYLTYPE yylloc = yyloc_default;
+  int yystatus;
+  do {
+    YYSTYPE yylval;
+    int yychar = yylex (&yylval, &yylloc, ctx);
+    yystatus = yypush_parse (yyps, yychar, &yylval, &yylloc, ctx);
+  } while (yystatus == YYPUSH_MORE);
+  return yystatus;
+}
 
+#define cool_yynerrs yyps->cool_yynerrs
+#define yystate yyps->yystate
+#define yyerrstatus yyps->yyerrstatus
+#define yyssa yyps->yyssa
+#define yyss yyps->yyss
+#define yyssp yyps->yyssp
+#define yyvsa yyps->yyvsa
+#define yyvs yyps->yyvs
+#define yyvsp yyps->yyvsp
+#define yylsa yyps->yylsa
+#define yyls yyps->yyls
+#define yylsp yyps->yylsp
+#define yystacksize yyps->yystacksize
+
+/* Initialize the parser data structure.  */
+static void
+yypstate_clear (yypstate *yyps)
+{
+  yynerrs = 0;
+  yystate = 0;
+  yyerrstatus = 0;
 
-/*----------.
-| yyparse.  |
-`----------*/
+  yyssp = yyss;
+  yyvsp = yyvs;
+  yylsp = yyls;
 
-int
-yyparse (void)
+  /* Initialize the state stack, in case yypcontext_expected_tokens is
+     called before the first call to yyparse. */
+  *yyssp = 0;
+  yyps->yynew = 1;
+}
+
+/* Initialize the parser data structure.  */
+yypstate *
+yypstate_new (void)
 {
-    int yystate;
-    /* Number of tokens to shift before error messages enabled.  */
-    int yyerrstatus;
+  yypstate *yyps;
+  yyps = YY_CAST (yypstate *, YYMALLOC (sizeof *yyps));
+  if (!yyps)
+    return YY_NULLPTR;
+  yystacksize = YYINITDEPTH;
+  yyss = yyssa;
+  yyvs = yyvsa;
+  yyls = yylsa;
+  yypstate_clear (yyps);
+  return yyps;
+}
 
-    /* The stacks and their tools:
-       'yyss': related to states.
-       'yyvs': related to semantic values.
-       'yyls': related to locations.
+void
+yypstate_delete (yypstate *yyps)
+{
+  if (yyps)
+    {
+#ifndef yyoverflow
+      /* If the stack was reallocated but the parse did not complete, then the
+         stack still needs to be freed.  */
+      if (yyss != yyssa)
+        YYSTACK_FREE (yyss);
+#endif
+      YYFREE (yyps);
+    }
+}
 
-       Refer to the stacks through separate pointers, to allow yyoverflow
-       to reallocate them elsewhere.  */
 
-    /* The state stack.  */
-    yytype_int16 yyssa[YYINITDEPTH];
-    yytype_int16 *yyss;
-    yytype_int16 *yyssp;
 
-    /* The semantic value stack.  */
-    YYSTYPE yyvsa[YYINITDEPTH];
-    YYSTYPE *yyvs;
-    YYSTYPE *yyvsp;
+/*---------------.
+| yypush_parse.  |
+`---------------*/
 
-    /* The location stack.  */
-    YYLTYPE yylsa[YYINITDEPTH];
-    YYLTYPE *yyls;
-    YYLTYPE *yylsp;
+int
+yypush_parse (yypstate *yyps,
+              int yypushed_char, YYSTYPE const *yypushed_val, YYLTYPE *yypushed_loc, ParserContext *ctx)
+{
+/* Lookahead token kind.  */
+int yychar;
 
-    /* The locations where the error started and ended.  */
-    YYLTYPE yyerror_range[3];
 
-    YYSIZE_T yystacksize;
+/* The semantic value of the lookahead symbol.  */
+/* Default value used for initialization, for pacifying older GCCs
+   or non-GCC compilers.  */
+YY_INITIAL_VALUE (static YYSTYPE yyval_default;)
+YYSTYPE yylval YY_INITIAL_VALUE (= yyval_default);
+
+/* Location data for the lookahead symbol.  */
+static YYLTYPE yyloc_default
+# if defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL
+  = { 1, 1, 1, 1 }
+# endif
+;
+YYLTYPE yylloc = yyloc_default;
 
   int yyn;
+  /* The return value of yyparse.  */
   int yyresult;
-  /* Lookahead token as an internal (translated) token number.  */
-  int yytoken = 0;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
   /* The variables used to return semantic value and location from the
      action routines.  */
   YYSTYPE yyval;
   YYLTYPE yyloc;
 
-#if YYERROR_VERBOSE
-  /* Buffer for error messages, and its allocated size.  */
-  char yymsgbuf[128];
-  char *yymsg = yymsgbuf;
-  YYSIZE_T yymsg_alloc = sizeof yymsgbuf;
-#endif
+  /* The locations where the error started and ended.  */
+  YYLTYPE yyerror_range[3];
+
+
 
 #define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N), yylsp -= (N))
 
@@ -1428,18 +1382,32 @@ yyparse (void)
      Keep to zero when no symbol should be popped.  */
   int yylen = 0;
 
-  yyssp = yyss = yyssa;
-  yyvsp = yyvs = yyvsa;
-  yylsp = yyls = yylsa;
-  yystacksize = YYINITDEPTH;
+  switch (yyps->yynew)
+    {
+    case 0:
+      yyn = yypact[yystate];
+      goto yyread_pushed_token;
+
+    case 2:
+      yypstate_clear (yyps);
+      break;
+
+    default:
+      break;
+    }
 
   YYDPRINTF ((stderr, "Starting parse\n"));
 
-  yystate = 0;
-  yyerrstatus = 0;
-  yynerrs = 0;
   yychar = YYEMPTY; /* Cause a token to be read.  */
-  yylsp[0] = yylloc;
+
+
+/* User initialization code.  */
+#line 137 "cool.y"
+{ init_parse_symbols(); }
+
+#line 1409 "cool.tab.c"
+
+  yylsp[0] = *yypushed_loc;
   goto yysetstate;
 
 
@@ -1453,26 +1421,31 @@ yynewstate:
 
 
 /*--------------------------------------------------------------------.
-| yynewstate -- set current state (the top of the stack) to yystate.  |
+| yysetstate -- set current state (the top of the stack) to yystate.  |
 `--------------------------------------------------------------------*/
 yysetstate:
-  *yyssp = (yytype_int16) yystate;
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
 
   if (yyss + yystacksize - 1 <= yyssp)
 #if !defined yyoverflow && !defined YYSTACK_RELOCATE
-    goto yyexhaustedlab;
+    YYNOMEM;
 #else
     {
       /* Get the current used size of the three stacks, in elements.  */
-      YYSIZE_T yysize = (YYSIZE_T) (yyssp - yyss + 1);
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
 
 # if defined yyoverflow
       {
         /* Give user a chance to reallocate the stack.  Use copies of
            these so that the &'s don't force the real ones into
            memory.  */
+        yy_state_t *yyss1 = yyss;
         YYSTYPE *yyvs1 = yyvs;
-        yytype_int16 *yyss1 = yyss;
         YYLTYPE *yyls1 = yyls;
 
         /* Each stack pointer address is followed by the size of the
@@ -1480,9 +1453,9 @@ yysetstate:
            conditional around just the two extra args, but that might
            be undefined if yyoverflow is a macro.  */
         yyoverflow (YY_("memory exhausted"),
-                    &yyss1, yysize * sizeof (*yyssp),
-                    &yyvs1, yysize * sizeof (*yyvsp),
-                    &yyls1, yysize * sizeof (*yylsp),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yyls1, yysize * YYSIZEOF (*yylsp),
                     &yystacksize);
         yyss = yyss1;
         yyvs = yyvs1;
@@ -1491,21 +1464,22 @@ yysetstate:
 # else /* defined YYSTACK_RELOCATE */
       /* Extend the stack our own way.  */
       if (YYMAXDEPTH <= yystacksize)
-        goto yyexhaustedlab;
+        YYNOMEM;
       yystacksize *= 2;
       if (YYMAXDEPTH < yystacksize)
         yystacksize = YYMAXDEPTH;
 
       {
-        yytype_int16 *yyss1 = yyss;
+        yy_state_t *yyss1 = yyss;
         union yyalloc *yyptr =
-          (union yyalloc *) YYSTACK_ALLOC (YYSTACK_BYTES (yystacksize));
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
         if (! yyptr)
-          goto yyexhaustedlab;
+          YYNOMEM;
         YYSTACK_RELOCATE (yyss_alloc, yyss);
         YYSTACK_RELOCATE (yyvs_alloc, yyvs);
         YYSTACK_RELOCATE (yyls_alloc, yyls);
-# undef YYSTACK_RELOCATE
+#  undef YYSTACK_RELOCATE
         if (yyss1 != yyssa)
           YYSTACK_FREE (yyss1);
       }
@@ -1515,15 +1489,16 @@ yysetstate:
       yyvsp = yyvs + yysize - 1;
       yylsp = yyls + yysize - 1;
 
-      YYDPRINTF ((stderr, "Stack size increased to %lu\n",
-                  (unsigned long) yystacksize));
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
 
       if (yyss + yystacksize - 1 <= yyssp)
         YYABORT;
     }
 #endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
 
-  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
 
   if (yystate == YYFINAL)
     YYACCEPT;
@@ -1545,18 +1520,42 @@ yybackup:
 
   /* Not known => get a lookahead token if don't already have one.  */
 
-  /* YYCHAR is either YYEMPTY or YYEOF or a valid lookahead symbol.  */
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
   if (yychar == YYEMPTY)
     {
-      YYDPRINTF ((stderr, "Reading a token: "));
-      yychar = yylex ();
+      if (!yyps->yynew)
+        {
+          YYDPRINTF ((stderr, "Return for a new token:\n"));
+          yyresult = YYPUSH_MORE;
+          goto yypushreturn;
+        }
+      yyps->yynew = 0;
+yyread_pushed_token:
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yypushed_char;
+      if (yypushed_val)
+        yylval = *yypushed_val;
+      if (yypushed_loc)
+        yylloc = *yypushed_loc;
     }
 
   if (yychar <= YYEOF)
     {
-      yychar = yytoken = YYEOF;
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
       YYDPRINTF ((stderr, "Now at end of input.\n"));
     }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      yyerror_range[1] = yylloc;
+      goto yyerrlab1;
+    }
   else
     {
       yytoken = YYTRANSLATE (yychar);
@@ -1584,15 +1583,14 @@ yybackup:
 
   /* Shift the lookahead token.  */
   YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
-
-  /* Discard the shifted token.  */
-  yychar = YYEMPTY;
-
   yystate = yyn;
   YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
   YY_IGNORE_MAYBE_UNINITIALIZED_END
   *++yylsp = yylloc;
+
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
   goto yynewstate;
 
 
@@ -1629,385 +1627,402 @@ yyreduce:
   YY_REDUCE_PRINT (yyn);
   switch (yyn)
     {
-        case 2:
-#line 166 "cool.y" /* yacc.c:1652  */
-    { (yyloc) = (yylsp[0]); ast_root = program((yyvsp[0].classes)); }
-#line 1636 "cool.tab.c" /* yacc.c:1652  */
+  case 2: /* program: class_list  */
+#line 216 "cool.y"
+    { (yyloc) = (yylsp[0]); ctx->classes = finish_list((yyvsp[0].class_buffer)); ctx->program = program(ctx->classes); }
+#line 1634 "cool.tab.c"
     break;
 
-  case 3:
-#line 170 "cool.y" /* yacc.c:1652  */
-    { (yyval.classes) = single_Classes((yyvsp[0].class_));
-    parse_results = (yyval.classes); }
-#line 1643 "cool.tab.c" /* yacc.c:1652  */
+  case 3: /* class_list: class  */
+#line 223 "cool.y"
+    { (yyval.class_buffer) = (new list_buffer<Class_>)->add((yyvsp[0].class_)); }
+#line 1640 "cool.tab.c"
     break;
 
-  case 4:
-#line 173 "cool.y" /* yacc.c:1652  */
-    { (yyval.classes) = append_Classes((yyvsp[-1].classes),single_Classes((yyvsp[0].class_))); 
-    parse_results = (yyval.classes); }
-#line 1650 "cool.tab.c" /* yacc.c:1652  */
+  case 4: /* class_list: class_list class  */
+#line 225 "cool.y"
+    { (yyval.class_buffer) = (yyvsp[-1].class_buffer)->add((yyvsp[0].class_)); }
+#line 1646 "cool.tab.c"
     break;
 
-  case 5:
-#line 179 "cool.y" /* yacc.c:1652  */
-    { (yyval.class_) = class_((yyvsp[-4].symbol), idtable.add_string("Object"), (yyvsp[-2].features),
-    stringtable.add_string(curr_filename)); }
-#line 1657 "cool.tab.c" /* yacc.c:1652  */
+  case 5: /* class: CLASS TYPEID '{' feature_list '}' ';'  */
+#line 230 "cool.y"
+    { (yyval.class_) = class_((yyvsp[-4].symbol), Object_symbol, finish_list((yyvsp[-2].feature_buffer)), ctx->filename); }
+#line 1652 "cool.tab.c"
     break;
 
-  case 6:
-#line 182 "cool.y" /* yacc.c:1652  */
-    { (yyval.class_) = class_((yyvsp[-6].symbol), (yyvsp[-4].symbol), (yyvsp[-2].features), stringtable.add_string(curr_filename)); }
-#line 1663 "cool.tab.c" /* yacc.c:1652  */
+  case 6: /* class: CLASS TYPEID INHERITS TYPEID '{' feature_list '}' ';'  */
+#line 232 "cool.y"
+    { (yyval.class_) = class_((yyvsp[-6].symbol), (yyvsp[-4].symbol), finish_list((yyvsp[-2].feature_buffer)), ctx->filename); }
+#line 1658 "cool.tab.c"
     break;
 
-  case 7:
-#line 184 "cool.y" /* yacc.c:1652  */
-    { (yyval.class_) = class_((yyvsp[-3].symbol), idtable.add_string("Object"), nil_Features(),
-    stringtable.add_string(curr_filename));}
-#line 1670 "cool.tab.c" /* yacc.c:1652  */
+  case 7: /* class: CLASS TYPEID '{' '}' ';'  */
+#line 234 "cool.y"
+    { (yyval.class_) = class_((yyvsp[-3].symbol), Object_symbol, nil_Features(), ctx->filename); }
+#line 1664 "cool.tab.c"
     break;
 
-  case 8:
-#line 187 "cool.y" /* yacc.c:1652  */
-    { (yyval.class_) = class_((yyvsp[-5].symbol), (yyvsp[-3].symbol), nil_Features(),
-    stringtable.add_string(curr_filename));}
-#line 1677 "cool.tab.c" /* yacc.c:1652  */
+  case 8: /* class: CLASS TYPEID INHERITS TYPEID '{' '}' ';'  */
+#line 236 "cool.y"
+    { (yyval.class_) = class_((yyvsp[-5].symbol), (yyvsp[-3].symbol), nil_Features(), ctx->filename); }
+#line 1670 "cool.tab.c"
     break;
 
-  case 9:
-#line 190 "cool.y" /* yacc.c:1652  */
-    { MYDEBUG(printf("class-error-1 caught som'n\n");)}
-#line 1683 "cool.tab.c" /* yacc.c:1652  */
+  case 9: /* class: error  */
+#line 238 "cool.y"
+                { MYDEBUG(printf("class-error-1 caught som'n\n");)}
+#line 1676 "cool.tab.c"
     break;
 
-  case 10:
-#line 194 "cool.y" /* yacc.c:1652  */
-    { (yyval.features) = single_Features((yyvsp[-1].feature)); }
-#line 1689 "cool.tab.c" /* yacc.c:1652  */
+  case 10: /* feature_list: feature ';'  */
+#line 242 "cool.y"
+    { (yyval.feature_buffer) = (new list_buffer<Feature>)->add((yyvsp[-1].feature)); }
+#line 1682 "cool.tab.c"
     break;
 
-  case 11:
-#line 196 "cool.y" /* yacc.c:1652  */
-    { (yyval.features) = append_Features(single_Features((yyvsp[-2].feature)), (yyvsp[0].features)); }
-#line 1695 "cool.tab.c" /* yacc.c:1652  */
+  case 11: /* feature_list: feature_list feature ';'  */
+#line 244 "cool.y"
+    { (yyval.feature_buffer) = (yyvsp[-2].feature_buffer)->add((yyvsp[-1].feature)); }
+#line 1688 "cool.tab.c"
     break;
 
-  case 12:
-#line 201 "cool.y" /* yacc.c:1652  */
-    { (yyval.feature) =  method((yyvsp[-8].symbol), (yyvsp[-6].formals), (yyvsp[-3].symbol), (yyvsp[-1].expression)); }
-#line 1701 "cool.tab.c" /* yacc.c:1652  */
+  case 12: /* feature: OBJECTID '(' formal_list ')' ':' TYPEID '{' expression '}'  */
+#line 249 "cool.y"
+    { (yyval.feature) =  method((yyvsp[-8].symbol), finish_list((yyvsp[-6].formal_buffer)), (yyvsp[-3].symbol), (yyvsp[-1].expression)); }
+#line 1694 "cool.tab.c"
     break;
 
-  case 13:
-#line 203 "cool.y" /* yacc.c:1652  */
+  case 13: /* feature: OBJECTID ':' TYPEID  */
+#line 251 "cool.y"
     { (yyval.feature) = attr((yyvsp[-2].symbol), (yyvsp[0].symbol), no_expr()); }
-#line 1707 "cool.tab.c" /* yacc.c:1652  */
+#line 1700 "cool.tab.c"
     break;
 
-  case 14:
-#line 205 "cool.y" /* yacc.c:1652  */
+  case 14: /* feature: OBJECTID ':' TYPEID ASSIGN expression  */
+#line 253 "cool.y"
     { (yyval.feature) = attr((yyvsp[-4].symbol), (yyvsp[-2].symbol), (yyvsp[0].expression)); }
-#line 1713 "cool.tab.c" /* yacc.c:1652  */
+#line 1706 "cool.tab.c"
     break;
 
-  case 15:
-#line 207 "cool.y" /* yacc.c:1652  */
-    { MYDEBUG(printf("feature-error-1 caught som'n\n");)	}
-#line 1719 "cool.tab.c" /* yacc.c:1652  */
+  case 15: /* feature: error  */
+#line 255 "cool.y"
+                { MYDEBUG(printf("feature-error-1 caught som'n\n");)	}
+#line 1712 "cool.tab.c"
     break;
 
-  case 16:
-#line 211 "cool.y" /* yacc.c:1652  */
-    { (yyval.formals) = nil_Formals(); }
-#line 1725 "cool.tab.c" /* yacc.c:1652  */
+  case 16: /* formal_list: %empty  */
+#line 260 "cool.y"
+                { (yyval.formal_buffer) = new list_buffer<Formal>; }
+#line 1718 "cool.tab.c"
     break;
 
-  case 17:
-#line 213 "cool.y" /* yacc.c:1652  */
-    { (yyval.formals) = single_Formals((yyvsp[0].formal)); }
-#line 1731 "cool.tab.c" /* yacc.c:1652  */
+  case 17: /* formal_list: formal_items  */
+#line 262 "cool.y"
+    { (yyval.formal_buffer) = (yyvsp[0].formal_buffer); }
+#line 1724 "cool.tab.c"
     break;
 
-  case 18:
-#line 215 "cool.y" /* yacc.c:1652  */
-    { (yyval.formals) = append_Formals(single_Formals((yyvsp[-2].formal)), (yyvsp[0].formals)); }
-#line 1737 "cool.tab.c" /* yacc.c:1652  */
+  case 18: /* formal_list: formal_items ','  */
+#line 264 "cool.y"
+    { (yyval.formal_buffer) = (yyvsp[-1].formal_buffer); }
+#line 1730 "cool.tab.c"
     break;
 
-  case 19:
-#line 219 "cool.y" /* yacc.c:1652  */
+  case 19: /* formal_items: formal  */
+#line 268 "cool.y"
+    { (yyval.formal_buffer) = (new list_buffer<Formal>)->add((yyvsp[0].formal)); }
+#line 1736 "cool.tab.c"
+    break;
+
+  case 20: /* formal_items: formal_items ',' formal  */
+#line 270 "cool.y"
+    { (yyval.formal_buffer) = (yyvsp[-2].formal_buffer)->add((yyvsp[0].formal)); }
+#line 1742 "cool.tab.c"
+    break;
+
+  case 21: /* formal: OBJECTID ':' TYPEID  */
+#line 274 "cool.y"
     { (yyval.formal) = formal((yyvsp[-2].symbol), (yyvsp[0].symbol)); }
-#line 1743 "cool.tab.c" /* yacc.c:1652  */
+#line 1748 "cool.tab.c"
+    break;
+
+  case 22: /* expression_list: expression ';'  */
+#line 278 "cool.y"
+    { (yyval.expression_buffer) = (new list_buffer<Expression>)->add((yyvsp[-1].expression)); }
+#line 1754 "cool.tab.c"
     break;
 
-  case 20:
-#line 223 "cool.y" /* yacc.c:1652  */
-    { (yyval.expressions) = single_Expressions((yyvsp[-1].expression)); }
-#line 1749 "cool.tab.c" /* yacc.c:1652  */
+  case 23: /* expression_list: expression_list expression ';'  */
+#line 280 "cool.y"
+    { (yyval.expression_buffer) = (yyvsp[-2].expression_buffer)->add((yyvsp[-1].expression)); }
+#line 1760 "cool.tab.c"
     break;
 
-  case 21:
-#line 225 "cool.y" /* yacc.c:1652  */
-    { (yyval.expressions) = append_Expressions(single_Expressions((yyvsp[-2].expression)), (yyvsp[0].expressions)); }
-#line 1755 "cool.tab.c" /* yacc.c:1652  */
+  case 24: /* expression_list: error ';'  */
+#line 282 "cool.y"
+    { (yyval.expression_buffer) = new list_buffer<Expression>;
+    MYDEBUG(printf("expression-list-error-1 caught som'n\n");) }
+#line 1767 "cool.tab.c"
     break;
 
-  case 22:
-#line 227 "cool.y" /* yacc.c:1652  */
-    { MYDEBUG(printf("expression-list-error-1 caught som'n\n");) }
-#line 1761 "cool.tab.c" /* yacc.c:1652  */
+  case 25: /* expression_list: expression_list error ';'  */
+#line 285 "cool.y"
+    { (yyval.expression_buffer) = (yyvsp[-2].expression_buffer);
+    MYDEBUG(printf("expression-list-error-2 caught som'n\n");) }
+#line 1774 "cool.tab.c"
     break;
 
-  case 23:
-#line 231 "cool.y" /* yacc.c:1652  */
-    { (yyval.expressions) = single_Expressions((yyvsp[0].expression)); }
-#line 1767 "cool.tab.c" /* yacc.c:1652  */
+  case 26: /* expression_list_as_args: expression  */
+#line 290 "cool.y"
+    { (yyval.expression_buffer) = (new list_buffer<Expression>)->add((yyvsp[0].expression)); }
+#line 1780 "cool.tab.c"
     break;
 
-  case 24:
-#line 233 "cool.y" /* yacc.c:1652  */
-    { (yyval.expressions) = append_Expressions(single_Expressions((yyvsp[-2].expression)), (yyvsp[0].expressions));}
-#line 1773 "cool.tab.c" /* yacc.c:1652  */
+  case 27: /* expression_list_as_args: expression_list_as_args ',' expression  */
+#line 292 "cool.y"
+    { (yyval.expression_buffer) = (yyvsp[-2].expression_buffer)->add((yyvsp[0].expression)); }
+#line 1786 "cool.tab.c"
     break;
 
-  case 25:
-#line 237 "cool.y" /* yacc.c:1652  */
-    { (yyval.expression) = let((yyvsp[-4].symbol), (yyvsp[-2].symbol), no_expr(), (yyvsp[0].expression)); }
-#line 1779 "cool.tab.c" /* yacc.c:1652  */
+  case 28: /* let_binding_list: let_binding  */
+#line 300 "cool.y"
+    { (yyval.binding_buffer) = (new list_buffer<Binding>)->add((yyvsp[0].binding)); }
+#line 1792 "cool.tab.c"
     break;
 
-  case 26:
-#line 239 "cool.y" /* yacc.c:1652  */
-    { (yyval.expression) = let((yyvsp[-4].symbol), (yyvsp[-2].symbol), no_expr(), (yyvsp[0].expression)); }
-#line 1785 "cool.tab.c" /* yacc.c:1652  */
+  case 29: /* let_binding_list: let_binding_list ',' let_binding  */
+#line 302 "cool.y"
+    { (yyval.binding_buffer) = (yyvsp[-2].binding_buffer)->add((yyvsp[0].binding)); }
+#line 1798 "cool.tab.c"
     break;
 
-  case 27:
-#line 241 "cool.y" /* yacc.c:1652  */
-    { (yyval.expression) = let((yyvsp[-6].symbol), (yyvsp[-4].symbol), (yyvsp[-2].expression), (yyvsp[0].expression)); }
-#line 1791 "cool.tab.c" /* yacc.c:1652  */
+  case 30: /* let_binding: OBJECTID ':' TYPEID  */
+#line 306 "cool.y"
+    { (yyval.binding) = binding((yyvsp[-2].symbol), (yyvsp[0].symbol), no_expr()); }
+#line 1804 "cool.tab.c"
     break;
 
-  case 28:
-#line 243 "cool.y" /* yacc.c:1652  */
-    { (yyval.expression) = let((yyvsp[-6].symbol), (yyvsp[-4].symbol), (yyvsp[-2].expression), (yyvsp[0].expression)); }
-#line 1797 "cool.tab.c" /* yacc.c:1652  */
+  case 31: /* let_binding: OBJECTID ':' TYPEID ASSIGN expression  */
+#line 308 "cool.y"
+    { (yyval.binding) = binding((yyvsp[-4].symbol), (yyvsp[-2].symbol), (yyvsp[0].expression)); }
+#line 1810 "cool.tab.c"
     break;
 
-  case 29:
-#line 245 "cool.y" /* yacc.c:1652  */
-    { MYDEBUG(printf("let-init-list-error-1 caught som'n\n");) }
-#line 1803 "cool.tab.c" /* yacc.c:1652  */
+  case 32: /* let_binding: error let_binding  */
+#line 310 "cool.y"
+    { (yyval.binding) = (yyvsp[0].binding);
+    MYDEBUG(printf("let-binding-error-1 caught som'n\n");) }
+#line 1817 "cool.tab.c"
     break;
 
-  case 30:
-#line 249 "cool.y" /* yacc.c:1652  */
-    { (yyval.expression) = typcase((yyvsp[-3].expression), (yyvsp[-1].cases)); }
-#line 1809 "cool.tab.c" /* yacc.c:1652  */
+  case 33: /* case_expression: CASE expression OF case_instance_list ESAC  */
+#line 315 "cool.y"
+    { (yyval.expression) = typcase((yyvsp[-3].expression), finish_list((yyvsp[-1].case_buffer))); }
+#line 1823 "cool.tab.c"
     break;
 
-  case 31:
-#line 253 "cool.y" /* yacc.c:1652  */
-    { (yyval.cases) = single_Cases((yyvsp[-1].case_)); }
-#line 1815 "cool.tab.c" /* yacc.c:1652  */
+  case 34: /* case_instance_list: case_instance ';'  */
+#line 319 "cool.y"
+    { (yyval.case_buffer) = (new list_buffer<Case>)->add((yyvsp[-1].case_)); }
+#line 1829 "cool.tab.c"
     break;
 
-  case 32:
-#line 255 "cool.y" /* yacc.c:1652  */
-    { (yyval.cases) = append_Cases(single_Cases((yyvsp[-2].case_)), (yyvsp[0].cases)); }
-#line 1821 "cool.tab.c" /* yacc.c:1652  */
+  case 35: /* case_instance_list: case_instance_list case_instance ';'  */
+#line 321 "cool.y"
+    { (yyval.case_buffer) = (yyvsp[-2].case_buffer)->add((yyvsp[-1].case_)); }
+#line 1835 "cool.tab.c"
     break;
 
-  case 33:
-#line 258 "cool.y" /* yacc.c:1652  */
+  case 36: /* case_instance: OBJECTID ':' TYPEID DARROW expression  */
+#line 325 "cool.y"
     { (yyval.case_) = branch((yyvsp[-4].symbol), (yyvsp[-2].symbol), (yyvsp[0].expression)); }
-#line 1827 "cool.tab.c" /* yacc.c:1652  */
+#line 1841 "cool.tab.c"
     break;
 
-  case 34:
-#line 260 "cool.y" /* yacc.c:1652  */
+  case 37: /* case_instance: error expression  */
+#line 327 "cool.y"
     { MYDEBUG(printf("case-instance-error-1 caught som'n\n");) }
-#line 1833 "cool.tab.c" /* yacc.c:1652  */
+#line 1847 "cool.tab.c"
     break;
 
-  case 35:
-#line 264 "cool.y" /* yacc.c:1652  */
+  case 38: /* expression: '(' expression ')'  */
+#line 331 "cool.y"
     { (yyval.expression) = (yyvsp[-1].expression); }
-#line 1839 "cool.tab.c" /* yacc.c:1652  */
+#line 1853 "cool.tab.c"
     break;
 
-  case 36:
-#line 266 "cool.y" /* yacc.c:1652  */
+  case 39: /* expression: INT_CONST  */
+#line 333 "cool.y"
     { (yyval.expression) = int_const((yyvsp[0].symbol)); }
-#line 1845 "cool.tab.c" /* yacc.c:1652  */
+#line 1859 "cool.tab.c"
     break;
 
-  case 37:
-#line 268 "cool.y" /* yacc.c:1652  */
+  case 40: /* expression: BOOL_CONST  */
+#line 335 "cool.y"
     { (yyval.expression) = bool_const((yyvsp[0].boolean)); }
-#line 1851 "cool.tab.c" /* yacc.c:1652  */
+#line 1865 "cool.tab.c"
     break;
 
-  case 38:
-#line 270 "cool.y" /* yacc.c:1652  */
+  case 41: /* expression: STR_CONST  */
+#line 337 "cool.y"
     { (yyval.expression) = string_const((yyvsp[0].symbol)); }
-#line 1857 "cool.tab.c" /* yacc.c:1652  */
+#line 1871 "cool.tab.c"
     break;
 
-  case 39:
-#line 272 "cool.y" /* yacc.c:1652  */
-    { (yyval.expression) = (yyvsp[0].expression); }
-#line 1863 "cool.tab.c" /* yacc.c:1652  */
+  case 42: /* expression: LET let_binding_list IN expression  */
+#line 339 "cool.y"
+    { SET_NODELOC((yylsp[-2])) (yyval.expression) = let(finish_list((yyvsp[-2].binding_buffer)), (yyvsp[0].expression)); }
+#line 1877 "cool.tab.c"
     break;
 
-  case 40:
-#line 274 "cool.y" /* yacc.c:1652  */
+  case 43: /* expression: OBJECTID ASSIGN expression  */
+#line 341 "cool.y"
     { (yyval.expression) = assign((yyvsp[-2].symbol), (yyvsp[0].expression)); }
-#line 1869 "cool.tab.c" /* yacc.c:1652  */
+#line 1883 "cool.tab.c"
     break;
 
-  case 41:
-#line 276 "cool.y" /* yacc.c:1652  */
+  case 44: /* expression: expression '.' OBJECTID '(' ')'  */
+#line 343 "cool.y"
     { (yyval.expression) = dispatch((yyvsp[-4].expression), (yyvsp[-2].symbol), nil_Expressions()); }
-#line 1875 "cool.tab.c" /* yacc.c:1652  */
+#line 1889 "cool.tab.c"
     break;
 
-  case 42:
-#line 278 "cool.y" /* yacc.c:1652  */
-    { (yyval.expression) = dispatch((yyvsp[-5].expression), (yyvsp[-3].symbol), (yyvsp[-1].expressions)); }
-#line 1881 "cool.tab.c" /* yacc.c:1652  */
+  case 45: /* expression: expression '.' OBJECTID '(' expression_list_as_args ')'  */
+#line 345 "cool.y"
+    { (yyval.expression) = dispatch((yyvsp[-5].expression), (yyvsp[-3].symbol), finish_list((yyvsp[-1].expression_buffer))); }
+#line 1895 "cool.tab.c"
     break;
 
-  case 43:
-#line 280 "cool.y" /* yacc.c:1652  */
+  case 46: /* expression: expression '@' TYPEID '.' OBJECTID '(' ')'  */
+#line 347 "cool.y"
     { (yyval.expression) = static_dispatch((yyvsp[-6].expression), (yyvsp[-4].symbol), (yyvsp[-2].symbol), nil_Expressions()); }
-#line 1887 "cool.tab.c" /* yacc.c:1652  */
+#line 1901 "cool.tab.c"
     break;
 
-  case 44:
-#line 282 "cool.y" /* yacc.c:1652  */
-    { (yyval.expression) = static_dispatch((yyvsp[-7].expression), (yyvsp[-5].symbol), (yyvsp[-3].symbol), (yyvsp[-1].expressions)); }
-#line 1893 "cool.tab.c" /* yacc.c:1652  */
+  case 47: /* expression: expression '@' TYPEID '.' OBJECTID '(' expression_list_as_args ')'  */
+#line 349 "cool.y"
+    { (yyval.expression) = static_dispatch((yyvsp[-7].expression), (yyvsp[-5].symbol), (yyvsp[-3].symbol), finish_list((yyvsp[-1].expression_buffer))); }
+#line 1907 "cool.tab.c"
     break;
 
-  case 45:
-#line 284 "cool.y" /* yacc.c:1652  */
+  case 48: /* expression: OBJECTID  */
+#line 351 "cool.y"
     { (yyval.expression) = object((yyvsp[0].symbol)); }
-#line 1899 "cool.tab.c" /* yacc.c:1652  */
+#line 1913 "cool.tab.c"
     break;
 
-  case 46:
-#line 286 "cool.y" /* yacc.c:1652  */
-    { (yyval.expression) = dispatch(object(idtable.add_string("self")), (yyvsp[-2].symbol), nil_Expressions()); }
-#line 1905 "cool.tab.c" /* yacc.c:1652  */
+  case 49: /* expression: OBJECTID '(' ')'  */
+#line 353 "cool.y"
+    { (yyval.expression) = dispatch(object(self_symbol), (yyvsp[-2].symbol), nil_Expressions()); }
+#line 1919 "cool.tab.c"
     break;
 
-  case 47:
-#line 288 "cool.y" /* yacc.c:1652  */
-    { (yyval.expression) = dispatch(object(idtable.add_string("self")), (yyvsp[-3].symbol), (yyvsp[-1].expressions)); }
-#line 1911 "cool.tab.c" /* yacc.c:1652  */
+  case 50: /* expression: OBJECTID '(' expression_list_as_args ')'  */
+#line 355 "cool.y"
+    { (yyval.expression) = dispatch(object(self_symbol), (yyvsp[-3].symbol), finish_list((yyvsp[-1].expression_buffer))); }
+#line 1925 "cool.tab.c"
     break;
 
-  case 48:
-#line 290 "cool.y" /* yacc.c:1652  */
+  case 51: /* expression: case_expression  */
+#line 357 "cool.y"
     { (yyval.expression) = (yyvsp[0].expression); }
-#line 1917 "cool.tab.c" /* yacc.c:1652  */
+#line 1931 "cool.tab.c"
     break;
 
-  case 49:
-#line 292 "cool.y" /* yacc.c:1652  */
+  case 52: /* expression: '{' block_expression '}'  */
+#line 359 "cool.y"
     { (yyval.expression) = block((yyvsp[-1].expressions)); }
-#line 1923 "cool.tab.c" /* yacc.c:1652  */
+#line 1937 "cool.tab.c"
     break;
 
-  case 50:
-#line 294 "cool.y" /* yacc.c:1652  */
+  case 53: /* expression: IF expression THEN expression ELSE expression FI  */
+#line 361 "cool.y"
     { (yyval.expression) = cond((yyvsp[-5].expression), (yyvsp[-3].expression), (yyvsp[-1].expression)); }
-#line 1929 "cool.tab.c" /* yacc.c:1652  */
+#line 1943 "cool.tab.c"
     break;
 
-  case 51:
-#line 296 "cool.y" /* yacc.c:1652  */
+  case 54: /* expression: WHILE expression LOOP expression POOL  */
+#line 363 "cool.y"
     { (yyval.expression) = loop((yyvsp[-3].expression), (yyvsp[-1].expression));}
-#line 1935 "cool.tab.c" /* yacc.c:1652  */
+#line 1949 "cool.tab.c"
     break;
 
-  case 52:
-#line 298 "cool.y" /* yacc.c:1652  */
+  case 55: /* expression: NEW TYPEID  */
+#line 365 "cool.y"
     { (yyval.expression) = new_((yyvsp[0].symbol)); }
-#line 1941 "cool.tab.c" /* yacc.c:1652  */
+#line 1955 "cool.tab.c"
     break;
 
-  case 53:
-#line 300 "cool.y" /* yacc.c:1652  */
+  case 56: /* expression: ISVOID expression  */
+#line 367 "cool.y"
     { (yyval.expression) = isvoid((yyvsp[0].expression)); }
-#line 1947 "cool.tab.c" /* yacc.c:1652  */
+#line 1961 "cool.tab.c"
     break;
 
-  case 54:
-#line 302 "cool.y" /* yacc.c:1652  */
+  case 57: /* expression: expression '+' expression  */
+#line 369 "cool.y"
     { (yyval.expression) = plus((yyvsp[-2].expression), (yyvsp[0].expression));}
-#line 1953 "cool.tab.c" /* yacc.c:1652  */
+#line 1967 "cool.tab.c"
     break;
 
-  case 55:
-#line 304 "cool.y" /* yacc.c:1652  */
+  case 58: /* expression: expression '-' expression  */
+#line 371 "cool.y"
     { (yyval.expression) = sub((yyvsp[-2].expression), (yyvsp[0].expression)); }
-#line 1959 "cool.tab.c" /* yacc.c:1652  */
+#line 1973 "cool.tab.c"
     break;
 
-  case 56:
-#line 306 "cool.y" /* yacc.c:1652  */
+  case 59: /* expression: expression '*' expression  */
+#line 373 "cool.y"
     { (yyval.expression) = mul((yyvsp[-2].expression), (yyvsp[0].expression));  }
-#line 1965 "cool.tab.c" /* yacc.c:1652  */
+#line 1979 "cool.tab.c"
     break;
 
-  case 57:
-#line 308 "cool.y" /* yacc.c:1652  */
+  case 60: /* expression: expression '/' expression  */
+#line 375 "cool.y"
     { (yyval.expression) = divide((yyvsp[-2].expression), (yyvsp[0].expression)); }
-#line 1971 "cool.tab.c" /* yacc.c:1652  */
+#line 1985 "cool.tab.c"
     break;
 
-  case 58:
-#line 310 "cool.y" /* yacc.c:1652  */
+  case 61: /* expression: '~' expression  */
+#line 377 "cool.y"
     { (yyval.expression) = neg((yyvsp[0].expression)); }
-#line 1977 "cool.tab.c" /* yacc.c:1652  */
+#line 1991 "cool.tab.c"
     break;
 
-  case 59:
-#line 312 "cool.y" /* yacc.c:1652  */
+  case 62: /* expression: expression '<' expression  */
+#line 379 "cool.y"
     { (yyval.expression) = lt((yyvsp[-2].expression), (yyvsp[0].expression));}
-#line 1983 "cool.tab.c" /* yacc.c:1652  */
+#line 1997 "cool.tab.c"
     break;
 
-  case 60:
-#line 314 "cool.y" /* yacc.c:1652  */
+  case 63: /* expression: expression LE expression  */
+#line 381 "cool.y"
     { (yyval.expression) = leq((yyvsp[-2].expression), (yyvsp[0].expression)); }
-#line 1989 "cool.tab.c" /* yacc.c:1652  */
+#line 2003 "cool.tab.c"
     break;
 
-  case 61:
-#line 316 "cool.y" /* yacc.c:1652  */
+  case 64: /* expression: NOT expression  */
+#line 383 "cool.y"
     { (yyval.expression) = comp((yyvsp[0].expression)); }
-#line 1995 "cool.tab.c" /* yacc.c:1652  */
+#line 2009 "cool.tab.c"
     break;
 
-  case 62:
-#line 318 "cool.y" /* yacc.c:1652  */
+  case 65: /* expression: expression '=' expression  */
+#line 385 "cool.y"
     { (yyval.expression) = eq((yyvsp[-2].expression), (yyvsp[0].expression)); }
-#line 2001 "cool.tab.c" /* yacc.c:1652  */
+#line 2015 "cool.tab.c"
     break;
 
-  case 63:
-#line 322 "cool.y" /* yacc.c:1652  */
-    { (yyval.expressions) = (yyvsp[0].expressions);	}
-#line 2007 "cool.tab.c" /* yacc.c:1652  */
+  case 66: /* block_expression: expression_list  */
+#line 389 "cool.y"
+                { (yyval.expressions) = finish_list((yyvsp[0].expression_buffer));	}
+#line 2021 "cool.tab.c"
     break;
 
 
-#line 2011 "cool.tab.c" /* yacc.c:1652  */
+#line 2025 "cool.tab.c"
+
       default: break;
     }
   /* User semantic actions sometimes alter yychar, and that requires
@@ -2021,11 +2036,10 @@ yyreduce:
      case of YYERROR or YYBACKUP, subsequent parser actions might lead
      to an incorrect destructor call or verbose syntax error message
      before the lookahead is translated.  */
-  YY_SYMBOL_PRINT ("-> $$ =", yyr1[yyn], &yyval, &yyloc);
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
 
   YYPOPSTACK (yylen);
   yylen = 0;
-  YY_STACK_PRINT (yyss, yyssp);
 
   *++yyvsp = yyval;
   *++yylsp = yyloc;
@@ -2050,50 +2064,15 @@ yyreduce:
 yyerrlab:
   /* Make sure we have latest lookahead translation.  See comments at
      user semantic actions for why this is necessary.  */
-  yytoken = yychar == YYEMPTY ? YYEMPTY : YYTRANSLATE (yychar);
-
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
   /* If not already recovering from an error, report this error.  */
   if (!yyerrstatus)
     {
       ++yynerrs;
-#if ! YYERROR_VERBOSE
-      yyerror (YY_("syntax error"));
-#else
-# define YYSYNTAX_ERROR yysyntax_error (&yymsg_alloc, &yymsg, \
-                                        yyssp, yytoken)
-      {
-        char const *yymsgp = YY_("syntax error");
-        int yysyntax_error_status;
-        yysyntax_error_status = YYSYNTAX_ERROR;
-        if (yysyntax_error_status == 0)
-          yymsgp = yymsg;
-        else if (yysyntax_error_status == 1)
-          {
-            if (yymsg != yymsgbuf)
-              YYSTACK_FREE (yymsg);
-            yymsg = (char *) YYSTACK_ALLOC (yymsg_alloc);
-            if (!yymsg)
-              {
-                yymsg = yymsgbuf;
-                yymsg_alloc = sizeof yymsgbuf;
-                yysyntax_error_status = 2;
-              }
-            else
-              {
-                yysyntax_error_status = YYSYNTAX_ERROR;
-                yymsgp = yymsg;
-              }
-          }
-        yyerror (yymsgp);
-        if (yysyntax_error_status == 2)
-          goto yyexhaustedlab;
-      }
-# undef YYSYNTAX_ERROR
-#endif
+      yyerror (&yylloc, ctx, YY_("syntax error"));
     }
 
   yyerror_range[1] = yylloc;
-
   if (yyerrstatus == 3)
     {
       /* If just tried and failed to reuse lookahead token after an
@@ -2108,7 +2087,7 @@ yyerrlab:
       else
         {
           yydestruct ("Error: discarding",
-                      yytoken, &yylval, &yylloc);
+                      yytoken, &yylval, &yylloc, ctx);
           yychar = YYEMPTY;
         }
     }
@@ -2126,6 +2105,7 @@ yyerrorlab:
      label yyerrorlab therefore never appears in user code.  */
   if (0)
     YYERROR;
+  ++yynerrs;
 
   /* Do not reclaim the symbols of the rule whose action triggered
      this YYERROR.  */
@@ -2142,13 +2122,14 @@ yyerrorlab:
 yyerrlab1:
   yyerrstatus = 3;      /* Each real token shifted decrements this.  */
 
+  /* Pop stack until we find a state that shifts the error token.  */
   for (;;)
     {
       yyn = yypact[yystate];
       if (!yypact_value_is_default (yyn))
         {
-          yyn += YYTERROR;
-          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYTERROR)
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
             {
               yyn = yytable[yyn];
               if (0 < yyn)
@@ -2162,7 +2143,7 @@ yyerrlab1:
 
       yyerror_range[1] = *yylsp;
       yydestruct ("Error: popping",
-                  yystos[yystate], yyvsp, yylsp);
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp, yylsp, ctx);
       YYPOPSTACK (1);
       yystate = *yyssp;
       YY_STACK_PRINT (yyss, yyssp);
@@ -2173,13 +2154,11 @@ yyerrlab1:
   YY_IGNORE_MAYBE_UNINITIALIZED_END
 
   yyerror_range[2] = yylloc;
-  /* Using YYLLOC is tempting, but would change the location of
-     the lookahead.  YYLOC is available though.  */
-  YYLLOC_DEFAULT (yyloc, yyerror_range, 2);
-  *++yylsp = yyloc;
+  ++yylsp;
+  YYLLOC_DEFAULT (*yylsp, yyerror_range, 2);
 
   /* Shift the error token.  */
-  YY_SYMBOL_PRINT ("Shifting", yystos[yyn], yyvsp, yylsp);
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
 
   yystate = yyn;
   goto yynewstate;
@@ -2190,7 +2169,7 @@ yyerrlab1:
 `-------------------------------------*/
 yyacceptlab:
   yyresult = 0;
-  goto yyreturn;
+  goto yyreturnlab;
 
 
 /*-----------------------------------.
@@ -2198,31 +2177,29 @@ yyacceptlab:
 `-----------------------------------*/
 yyabortlab:
   yyresult = 1;
-  goto yyreturn;
+  goto yyreturnlab;
 
 
-#if !defined yyoverflow || YYERROR_VERBOSE
-/*-------------------------------------------------.
-| yyexhaustedlab -- memory exhaustion comes here.  |
-`-------------------------------------------------*/
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
 yyexhaustedlab:
-  yyerror (YY_("memory exhausted"));
+  yyerror (&yylloc, ctx, YY_("memory exhausted"));
   yyresult = 2;
-  /* Fall through.  */
-#endif
+  goto yyreturnlab;
 
 
-/*-----------------------------------------------------.
-| yyreturn -- parsing is finished, return the result.  |
-`-----------------------------------------------------*/
-yyreturn:
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
   if (yychar != YYEMPTY)
     {
       /* Make sure we have latest lookahead translation.  See comments at
          user semantic actions for why this is necessary.  */
       yytoken = YYTRANSLATE (yychar);
       yydestruct ("Cleanup: discarding lookahead",
-                  yytoken, &yylval, &yylloc);
+                  yytoken, &yylval, &yylloc, ctx);
     }
   /* Do not reclaim the symbols of the rule whose action triggered
      this YYABORT or YYACCEPT.  */
@@ -2231,32 +2208,248 @@ yyreturn:
   while (yyssp != yyss)
     {
       yydestruct ("Cleanup: popping",
-                  yystos[*yyssp], yyvsp, yylsp);
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp, yylsp, ctx);
       YYPOPSTACK (1);
     }
-#ifndef yyoverflow
-  if (yyss != yyssa)
-    YYSTACK_FREE (yyss);
-#endif
-#if YYERROR_VERBOSE
-  if (yymsg != yymsgbuf)
-    YYSTACK_FREE (yymsg);
-#endif
+  yyps->yynew = 2;
+  goto yypushreturn;
+
+
+/*-------------------------.
+| yypushreturn -- return.  |
+`-------------------------*/
+yypushreturn:
+
   return yyresult;
 }
-#line 325 "cool.y" /* yacc.c:1918  */
+#undef cool_yynerrs
+#undef yystate
+#undef yyerrstatus
+#undef yyssa
+#undef yyss
+#undef yyssp
+#undef yyvsa
+#undef yyvs
+#undef yyvsp
+#undef yylsa
+#undef yyls
+#undef yylsp
+#undef yystacksize
+#line 392 "cool.y"
 
 
     /* This function is called automatically when Bison detects a parse error. */
-    void yyerror(char *s)
+    void yyerror(YYLTYPE *loc, ParserContext *ctx, char *s)
     {
-      extern int curr_lineno;
+      ostream& err = ctx->messages ? *ctx->messages : cerr;
       
-      cerr << "\"" << curr_filename << "\", line " << curr_lineno << ": " \
+      err << "\"" << ctx->filename << "\", line " << *loc << ": " \
       << s << " at or near ";
-      print_cool_token(yychar);
-      cerr << endl;
-      omerrs++;
+      print_cool_token(err, ctx->token, *ctx->lval);
+      err << endl;
+      ctx->errors++;
+      
+      if(ctx->messages == NULL && ctx->errors>MAX_PARSE_ERRORS) {
+        fprintf(stdout, "More than %d errors\n", MAX_PARSE_ERRORS); exit(1);
+      }
+    }
+    
+    /* The symbols the actions use are entered before the first token is
+    read, while no other thread can be using the string tables. */
+    static void init_parse_symbols()
+    {
+      if (Object_symbol == NULL) {
+        Object_symbol = idtable.add_string("Object");
+        self_symbol = idtable.add_string("self");
+      }
+    }
+    
+    /* Returns the symbol of the file name the token source last set.  It
+    runs on the thread that calls the token source. */
+    static Symbol filename_symbol()
+    {
+      static char *name = NULL;
+      static Symbol symbol = NULL;
+      if (curr_filename != name) {
+        name = curr_filename;
+        symbol = stringtable.add_string(curr_filename);
+      }
+      return symbol;
+    }
+    
+    /* Records the token about to be passed to the parser; yyerror reports
+    it.  lvalp must stay valid while the parser works on the token. */
+    static void note_token(ParserContext *ctx, int token, YYSTYPE *lvalp,
+    Symbol filename)
+    {
+      ctx->token = token;
+      ctx->lval = lvalp;
+      ctx->filename = filename;
+    }
+    
+    /* yylex of the pull parser, cool_yyparse. */
+    static int cool_next_token(YYSTYPE *lvalp, YYLTYPE *llocp,
+    ParserContext *ctx)
+    {
+      int token = (*cool_token_source)();
+      *lvalp = cool_yylval;
+      *llocp = curr_lineno;
+      note_token(ctx, token, lvalp, filename_symbol());
+      return token;
+    }
+    
+    /* A token with everything the parser needs to know about it, for
+    parsing on a thread other than the one that scanned it. */
+    struct QueuedToken {
+      int token;
+      YYSTYPE lval;
+      YYLTYPE lloc;
+      Symbol filename;
+    };
+    
+    static void scan_token(QueuedToken& t)
+    {
+      t.token = (*cool_token_source)();
+      t.lval = cool_yylval;
+      t.lloc = curr_lineno;
+      t.filename = filename_symbol();
+    }
+    
+    /* Pushes t into the parser ps and returns the push status. */
+    static int push_token(yypstate *ps, QueuedToken& t, ParserContext *ctx)
+    {
+      note_token(ctx, t.token, &t.lval, t.filename);
+      return yypush_parse(ps, t.token, &t.lval, &t.lloc, ctx);
+    }
+    
+    /* cool_yyparse_pipelined parses like cool_yyparse, but runs the token
+    source on a thread of its own.  That thread passes each token, with
+    its value, line and file, through a TokenQueue to this one, which
+    pushes it into the parser.  A token source that gives up on a
+    malformed stream exits from its own thread, so it may do so before
+    the parser has reported errors in the tokens ahead of it. */
+    static void lex_into(TokenQueue<QueuedToken> *queue)
+    {
+      TRACE_SCOPE("pass", "scan");
+      QueuedToken t;
+      do {
+        scan_token(t);
+        queue->push(t);
+      } while (t.token != 0);
+    }
+    
+    int cool_yyparse_pipelined(ParserContext *ctx)
+    {
+      init_parse_symbols();
+      TokenQueue<QueuedToken> *queue = new TokenQueue<QueuedToken>;
+      std::thread lexer(lex_into, queue);
+      
+      yypstate *ps = yypstate_new();
+      QueuedToken t;
+      int status;
+      do {
+        t = queue->pop();
+        status = push_token(ps, t, ctx);
+      } while (status == YYPUSH_MORE);
+      
+      /* the parse can stop before the end of the input */
+      while (t.token != 0)
+      t = queue->pop();
+      lexer.join();
       
-      if(omerrs>50) {fprintf(stdout, "More than 50 errors\n"); exit(1);}
+      yypstate_delete(ps);
+      delete queue;
+      return status;
+    }
+    
+    /* cool_yyparse_files scans the whole token stream first, splitting it
+    where the file name changes, and then parses the files on `jobs'
+    threads, each file with a context of its own.  The classes are put
+    together in file order and the error messages, which each context
+    keeps to itself, are printed in file order once all files are
+    parsed, so neither depends on how the threads were scheduled.  Since
+    every file ends its own parse, an error at the end of one file is
+    no longer recovered from in the next one. */
+    typedef std::vector<QueuedToken> TokenList;
+    
+    static void parse_file(TokenList *tokens, ParserContext *ctx)
+    {
+      TRACE_SCOPE("parse file", (*tokens)[0].filename->get_string());
+      yypstate *ps = yypstate_new();
+      int status = YYPUSH_MORE;
+      for (size_t i = 0; status == YYPUSH_MORE && i < tokens->size(); i++) {
+        status = push_token(ps, (*tokens)[i], ctx);
+        if (ctx->errors > MAX_PARSE_ERRORS)
+        break;
+      }
+      yypstate_delete(ps);
+    }
+    
+    int cool_yyparse_files(ParserContext *ctx, int jobs)
+    {
+      init_parse_symbols();
+      
+      std::vector<TokenList *> files;
+      QueuedToken t;
+      {
+        TRACE_SCOPE("pass", "scan");
+        for (scan_token(t); t.token != 0; scan_token(t)) {
+          if (files.empty() || t.filename != files.back()->back().filename)
+          files.push_back(new TokenList);
+          files.back()->push_back(t);
+        }
+      }
+      /* every file ends with an end of input at its last line; the last
+      file, or an empty stream, gets the real one */
+      for (size_t i = 0; i + 1 < files.size(); i++) {
+        QueuedToken end = files[i]->back();
+        end.token = 0;
+        files[i]->push_back(end);
+      }
+      if (files.empty())
+      files.push_back(new TokenList);
+      files.back()->push_back(t);
+      
+      std::vector<ParserContext> contexts(files.size());
+      for (size_t i = 0; i < files.size(); i++)
+      contexts[i].messages = new std::ostringstream;
+      
+      std::atomic<size_t> next_file(0);
+      auto worker = [&]() {
+        for (size_t i = next_file++; i < files.size(); i = next_file++)
+        parse_file(files[i], &contexts[i]);
+      };
+      std::vector<std::thread> threads;
+      for (int j = 1; j < jobs; j++)
+      threads.push_back(std::thread(worker));
+      worker();
+      for (size_t j = 0; j < threads.size(); j++)
+      threads[j].join();
+      
+      list_buffer<Class_> *classes = new list_buffer<Class_>;
+      for (size_t i = 0; i < files.size(); i++) {
+        std::istringstream messages(contexts[i].messages->str());
+        std::string line;
+        while (std::getline(messages, line)) {
+          cerr << line << endl;
+          if (++ctx->errors > MAX_PARSE_ERRORS) {
+            fprintf(stdout, "More than %d errors\n", MAX_PARSE_ERRORS);
+            exit(1);
+          }
+        }
+        /* a file with errors may have left junk in its class list */
+        if (contexts[i].errors == 0)
+        for (int c = 0; c < contexts[i].classes->len(); c++)
+        classes->add(contexts[i].classes->nth(c));
+        ctx->filename = contexts[i].filename;
+        delete contexts[i].messages;
+        delete files[i];
+      }
+      
+      ctx->classes = finish_list(classes);
+      if (ctx->errors == 0) {
+        node_lineno = contexts[0].program->get_line_number();
+        ctx->program = program(ctx->classes);
+      }
+      return ctx->errors == 0 ? 0 : 1;
     }
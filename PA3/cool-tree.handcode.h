@@ -20,6 +20,7 @@ void dump_Symbol(ostream& stream, int padding, Symbol b);
 void assert_Symbol(Symbol b);
 Symbol copy_Symbol(Symbol b);
 
+class AstStreamWriter;
 class Program_class;
 typedef Program_class *Program;
 class Class__class;
@@ -32,6 +33,8 @@ class Expression_class;
 typedef Expression_class *Expression;
 class Case_class;
 typedef Case_class *Case;
+class Binding_class;
+typedef Binding_class *Binding;
 
 typedef list_node<Class_> Classes_class;
 typedef Classes_class *Classes;
@@ -43,50 +46,75 @@ typedef list_node<Expression> Expressions_class;
 typedef Expressions_class *Expressions;
 typedef list_node<Case> Cases_class;
 typedef Cases_class *Cases;
+typedef list_node<Binding> Bindings_class;
+typedef Bindings_class *Bindings;
 
 #define Program_EXTRAS                          \
-virtual void dump_with_types(ostream&, int) = 0; 
+virtual void dump_with_types(ostream&, int) = 0; \
+virtual void dump_binary(ostream&) = 0;
 
 
 
 #define program_EXTRAS                          \
-void dump_with_types(ostream&, int);            
+void dump_with_types(ostream&, int); \
+void dump_binary(ostream&);          \
+void write_binary(AstStreamWriter&);
 
 #define Class__EXTRAS                   \
 virtual Symbol get_filename() = 0;      \
-virtual void dump_with_types(ostream&,int) = 0; 
+virtual void dump_with_types(ostream&,int) = 0; \
+virtual void write_binary(AstStreamWriter&) = 0;
 
 
 #define class__EXTRAS                                 \
 Symbol get_filename() { return filename; }             \
-void dump_with_types(ostream&,int);                    
+void dump_with_types(ostream&,int);        \
+void write_binary(AstStreamWriter&);
 
 
 #define Feature_EXTRAS                                        \
-virtual void dump_with_types(ostream&,int) = 0; 
+virtual void dump_with_types(ostream&,int) = 0; \
+virtual void write_binary(AstStreamWriter&) = 0;
 
 
 #define Feature_SHARED_EXTRAS                                       \
-void dump_with_types(ostream&,int);    
+void dump_with_types(ostream&,int); \
+void write_binary(AstStreamWriter&);
 
 
 
 
 
 #define Formal_EXTRAS                              \
-virtual void dump_with_types(ostream&,int) = 0;
+virtual void dump_with_types(ostream&,int) = 0; \
+virtual void write_binary(AstStreamWriter&) = 0;
 
 
 #define formal_EXTRAS                           \
-void dump_with_types(ostream&,int);
+void dump_with_types(ostream&,int); \
+void write_binary(AstStreamWriter&);
 
 
 #define Case_EXTRAS                             \
-virtual void dump_with_types(ostream& ,int) = 0;
+virtual void dump_with_types(ostream& ,int) = 0; \
+virtual void write_binary(AstStreamWriter&) = 0;
 
 
 #define branch_EXTRAS                                   \
-void dump_with_types(ostream& ,int);
+void dump_with_types(ostream& ,int); \
+void write_binary(AstStreamWriter&);
+
+
+#define Binding_EXTRAS                          \
+virtual void dump_with_types(ostream& ,int) = 0; \
+virtual void dump_fields_with_types(ostream& ,int) = 0; \
+virtual void write_binary(AstStreamWriter&) = 0;
+
+
+#define binding_EXTRAS                                  \
+void dump_with_types(ostream& ,int);                    \
+void dump_fields_with_types(ostream& ,int); \
+void write_binary(AstStreamWriter&);
 
 
 #define Expression_EXTRAS                    \
@@ -95,12 +123,14 @@ Symbol get_type() { return type; }           \
 Expression set_type(Symbol s) { type = s; return this; } \
 virtual void dump_with_types(ostream&,int) = 0;  \
 void dump_type(ostream&, int);               \
-Expression_class() { type = (Symbol) NULL; }
+Expression_class() { type = (Symbol) NULL; }             \
+virtual void write_binary(AstStreamWriter&) = 0;
 
 
 
 #define Expression_SHARED_EXTRAS           \
-void dump_with_types(ostream&,int); 
+void dump_with_types(ostream&,int); \
+void write_binary(AstStreamWriter&);
 
 
 #endif
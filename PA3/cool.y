@@ -5,9 +5,15 @@
 */
 %{
   #include <iostream>
+  #include <sstream>
+  #include <string>
+  #include <vector>
   #include "cool-tree.h"
   #include "stringtab.h"
   #include "utilities.h"
+  #include "token-queue.h"
+  #include "parser-context.h"
+  #include "trace.h"
   
   extern char *curr_filename;
   //#define IN_DEBUG
@@ -21,9 +27,10 @@
   #define cool_yylloc curr_lineno  /* use the curr_lineno from the lexer
   for the location of tokens */
     
-    extern int node_lineno;          /* set before constructing a tree node
+    extern thread_local int node_lineno; /* set before constructing a tree node
     to whatever you want the line number
-    for the tree node to be */
+    for the tree node to be; one per thread,
+    see cool_yyparse_files */
       
       
       #define YYLLOC_DEFAULT(Current, Rhs, N)         \
@@ -78,15 +85,18 @@
     
     
     
-    void yyerror(char *s);        /*  defined below; called for each parse error */
+    void yyerror(YYLTYPE *loc, ParserContext *ctx, char *s); /* defined below; called for each parse error */
     extern int yylex();           /*  the entry point to the lexer  */
     
-    /************************************************************************/
-    /*                DONT CHANGE ANYTHING IN THIS SECTION                  */
+    /* The parser pulls its tokens through cool_token_source.  It is the
+    text token scanner unless parser-phase.cc finds a binary token stream
+    on its input (see token-stream.h). */
+    int (*cool_token_source)() = yylex;
+    #undef yylex
     
-    Program ast_root;	      /* the result of the parse  */
-    Classes parse_results;        /* for use in semantic analysis */
-    int omerrs = 0;               /* number of errors in lexing and parsing */
+    /* The result of the parse and the number of errors, which used to be
+    the globals ast_root, parse_results and omerrs, are kept in the
+    ParserContext (parser-context.h) passed to the parser. */
     %}
     
     /* A union of all the types that can be the result of parsing actions. */
@@ -105,6 +115,43 @@
       Expression expression;
       Expressions expressions;
       char *error_msg;
+      list_buffer<Class_> *class_buffer;
+      list_buffer<Feature> *feature_buffer;
+      list_buffer<Formal> *formal_buffer;
+      list_buffer<Case> *case_buffer;
+      list_buffer<Expression> *expression_buffer;
+      Binding binding;
+      list_buffer<Binding> *binding_buffer;
+    }
+    
+    /* The parser is pure: the lookahead and its value live in the parser
+    state and everything else in the ParserContext, so that with -P
+    (cool_yyparse_pipelined below) tokens can be reduced on one thread
+    while the token source keeps updating cool_yylval, curr_lineno and
+    curr_filename on another, and with -j (cool_yyparse_files) several
+    files can be parsed at once.  The actions and yyerror therefore read
+    only the context and never enter strings in the string tables. */
+    %define api.pure full
+    %define api.push-pull both
+    %param { ParserContext *ctx }
+    %initial-action { init_parse_symbols(); }
+    
+    %code {
+      YYSTYPE cool_yylval;          /* value of the token last scanned */
+      int curr_lineno;              /* and its line; the impure parser got
+      this from cool_yylloc */
+      
+      static Symbol Object_symbol;  /* entered by init_parse_symbols */
+      static Symbol self_symbol;
+      
+      static void init_parse_symbols();
+      static int cool_next_token(YYSTYPE *lvalp, YYLTYPE *llocp,
+      ParserContext *ctx);
+      #define yylex cool_next_token
+      #define MAX_PARSE_ERRORS 50   /* give up after this many */
+      
+      /* utilities.cc */
+      extern void print_cool_token(ostream& out, int tok, YYSTYPE yylval);
     }
     
     /* 
@@ -135,20 +182,22 @@
     
     /* Declare types for the grammar's non-terminals. */
     %type <program> program
-    %type <classes> class_list
+    %type <class_buffer> class_list
     %type <class_> class
     %type <feature> feature
-    %type <features> feature_list
+    %type <feature_buffer> feature_list
     %type <expression> expression
-    %type <expression> let_init_list
+    %type <binding_buffer> let_binding_list
+    %type <binding> let_binding
     %type <expression> case_expression
 		%type <expressions> block_expression
-    %type <expressions> expression_list
-    %type <expressions> expression_list_as_args
+    %type <expression_buffer> expression_list
+    %type <expression_buffer> expression_list_as_args
     %type <formal> formal
-    %type <formals> formal_list
+    %type <formal_buffer> formal_list
+    %type <formal_buffer> formal_items
     %type <case_> case_instance
-    %type <cases> case_instance_list
+    %type <case_buffer> case_instance_list
     
     /* Precedence declarations go here. */
     %right ASSIGN
@@ -161,44 +210,43 @@
    
     %%
     /* 
-    Save the root of the abstract syntax tree in a global variable.
+    Save the root of the abstract syntax tree in the parser context.
     */
-    program	: class_list	{ @$ = @1; ast_root = program($1); }
+    program	: class_list
+    { @$ = @1; ctx->classes = finish_list($1); ctx->program = program(ctx->classes); }
     ;
     
+    /* The list rules are left-recursive, so that the parser stack does
+    not grow with the length of a list.  They add the elements to a
+    list_buffer (tree.h), which the rule using the list finishes. */
     class_list : class			/* single class */
-    { $$ = single_Classes($1);
-    parse_results = $$; }
+    { $$ = (new list_buffer<Class_>)->add($1); }
     | class_list class	/* several classes */
-    { $$ = append_Classes($1,single_Classes($2)); 
-    parse_results = $$; }
+    { $$ = $1->add($2); }
     ;
     
     /* If no parent is specified, the class inherits from the Object class. */
     class	: CLASS TYPEID '{' feature_list '}' ';'
-    { $$ = class_($2, idtable.add_string("Object"), $4,
-    stringtable.add_string(curr_filename)); }
+    { $$ = class_($2, Object_symbol, finish_list($4), ctx->filename); }
     | CLASS TYPEID INHERITS TYPEID '{' feature_list '}' ';'
-    { $$ = class_($2, $4, $6, stringtable.add_string(curr_filename)); }
+    { $$ = class_($2, $4, finish_list($6), ctx->filename); }
     | CLASS TYPEID '{' '}' ';'
-    { $$ = class_($2, idtable.add_string("Object"), nil_Features(),
-    stringtable.add_string(curr_filename));}
+    { $$ = class_($2, Object_symbol, nil_Features(), ctx->filename); }
     | CLASS TYPEID INHERITS TYPEID '{' '}' ';'
-    { $$ = class_($2, $4, nil_Features(),
-    stringtable.add_string(curr_filename));}
+    { $$ = class_($2, $4, nil_Features(), ctx->filename); }
     | error
 		{ MYDEBUG(printf("class-error-1 caught som'n\n");)}
     ;
     
     feature_list : feature ';'
-    { $$ = single_Features($1); }
-    | feature ';' feature_list
-    { $$ = append_Features(single_Features($1), $3); }
+    { $$ = (new list_buffer<Feature>)->add($1); }
+    | feature_list feature ';'
+    { $$ = $1->add($2); }
     ;
 
     /* Feature list may be empty, but no empty features in list. */
     feature : OBJECTID '(' formal_list ')' ':' TYPEID '{' expression '}'
-    { $$ =  method($1, $3, $6, $8); }
+    { $$ =  method($1, finish_list($3), $6, $8); }
     | OBJECTID ':' TYPEID
     { $$ = attr($1, $3, no_expr()); }
     | OBJECTID ':' TYPEID ASSIGN expression
@@ -207,12 +255,19 @@
 		{ MYDEBUG(printf("feature-error-1 caught som'n\n");)	}
     ;
 
+    /* A trailing comma is accepted, as it always has been. */
     formal_list :
-		{ $$ = nil_Formals(); }
-		| formal
-    { $$ = single_Formals($1); }
-    | formal ',' formal_list
-    { $$ = append_Formals(single_Formals($1), $3); }
+		{ $$ = new list_buffer<Formal>; }
+		| formal_items
+    { $$ = $1; }
+    | formal_items ','
+    { $$ = $1; }
+    ;
+
+    formal_items : formal
+    { $$ = (new list_buffer<Formal>)->add($1); }
+    | formal_items ',' formal
+    { $$ = $1->add($3); }
     ;
 
     formal : OBJECTID ':' TYPEID
@@ -220,39 +275,51 @@
     ;
     
     expression_list : expression ';'
-    { $$ = single_Expressions($1); }
-    | expression ';' expression_list
-    { $$ = append_Expressions(single_Expressions($1), $3); }
-    | error ';' expression_list
-    { MYDEBUG(printf("expression-list-error-1 caught som'n\n");) }
+    { $$ = (new list_buffer<Expression>)->add($1); }
+    | expression_list expression ';'
+    { $$ = $1->add($2); }
+    | error ';'
+    { $$ = new list_buffer<Expression>;
+    MYDEBUG(printf("expression-list-error-1 caught som'n\n");) }
+    | expression_list error ';'
+    { $$ = $1;
+    MYDEBUG(printf("expression-list-error-2 caught som'n\n");) }
     ;
 
     expression_list_as_args : expression
-    { $$ = single_Expressions($1); }
-    | expression ',' expression_list_as_args
-    { $$ = append_Expressions(single_Expressions($1), $3);}
+    { $$ = (new list_buffer<Expression>)->add($1); }
+    | expression_list_as_args ',' expression
+    { $$ = $1->add($3); }
     ;
 
-    let_init_list : OBJECTID ':' TYPEID IN expression
-    { $$ = let($1, $3, no_expr(), $5); }
-    | OBJECTID ':' TYPEID ',' let_init_list
-    { $$ = let($1, $3, no_expr(), $5); }
-    | OBJECTID ':' TYPEID ASSIGN expression IN expression
-    { $$ = let($1, $3, $5, $7); }
-    | OBJECTID ':' TYPEID ASSIGN expression ',' let_init_list
-    { $$ = let($1, $3, $5, $7); }
-    | error let_init_list
-    { MYDEBUG(printf("let-init-list-error-1 caught som'n\n");) }
+    /* All the bindings of a let go into one let node, which gets the
+    line of the first binding, as the outermost of the nested lets it
+    replaces did.  After an error, as with the old nested lets, the
+    parser skips to the next thing that reads as a binding. */
+    let_binding_list : let_binding
+    { $$ = (new list_buffer<Binding>)->add($1); }
+    | let_binding_list ',' let_binding
+    { $$ = $1->add($3); }
+    ;
+
+    let_binding : OBJECTID ':' TYPEID
+    { $$ = binding($1, $3, no_expr()); }
+    | OBJECTID ':' TYPEID ASSIGN expression
+    { $$ = binding($1, $3, $5); }
+    | error let_binding
+    { $$ = $2;
+    MYDEBUG(printf("let-binding-error-1 caught som'n\n");) }
     ;
 
     case_expression : CASE expression OF case_instance_list ESAC
-    { $$ = typcase($2, $4); }
+    { $$ = typcase($2, finish_list($4)); }
     ;
 
     case_instance_list : case_instance ';'
-    { $$ = single_Cases($1); }
-    | case_instance ';' case_instance_list
-    { $$ = append_Cases(single_Cases($1), $3); }
+    { $$ = (new list_buffer<Case>)->add($1); }
+    | case_instance_list case_instance ';'
+    { $$ = $1->add($2); }
+    ;
 
     case_instance : OBJECTID ':' TYPEID DARROW expression
     { $$ = branch($1, $3, $5); }
@@ -268,24 +335,24 @@
     { $$ = bool_const($1); }
     | STR_CONST
     { $$ = string_const($1); } 
-    | LET let_init_list
-    { $$ = $2; }
+    | LET let_binding_list IN expression
+    { SET_NODELOC(@2) $$ = let(finish_list($2), $4); }
     | OBJECTID ASSIGN expression
     { $$ = assign($1, $3); }
     | expression '.' OBJECTID '(' ')'
     { $$ = dispatch($1, $3, nil_Expressions()); }
     | expression '.' OBJECTID '(' expression_list_as_args ')'
-    { $$ = dispatch($1, $3, $5); }
+    { $$ = dispatch($1, $3, finish_list($5)); }
     | expression '@' TYPEID '.' OBJECTID '(' ')'
     { $$ = static_dispatch($1, $3, $5, nil_Expressions()); }
     | expression '@' TYPEID '.' OBJECTID '(' expression_list_as_args ')'
-    { $$ = static_dispatch($1, $3, $5, $7); }
+    { $$ = static_dispatch($1, $3, $5, finish_list($7)); }
     | OBJECTID
     { $$ = object($1); }
     | OBJECTID '(' ')'
-    { $$ = dispatch(object(idtable.add_string("self")), $1, nil_Expressions()); }
+    { $$ = dispatch(object(self_symbol), $1, nil_Expressions()); }
     | OBJECTID '(' expression_list_as_args ')'
-    { $$ = dispatch(object(idtable.add_string("self")), $1, $3); }
+    { $$ = dispatch(object(self_symbol), $1, finish_list($3)); }
     | case_expression
     { $$ = $1; }
     | '{' block_expression '}'
@@ -319,21 +386,223 @@
     ;
 
 		block_expression : expression_list
-		{ $$ = $1;	}
+		{ $$ = finish_list($1);	}
     ;
     /* end of grammar */
     %%
 
     /* This function is called automatically when Bison detects a parse error. */
-    void yyerror(char *s)
+    void yyerror(YYLTYPE *loc, ParserContext *ctx, char *s)
     {
-      extern int curr_lineno;
+      ostream& err = ctx->messages ? *ctx->messages : cerr;
       
-      cerr << "\"" << curr_filename << "\", line " << curr_lineno << ": " \
+      err << "\"" << ctx->filename << "\", line " << *loc << ": " \
       << s << " at or near ";
-      print_cool_token(yychar);
-      cerr << endl;
-      omerrs++;
+      print_cool_token(err, ctx->token, *ctx->lval);
+      err << endl;
+      ctx->errors++;
+      
+      if(ctx->messages == NULL && ctx->errors>MAX_PARSE_ERRORS) {
+        fprintf(stdout, "More than %d errors\n", MAX_PARSE_ERRORS); exit(1);
+      }
+    }
+    
+    /* The symbols the actions use are entered before the first token is
+    read, while no other thread can be using the string tables. */
+    static void init_parse_symbols()
+    {
+      if (Object_symbol == NULL) {
+        Object_symbol = idtable.add_string("Object");
+        self_symbol = idtable.add_string("self");
+      }
+    }
+    
+    /* Returns the symbol of the file name the token source last set.  It
+    runs on the thread that calls the token source. */
+    static Symbol filename_symbol()
+    {
+      static char *name = NULL;
+      static Symbol symbol = NULL;
+      if (curr_filename != name) {
+        name = curr_filename;
+        symbol = stringtable.add_string(curr_filename);
+      }
+      return symbol;
+    }
+    
+    /* Records the token about to be passed to the parser; yyerror reports
+    it.  lvalp must stay valid while the parser works on the token. */
+    static void note_token(ParserContext *ctx, int token, YYSTYPE *lvalp,
+    Symbol filename)
+    {
+      ctx->token = token;
+      ctx->lval = lvalp;
+      ctx->filename = filename;
+    }
+    
+    /* yylex of the pull parser, cool_yyparse. */
+    static int cool_next_token(YYSTYPE *lvalp, YYLTYPE *llocp,
+    ParserContext *ctx)
+    {
+      int token = (*cool_token_source)();
+      *lvalp = cool_yylval;
+      *llocp = curr_lineno;
+      note_token(ctx, token, lvalp, filename_symbol());
+      return token;
+    }
+    
+    /* A token with everything the parser needs to know about it, for
+    parsing on a thread other than the one that scanned it. */
+    struct QueuedToken {
+      int token;
+      YYSTYPE lval;
+      YYLTYPE lloc;
+      Symbol filename;
+    };
+    
+    static void scan_token(QueuedToken& t)
+    {
+      t.token = (*cool_token_source)();
+      t.lval = cool_yylval;
+      t.lloc = curr_lineno;
+      t.filename = filename_symbol();
+    }
+    
+    /* Pushes t into the parser ps and returns the push status. */
+    static int push_token(yypstate *ps, QueuedToken& t, ParserContext *ctx)
+    {
+      note_token(ctx, t.token, &t.lval, t.filename);
+      return yypush_parse(ps, t.token, &t.lval, &t.lloc, ctx);
+    }
+    
+    /* cool_yyparse_pipelined parses like cool_yyparse, but runs the token
+    source on a thread of its own.  That thread passes each token, with
+    its value, line and file, through a TokenQueue to this one, which
+    pushes it into the parser.  A token source that gives up on a
+    malformed stream exits from its own thread, so it may do so before
+    the parser has reported errors in the tokens ahead of it. */
+    static void lex_into(TokenQueue<QueuedToken> *queue)
+    {
+      TRACE_SCOPE("pass", "scan");
+      QueuedToken t;
+      do {
+        scan_token(t);
+        queue->push(t);
+      } while (t.token != 0);
+    }
+    
+    int cool_yyparse_pipelined(ParserContext *ctx)
+    {
+      init_parse_symbols();
+      TokenQueue<QueuedToken> *queue = new TokenQueue<QueuedToken>;
+      std::thread lexer(lex_into, queue);
+      
+      yypstate *ps = yypstate_new();
+      QueuedToken t;
+      int status;
+      do {
+        t = queue->pop();
+        status = push_token(ps, t, ctx);
+      } while (status == YYPUSH_MORE);
       
-      if(omerrs>50) {fprintf(stdout, "More than 50 errors\n"); exit(1);}
-    }
\ No newline at end of file
+      /* the parse can stop before the end of the input */
+      while (t.token != 0)
+      t = queue->pop();
+      lexer.join();
+      
+      yypstate_delete(ps);
+      delete queue;
+      return status;
+    }
+    
+    /* cool_yyparse_files scans the whole token stream first, splitting it
+    where the file name changes, and then parses the files on `jobs'
+    threads, each file with a context of its own.  The classes are put
+    together in file order and the error messages, which each context
+    keeps to itself, are printed in file order once all files are
+    parsed, so neither depends on how the threads were scheduled.  Since
+    every file ends its own parse, an error at the end of one file is
+    no longer recovered from in the next one. */
+    typedef std::vector<QueuedToken> TokenList;
+    
+    static void parse_file(TokenList *tokens, ParserContext *ctx)
+    {
+      TRACE_SCOPE("parse file", (*tokens)[0].filename->get_string());
+      yypstate *ps = yypstate_new();
+      int status = YYPUSH_MORE;
+      for (size_t i = 0; status == YYPUSH_MORE && i < tokens->size(); i++) {
+        status = push_token(ps, (*tokens)[i], ctx);
+        if (ctx->errors > MAX_PARSE_ERRORS)
+        break;
+      }
+      yypstate_delete(ps);
+    }
+    
+    int cool_yyparse_files(ParserContext *ctx, int jobs)
+    {
+      init_parse_symbols();
+      
+      std::vector<TokenList *> files;
+      QueuedToken t;
+      {
+        TRACE_SCOPE("pass", "scan");
+        for (scan_token(t); t.token != 0; scan_token(t)) {
+          if (files.empty() || t.filename != files.back()->back().filename)
+          files.push_back(new TokenList);
+          files.back()->push_back(t);
+        }
+      }
+      /* every file ends with an end of input at its last line; the last
+      file, or an empty stream, gets the real one */
+      for (size_t i = 0; i + 1 < files.size(); i++) {
+        QueuedToken end = files[i]->back();
+        end.token = 0;
+        files[i]->push_back(end);
+      }
+      if (files.empty())
+      files.push_back(new TokenList);
+      files.back()->push_back(t);
+      
+      std::vector<ParserContext> contexts(files.size());
+      for (size_t i = 0; i < files.size(); i++)
+      contexts[i].messages = new std::ostringstream;
+      
+      std::atomic<size_t> next_file(0);
+      auto worker = [&]() {
+        for (size_t i = next_file++; i < files.size(); i = next_file++)
+        parse_file(files[i], &contexts[i]);
+      };
+      std::vector<std::thread> threads;
+      for (int j = 1; j < jobs; j++)
+      threads.push_back(std::thread(worker));
+      worker();
+      for (size_t j = 0; j < threads.size(); j++)
+      threads[j].join();
+      
+      list_buffer<Class_> *classes = new list_buffer<Class_>;
+      for (size_t i = 0; i < files.size(); i++) {
+        std::istringstream messages(contexts[i].messages->str());
+        std::string line;
+        while (std::getline(messages, line)) {
+          cerr << line << endl;
+          if (++ctx->errors > MAX_PARSE_ERRORS) {
+            fprintf(stdout, "More than %d errors\n", MAX_PARSE_ERRORS);
+            exit(1);
+          }
+        }
+        /* a file with errors may have left junk in its class list */
+        if (contexts[i].errors == 0)
+        for (int c = 0; c < contexts[i].classes->len(); c++)
+        classes->add(contexts[i].classes->nth(c));
+        ctx->filename = contexts[i].filename;
+        delete contexts[i].messages;
+        delete files[i];
+      }
+      
+      ctx->classes = finish_list(classes);
+      if (ctx->errors == 0) {
+        node_lineno = contexts[0].program->get_line_number();
+        ctx->program = program(ctx->classes);
+      }
+      return ctx->errors == 0 ? 0 : 1;
+    }
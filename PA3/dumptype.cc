@@ -59,6 +59,9 @@ void dump_Boolean(ostream& stream, int padding, Boolean b);
 //  Case_class
 //     branch_class
 //
+//  Binding_class
+//     binding_class
+//
 //  Expression_class
 //     assign
 //     static_dispatch
@@ -217,6 +220,25 @@ void branch_class::dump_with_types(ostream& stream, int n)
    expr->dump_with_types(stream, n+2);
 }
 
+//
+// binding_class::dump_with_types dumps the line, name, type declaration
+// and initialization of one binding of a let; dump_fields_with_types
+// leaves out the line.  There is no keyword for a binding, the
+// enclosing let tells the reader where bindings are.
+//
+void binding_class::dump_with_types(ostream& stream, int n)
+{
+   dump_line(stream,n,this);
+   dump_fields_with_types(stream, n);
+}
+
+void binding_class::dump_fields_with_types(ostream& stream, int n)
+{
+   dump_Symbol(stream, n, identifier);
+   dump_Symbol(stream, n, type_decl);
+   init->dump_with_types(stream, n);
+}
+
 //
 // assign_class::dump_with_types prints "assign" and then (indented)
 // the variable being assigned, the expression, and finally the type
@@ -324,13 +346,24 @@ void block_class::dump_with_types(ostream& stream, int n)
    dump_type(stream,n);
 }
 
+//
+// let_class::dump_with_types writes the name, type and initialization
+// of a single binding directly under the "_let"; several bindings are
+// put in parentheses, like the actuals of a dispatch.  The body and
+// type of the let follow.
+//
 void let_class::dump_with_types(ostream& stream, int n)
 {
    dump_line(stream,n,this);
    stream << pad(n) << "_let\n";
-   dump_Symbol(stream, n+2, identifier);
-   dump_Symbol(stream, n+2, type_decl);
-   init->dump_with_types(stream, n+2);
+   if (bindings->len() == 1)
+     bindings->nth(0)->dump_fields_with_types(stream, n+2);
+   else {
+     stream << pad(n+2) << "(\n";
+     for(int i = bindings->first(); bindings->more(i); i = bindings->next(i))
+       bindings->nth(i)->dump_with_types(stream, n+2);
+     stream << pad(n+2) << ")\n";
+   }
    body->dump_with_types(stream, n+2);
    dump_type(stream,n);
 }
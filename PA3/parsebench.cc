@@ -0,0 +1,151 @@
+//
+// See copyright.h for copyright notice and limitation of liability
+// and disclaimer of warranty provisions.
+//
+#include "copyright.h"
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  parsebench.cc
+//
+//  Times cool_yyparse against cool_yyparse_pipelined (-P) and
+//  cool_yyparse_files (-j) on a token stream written by the lexer, text
+//  or binary:
+//
+//      lexer a.cl b.cl ... > big.tok
+//      parsebench [-n passes] [-j jobs] big.tok
+//
+//  -j runs cool_yyparse_files on `jobs' threads (default: one per
+//  processor); it only has something to spread if the stream holds
+//  several files.  All parsers run on the stream once and their ASTs are
+//  compared; then each parses it `passes' times (default 10) and the
+//  time per pass is printed.  The AST is not dumped in the timed passes.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <thread>
+#include "cool-io.h"
+#include "cool-tree.h"
+#include "utilities.h"
+#include "cool-parse.h"
+#include "token-stream.h"
+#include "parser-context.h"
+
+FILE *token_file;
+char *curr_filename = "<stdin>";
+
+extern int cool_yydebug;
+extern int yy_flex_debug;
+
+extern int cool_yylex();
+extern int (*cool_token_source)();
+
+static int jobs;
+
+static int parse_files(ParserContext *ctx)
+{
+  return cool_yyparse_files(ctx, jobs);
+}
+
+struct Parser {
+  const char *name;
+  int (*parse)(ParserContext *ctx);
+};
+
+static Parser parsers[] = {
+  { "pull", cool_yyparse },
+  { "-P",   cool_yyparse_pipelined },
+  { "-j",   parse_files },
+};
+
+#define NPARSERS ((int) (sizeof(parsers) / sizeof(parsers[0])))
+
+//
+// Rewinds the token file and parses it once.
+//
+static Program parse_tokens(Parser& p)
+{
+  rewind(token_file);
+  curr_filename = "<stdin>";
+  if (token_stream_is_binary(token_file)) {
+    if (!token_stream_open(token_file)) {
+      cerr << "Malformed binary token stream\n";
+      exit(1);
+    }
+    cool_token_source = cool_yylex_binary;
+  } else {
+    cool_token_source = cool_yylex;
+  }
+  ParserContext ctx;
+  p.parse(&ctx);
+  if (ctx.errors != 0) {
+    cerr << "parsebench: the token stream has parse errors\n";
+    exit(1);
+  }
+  return ctx.program;
+}
+
+int main(int argc, char **argv)
+{
+  int passes = 10;
+  int first = 1;
+
+  yy_flex_debug = 0;
+  cool_yydebug = 0;
+  jobs = std::thread::hardware_concurrency();
+  if (jobs == 0)
+    jobs = 1;
+
+  if (argc > first + 1 && strcmp(argv[first], "-n") == 0) {
+    passes = atoi(argv[first + 1]);
+    first += 2;
+  }
+  if (argc > first + 1 && strcmp(argv[first], "-j") == 0) {
+    jobs = atoi(argv[first + 1]);
+    first += 2;
+  }
+  if (first != argc - 1 || passes <= 0 || jobs <= 0) {
+    cerr << "usage: " << argv[0] << " [-n passes] [-j jobs] tokens\n";
+    exit(1);
+  }
+  token_file = fopen(argv[first], "r");
+  if (token_file == NULL) {
+    cerr << "Could not open input file " << argv[first] << endl;
+    exit(1);
+  }
+
+  std::string expected;
+  for (int p = 0; p < NPARSERS; p++) {
+    std::ostringstream out;
+    parse_tokens(parsers[p])->dump_with_types(out, 0);
+    if (p == 0) {
+      expected = out.str();
+    } else if (out.str() != expected) {
+      cerr << "parsebench: " << parsers[p].name << " and " << parsers[0].name
+	   << " parsers built different trees\n";
+      exit(1);
+    }
+  }
+
+  cout << argv[first] << ", " << passes << " passes, " << jobs << " jobs\n";
+  for (int p = 0; p < NPARSERS; p++) {
+    std::chrono::steady_clock::time_point start =
+      std::chrono::steady_clock::now();
+    for (int i = 0; i < passes; i++)
+      parse_tokens(parsers[p]);
+    double seconds = std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - start).count();
+
+    char line[200];
+    snprintf(line, sizeof(line), "%-5s %10.3f ms/pass\n",
+	     parsers[p].name, seconds * 1000 / passes);
+    cout << line;
+  }
+  exit(0);
+}
@@ -0,0 +1,48 @@
+// -*-Mode: C++;-*-
+//
+// See copyright.h for copyright notice and limitation of liability
+// and disclaimer of warranty provisions.
+//
+#include "copyright.h"
+
+#ifndef _PARSER_CONTEXT_H_
+#define _PARSER_CONTEXT_H_
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  parser-context.h
+//
+//  Everything one parse of a token stream produces or keeps track of,
+//  which used to live in the globals ast_root, parse_results and omerrs.
+//  The parser (cool.y) is given a context and touches no other mutable
+//  state of its own, so each thread of cool_yyparse_files can parse a
+//  file with a context of its own.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include <sstream>
+#include "cool-tree.h"
+
+union YYSTYPE;
+
+class ParserContext {
+public:
+  Program program;              // the result of the parse
+  Classes classes;              // the classes parsed so far
+  int errors;                   // number of parse errors
+  Symbol filename;              // file of the token last passed to the parser
+  int token;                    // that token and its value, for error messages
+  const union YYSTYPE *lval;
+  std::ostringstream *messages; // if not NULL, errors are written here
+                                // instead of to cerr
+
+  ParserContext() : program(NULL), classes(NULL), errors(0), filename(NULL),
+                    token(0), lval(NULL), messages(NULL) { }
+};
+
+// cool.y
+int cool_yyparse(ParserContext *ctx);
+int cool_yyparse_pipelined(ParserContext *ctx);
+int cool_yyparse_files(ParserContext *ctx, int jobs);
+
+#endif
@@ -9,6 +9,13 @@
 //  parser-phase.cc
 //
 //  Reads a COOL token stream from a file and builds the abstract syntax tree.
+//  The stream may be the text dump of the lexer or its binary encoding
+//  (token-stream.h); the format is recognized from the first byte.
+//  With -P the stream is scanned on a second thread while parsing; with
+//  -j n the files in it are parsed on n threads.  With -b the tree is
+//  written in the binary format of ast-stream.h instead of as text.
+//  --stats reports the time and memory taken (stats.h) and --trace=file
+//  writes a trace of the passes and of the threads (trace.h).
 //
 //////////////////////////////////////////////////////////////////////////////
 
@@ -18,29 +25,56 @@
 #include "cool-tree.h"
 #include "utilities.h"  // for fatal_error
 #include "cool-parse.h"
+#include "token-stream.h"
+#include "parser-context.h"
+#include "ast-stream.h"
+#include "stats.h"
 
 //
 // These globals keep everything working.
 //
 FILE *token_file = stdin;		// we read from this file
-extern Classes parse_results;	 // list of classes; used for multiple files 
-extern Program ast_root;	 // the AST produced by the parse
 
 char *curr_filename = "<stdin>";
 
-extern int omerrs;             // a count of lex and parse errors
-
-extern int cool_yyparse();
+extern int binary_stream;
+extern int pipeline_parse;
+extern int parse_jobs;
+extern int (*cool_token_source)();
 void handle_flags(int argc, char *argv[]);
 
 int main(int argc, char *argv[]) {
     handle_flags(argc, argv);
-    cool_yyparse();
-    if (omerrs != 0) {
+    if (token_stream_is_binary(token_file)) {
+	if (!token_stream_open(token_file)) {
+	    cerr << "Malformed binary token stream\n";
+	    exit(1);
+	}
+	cool_token_source = cool_yylex_binary;
+    }
+    ParserContext ctx;
+    {
+	StatsPass pass("parse");
+	if (parse_jobs > 1)
+	    cool_yyparse_files(&ctx, parse_jobs);
+	else if (pipeline_parse)
+	    cool_yyparse_pipelined(&ctx);
+	else
+	    cool_yyparse(&ctx);
+    }
+    if (ctx.errors != 0) {
 	cerr << "Compilation halted due to lex and parse errors\n";
 	exit(1);
     }
-    ast_root->dump_with_types(cout,0);
+    {
+	StatsPass pass("write AST");
+	if (binary_stream)
+	    ctx.program->dump_binary(cout);
+	else
+	    ctx.program->dump_with_types(cout,0);
+    }
+    stats_report("parser");
+    trace_write();
     return 0;
 }
 
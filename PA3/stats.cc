@@ -0,0 +1,302 @@
+//
+// See copyright.h for copyright notice and limitation of liability
+// and disclaimer of warranty provisions.
+//
+#include "copyright.h"
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  stats.cc
+//
+//  The pass table behind StatsPass and StatsTally (stats.h), the counts
+//  of stats_count, and the replacements of operator new that count
+//  allocations.  The counters of counters.h are reported with the passes.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <sys/resource.h>
+#include <atomic>
+#include <mutex>
+#include <new>
+#include <string>
+#include <vector>
+#include "cool-io.h"
+#include "stats.h"
+#include "counters.h"
+
+struct PassRecord {
+  std::string name;
+  int parent;                   // index of the enclosing pass, or -1
+  int depth;
+  int calls;
+  bool tally;                   // only wall time and allocations
+  double wall;                  // seconds
+  double cpu;                   // seconds
+  long peak_rss;                // kilobytes
+  unsigned long allocations;
+};
+
+static std::vector<PassRecord> passes;  // in the order they were first opened
+static std::mutex passes_lock;          // passes may be timed on any thread
+static thread_local int open_pass = -1; // innermost pass open on this thread
+
+struct CountRecord {
+  std::string name;
+  long value;
+};
+
+static std::vector<CountRecord> counts; // in the order they were first added;
+                                        // under passes_lock
+
+static std::atomic<unsigned long> allocation_count(0);
+
+//
+// Every operator new of the program counts one allocation.
+//
+void *operator new(size_t size)
+{
+  allocation_count.fetch_add(1, std::memory_order_relaxed);
+  void *p = malloc(size ? size : 1);
+  if (p == NULL)
+    throw std::bad_alloc();
+  return p;
+}
+
+void *operator new[](size_t size)
+{
+  return operator new(size);
+}
+
+void *operator new(size_t size, const std::nothrow_t&) noexcept
+{
+  allocation_count.fetch_add(1, std::memory_order_relaxed);
+  return malloc(size ? size : 1);
+}
+
+void *operator new[](size_t size, const std::nothrow_t& nt) noexcept
+{
+  return operator new(size, nt);
+}
+
+void operator delete(void *p) noexcept            { free(p); }
+void operator delete[](void *p) noexcept          { free(p); }
+void operator delete(void *p, size_t) noexcept    { free(p); }
+void operator delete[](void *p, size_t) noexcept  { free(p); }
+
+unsigned long stats_allocations()
+{
+  return allocation_count.load(std::memory_order_relaxed);
+}
+
+double stats_clock()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static double cpu_clock()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static long peak_rss()
+{
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  return usage.ru_maxrss;
+}
+
+//
+// Returns the index of pass `name' under the pass open on this thread,
+// entering it in the table the first time.
+//
+static int find_pass(const char *name, bool tally)
+{
+  std::lock_guard<std::mutex> guard(passes_lock);
+  for (size_t i = 0; i < passes.size(); i++)
+    if (passes[i].parent == open_pass && passes[i].name == name)
+      return i;
+  PassRecord r;
+  r.name = name;
+  r.parent = open_pass;
+  r.depth = open_pass < 0 ? 0 : passes[open_pass].depth + 1;
+  r.calls = 0;
+  r.tally = tally;
+  r.wall = r.cpu = 0;
+  r.peak_rss = 0;
+  r.allocations = 0;
+  passes.push_back(r);
+  return passes.size() - 1;
+}
+
+StatsPass::StatsPass(const char *name)
+#ifdef TRACE
+  : trace("pass", name)
+#endif
+{
+  if (compiler_stats == STATS_OFF) {
+    index = -1;
+    return;
+  }
+  index = find_pass(name, false);
+  open_pass = index;
+  allocations = stats_allocations();
+  cpu = cpu_clock();
+  wall = stats_clock();
+}
+
+StatsPass::~StatsPass()
+{
+  if (index < 0)
+    return;
+  double now = stats_clock();
+  double cpu_now = cpu_clock();
+  unsigned long allocated = stats_allocations() - allocations;
+  long rss = peak_rss();
+
+  std::lock_guard<std::mutex> guard(passes_lock);
+  PassRecord& r = passes[index];
+  r.calls++;
+  r.wall += now - wall;
+  r.cpu += cpu_now - cpu;
+  r.allocations += allocated;
+  if (rss > r.peak_rss)
+    r.peak_rss = rss;
+  open_pass = r.parent;
+}
+
+StatsTally::StatsTally(const char *name)
+{
+  index = compiler_stats == STATS_OFF ? -1 : find_pass(name, true);
+}
+
+void StatsTally::add(double wall_seconds, unsigned long allocations)
+{
+  if (index < 0)
+    return;
+  std::lock_guard<std::mutex> guard(passes_lock);
+  PassRecord& r = passes[index];
+  r.calls++;
+  r.wall += wall_seconds;
+  r.allocations += allocations;
+}
+
+void stats_count(const char *name, long n)
+{
+  if (compiler_stats == STATS_OFF)
+    return;
+  std::lock_guard<std::mutex> guard(passes_lock);
+  for (size_t i = 0; i < counts.size(); i++)
+    if (counts[i].name == name) {
+      counts[i].value += n;
+      return;
+    }
+  CountRecord r;
+  r.name = name;
+  r.value = n;
+  counts.push_back(r);
+}
+
+//
+// Writes `s' as a JSON string.
+//
+static void json_string(ostream& out, const std::string& s)
+{
+  out << '"';
+  for (size_t i = 0; i < s.size(); i++) {
+    char c = s[i];
+    if (c == '"' || c == '\\')
+      out << '\\' << c;
+    else if ((unsigned char) c < ' ')
+      out << ' ';
+    else
+      out << c;
+  }
+  out << '"';
+}
+
+//
+// Appends pass `parent' and all the passes under it to `order', each
+// pass before its sub-passes.
+//
+static void tree_order(int parent, std::vector<int>& order)
+{
+  if (parent >= 0)
+    order.push_back(parent);
+  for (size_t i = 0; i < passes.size(); i++)
+    if (passes[i].parent == parent)
+      tree_order(i, order);
+}
+
+void stats_report(const char *phase)
+{
+  if (compiler_stats == STATS_OFF)
+    return;
+
+  std::lock_guard<std::mutex> guard(passes_lock);
+  std::vector<int> order;
+  tree_order(-1, order);
+  char line[200];
+  if (compiler_stats == STATS_JSON) {
+    cerr << "{\"phase\": ";
+    json_string(cerr, phase);
+    cerr << ", \"passes\": [";
+    for (size_t i = 0; i < order.size(); i++) {
+      PassRecord& r = passes[order[i]];
+      cerr << (i == 0 ? "" : ", ") << "{\"name\": ";
+      json_string(cerr, r.name);
+      snprintf(line, sizeof(line), ", \"depth\": %d, \"calls\": %d, "
+	       "\"wall_ms\": %.3f, ", r.depth, r.calls, r.wall * 1000);
+      cerr << line;
+      if (r.tally)
+	snprintf(line, sizeof(line), "\"cpu_ms\": null, \"peak_rss_kb\": null, ");
+      else
+	snprintf(line, sizeof(line), "\"cpu_ms\": %.3f, \"peak_rss_kb\": %ld, ",
+		 r.cpu * 1000, r.peak_rss);
+      cerr << line << "\"allocations\": " << r.allocations << "}";
+    }
+    cerr << "], \"counters\": [";
+    counters_report(cerr, true);
+    cerr << "], \"counts\": [";
+    for (size_t i = 0; i < counts.size(); i++) {
+      cerr << (i == 0 ? "" : ", ") << "{\"name\": ";
+      json_string(cerr, counts[i].name);
+      cerr << ", \"value\": " << counts[i].value << "}";
+    }
+    cerr << "]}" << endl;
+    return;
+  }
+
+  cerr << "--- " << phase << " ---" << endl;
+  snprintf(line, sizeof(line), "%-28s %7s %10s %10s %9s %10s\n",
+	   "pass", "calls", "wall ms", "cpu ms", "peak KB", "allocs");
+  cerr << line;
+  for (size_t i = 0; i < order.size(); i++) {
+    PassRecord& r = passes[order[i]];
+    std::string name = std::string(2 * r.depth, ' ') + r.name;
+    if (r.tally)
+      snprintf(line, sizeof(line), "%-28s %7d %10.3f %10s %9s %10lu\n",
+	       name.c_str(), r.calls, r.wall * 1000, "-", "-", r.allocations);
+    else
+      snprintf(line, sizeof(line), "%-28s %7d %10.3f %10.3f %9ld %10lu\n",
+	       name.c_str(), r.calls, r.wall * 1000, r.cpu * 1000,
+	       r.peak_rss, r.allocations);
+    cerr << line;
+  }
+  counters_report(cerr, false);
+  for (size_t i = 0; i < counts.size(); i++) {
+    if (i == 0) {
+      snprintf(line, sizeof(line), "%-44s %10s\n", "count", "value");
+      cerr << line;
+    }
+    snprintf(line, sizeof(line), "%-44s %10ld\n", counts[i].name.c_str(),
+	     counts[i].value);
+    cerr << line;
+  }
+}
@@ -0,0 +1,101 @@
+// -*-Mode: C++;-*-
+//
+// See copyright.h for copyright notice and limitation of liability
+// and disclaimer of warranty provisions.
+//
+#include "copyright.h"
+
+#ifndef _STATS_H_
+#define _STATS_H_
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  stats.h
+//
+//  Measures the compiler itself.  With --stats every phase reports, on
+//  standard error when it is done, the wall time, CPU time, peak resident
+//  set size and number of operator new calls of each of its passes:
+//
+//      pass                     calls   wall ms    cpu ms  peak KB    allocs
+//      semant                       1    41.207    41.113     5120     60311
+//        class table                1     0.315     0.313     3968       402
+//      ...
+//
+//  --stats=json writes the same as one JSON object per phase instead,
+//  so that runs of different builds can be compared by a script:
+//
+//      {"phase": "semant", "passes": [{"name": "semant", "depth": 0,
+//       "calls": 1, "wall_ms": 41.207, "cpu_ms": 41.113,
+//       "peak_rss_kb": 5120, "allocations": 60311}, ...]}
+//
+//  A pass is timed by a StatsPass on the stack; one opened while another
+//  is open on the same thread is its sub-pass.  Passes with the same name
+//  and parent are added up.  The CPU time is that of the whole process,
+//  and the peak RSS is the high-water mark when the pass ended.  Every
+//  pass is also an event of the --trace file (trace.h).  In a build with
+//  -DCOUNTERS the hot-path counters (counters.h) follow the passes, and
+//  are the "counters" array of the JSON object.  Counts of what a phase
+//  did, added with stats_count, come last, and are its "counts" array:
+//
+//      count                                         value
+//      devirtualized dispatches                         12
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include <stddef.h>
+#include "trace.h"
+
+enum StatsFormat { STATS_OFF, STATS_TEXT, STATS_JSON };
+
+extern int compiler_stats;      // a StatsFormat, set by --stats in handle_flags
+
+//
+// Times the pass `name' from construction to destruction.  It costs a
+// test of compiler_stats when --stats is not given.
+//
+class StatsPass {
+private:
+  int index;                    // in the table of passes; -1 if off
+  double wall;
+  double cpu;
+  unsigned long allocations;
+#ifdef TRACE
+  TraceScope trace;
+#endif
+public:
+  StatsPass(const char *name);
+  ~StatsPass();
+};
+
+//
+// A pass entered too often to read the CPU clock and the resource usage
+// each time, such as the scanner, which is entered once a token.  Only
+// the wall time and the allocations of each entry are added up.  Make
+// the tally while its parent pass is open.
+//
+class StatsTally {
+private:
+  int index;
+public:
+  StatsTally(const char *name);
+  void add(double wall_seconds, unsigned long allocations);
+};
+
+//
+// Adds n to the count `name' of this phase, such as the number of call
+// sites cgen made direct.  Counts are reported in the order they were
+// first added, so adding 0 reports one that stayed at zero.  Does
+// nothing without --stats.
+//
+void stats_count(const char *name, long n);
+
+double stats_clock();                   // wall clock, in seconds
+unsigned long stats_allocations();      // operator new calls so far
+
+//
+// Writes the passes of this phase to standard error in the format chosen
+// with --stats; does nothing without it.
+//
+void stats_report(const char *phase);
+
+#endif
@@ -0,0 +1,73 @@
+// -*-Mode: C++;-*-
+//
+// See copyright.h for copyright notice and limitation of liability
+// and disclaimer of warranty provisions.
+//
+#include "copyright.h"
+
+#ifndef _TOKEN_QUEUE_H_
+#define _TOKEN_QUEUE_H_
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  token-queue.h
+//
+//  A bounded ring for handing tokens from one thread to exactly one
+//  other, used by the pipelined parser (-P).  It needs no locks: `tail'
+//  is only written by the producer and `head' only by the consumer, and
+//  the release store of an index publishes the slots before it.  Each
+//  side also keeps its own copy of the other's index and rereads the
+//  shared one only when the ring looks full (or empty), so the two
+//  threads seldom touch the same cache line.
+//
+//  A full or empty ring makes the waiting side spin briefly and then
+//  yield; neither side ever blocks in the kernel.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include <atomic>
+#include <thread>
+
+template <class T, int LOG_SIZE = 12>
+class TokenQueue {
+private:
+  enum { SIZE = 1 << LOG_SIZE, MASK = SIZE - 1, SPINS = 64 };
+
+  alignas(64) std::atomic<unsigned> head;  // next slot to read
+  unsigned tail_seen;                      // consumer's copy of tail
+  alignas(64) std::atomic<unsigned> tail;  // next slot to write
+  unsigned head_seen;                      // producer's copy of head
+  alignas(64) T slots[SIZE];
+
+  static void wait(int& spins)
+  {
+    if (++spins > SPINS)
+      std::this_thread::yield();
+  }
+
+public:
+  TokenQueue() : head(0), tail_seen(0), tail(0), head_seen(0) { }
+
+  // producer only
+  void push(const T& item)
+  {
+    unsigned t = tail.load(std::memory_order_relaxed);
+    for (int spins = 0; t - head_seen == SIZE; wait(spins))
+      head_seen = head.load(std::memory_order_acquire);
+    slots[t & MASK] = item;
+    tail.store(t + 1, std::memory_order_release);
+  }
+
+  // consumer only
+  T pop()
+  {
+    unsigned h = head.load(std::memory_order_relaxed);
+    for (int spins = 0; h == tail_seen; wait(spins))
+      tail_seen = tail.load(std::memory_order_acquire);
+    T item = slots[h & MASK];
+    head.store(h + 1, std::memory_order_release);
+    return item;
+  }
+};
+
+#endif
@@ -15,8 +15,9 @@
 
 #include "tree.h"
 
-/* line number to assign to the current node being constructed */
-int node_lineno = 1;
+/* line number to assign to the current node being constructed; each
+   thread of the parser (cool_yyparse_files) constructs nodes of its own */
+thread_local int node_lineno = 1;
 
 ///////////////////////////////////////////////////////////////////////////
 //
@@ -47,3 +48,7 @@ tree_node *tree_node::set(tree_node *t) {
    line_number = t->line_number;
    return this;
 }
+
+void tree_node::set_line_number(int n) {
+   line_number = n;
+}
@@ -1,14 +1,14 @@
-/* A Bison parser, made by GNU Bison 2.3.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
-/* Skeleton implementation for Bison's Yacc-like parsers in C
+/* Bison implementation for Yacc-like parsers in C
 
-   Copyright (C) 1984, 1989, 1990, 2000, 2001, 2002, 2003, 2004, 2005, 2006
-   Free Software Foundation, Inc.
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
 
-   This program is free software; you can redistribute it and/or modify
+   This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
-   the Free Software Foundation; either version 2, or (at your option)
-   any later version.
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
 
    This program is distributed in the hope that it will be useful,
    but WITHOUT ANY WARRANTY; without even the implied warranty of
@@ -16,9 +16,7 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program; if not, write to the Free Software
-   Foundation, Inc., 51 Franklin Street, Fifth Floor,
-   Boston, MA 02110-1301, USA.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -36,6 +34,10 @@
 /* C LALR(1) parser skeleton written by Richard Stallman, by
    simplifying the original so-called "semantic" parser.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
 /* All symbols defined below should begin with yy or YY, to avoid
    infringing on user name space.  This should be done even for local
    variables, as they might otherwise be expanded by user macros.
@@ -43,11 +45,11 @@
    define necessary library symbols; they are noted "INFRINGES ON
    USER NAME SPACE" below.  */
 
-/* Identify Bison output.  */
-#define YYBISON 1
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
 
-/* Bison version.  */
-#define YYBISON_VERSION "2.3"
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
 
 /* Skeleton name.  */
 #define YYSKELETON_NAME "yacc.c"
@@ -55,105 +57,26 @@
 /* Pure parsers.  */
 #define YYPURE 0
 
-/* Using locations.  */
-#define YYLSP_NEEDED 0
+/* Push parsers.  */
+#define YYPUSH 0
+
+/* Pull parsers.  */
+#define YYPULL 1
+
 
 /* Substitute the variable and function names.  */
-#define yyparse ast_yyparse
-#define yylex   ast_yylex
-#define yyerror ast_yyerror
-#define yylval  ast_yylval
-#define yychar  ast_yychar
-#define yydebug ast_yydebug
-#define yynerrs ast_yynerrs
-
-
-/* Tokens.  */
-#ifndef YYTOKENTYPE
-# define YYTOKENTYPE
-   /* Put the tokens into the symbol table, so that GDB and other debuggers
-      know about them.  */
-   enum yytokentype {
-     PROGRAM = 258,
-     CLASS = 259,
-     METHOD = 260,
-     ATTR = 261,
-     FORMAL = 262,
-     BRANCH = 263,
-     ASSIGN = 264,
-     STATIC_DISPATCH = 265,
-     DISPATCH = 266,
-     COND = 267,
-     LOOP = 268,
-     TYPCASE = 269,
-     BLOCK = 270,
-     LET = 271,
-     PLUS = 272,
-     SUB = 273,
-     MUL = 274,
-     DIVIDE = 275,
-     NEG = 276,
-     LT = 277,
-     EQ = 278,
-     LEQ = 279,
-     COMP = 280,
-     INT = 281,
-     STR = 282,
-     BOOL = 283,
-     NEW = 284,
-     ISVOID = 285,
-     NO_EXPR = 286,
-     OBJECT = 287,
-     NO_TYPE = 288,
-     STR_CONST = 289,
-     INT_CONST = 290,
-     ID = 291,
-     LINENO = 292
-   };
-#endif
-/* Tokens.  */
-#define PROGRAM 258
-#define CLASS 259
-#define METHOD 260
-#define ATTR 261
-#define FORMAL 262
-#define BRANCH 263
-#define ASSIGN 264
-#define STATIC_DISPATCH 265
-#define DISPATCH 266
-#define COND 267
-#define LOOP 268
-#define TYPCASE 269
-#define BLOCK 270
-#define LET 271
-#define PLUS 272
-#define SUB 273
-#define MUL 274
-#define DIVIDE 275
-#define NEG 276
-#define LT 277
-#define EQ 278
-#define LEQ 279
-#define COMP 280
-#define INT 281
-#define STR 282
-#define BOOL 283
-#define NEW 284
-#define ISVOID 285
-#define NO_EXPR 286
-#define OBJECT 287
-#define NO_TYPE 288
-#define STR_CONST 289
-#define INT_CONST 290
-#define ID 291
-#define LINENO 292
-
-
-
-
-/* Copy the first part of user declarations.  */
+#define yyparse         ast_yyparse
+#define yylex           ast_yylex
+#define yyerror         ast_yyerror
+#define yydebug         ast_yydebug
+#define yynerrs         ast_yynerrs
+#define yylval          ast_yylval
+#define yychar          ast_yychar
+
+/* First part of user prologue.  */
 #line 6 "ast.y"
 
+
 #include "cool-io.h"
 #include "cool-tree.h"
 #include "stringtab.h"
@@ -168,88 +91,185 @@ int omerrs = 0;               /* number of errors in lexing and parsing */
 int current_line = 0;         /* debugging, current line for input file */
 
 
-/* Enabling traces.  */
-#ifndef YYDEBUG
-# define YYDEBUG 1
-#endif
+#line 95 "ast.tab.c"
 
-/* Enabling verbose error messages.  */
-#ifdef YYERROR_VERBOSE
-# undef YYERROR_VERBOSE
-# define YYERROR_VERBOSE 1
-#else
-# define YYERROR_VERBOSE 0
-#endif
-
-/* Enabling the token table.  */
-#ifndef YYTOKEN_TABLE
-# define YYTOKEN_TABLE 0
-#endif
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
 
-#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-typedef union YYSTYPE
-#line 22 "ast.y"
+#include "ast.tab.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
 {
-  int lineno;
-  Boolean boolean;
-  Symbol symbol;
-  Program program;
-  Class_ class_;
-  Classes classes;
-  Feature feature;
-  Features features;
-  Formal formal;
-  Formals formals;
-  Case case_;
-  Cases cases;
-  Expression expression;
-  Expressions expressions;
-}
-/* Line 187 of yacc.c.  */
-#line 210 "ast.tab.c"
-	YYSTYPE;
-# define yystype YYSTYPE /* obsolescent; will be withdrawn */
-# define YYSTYPE_IS_DECLARED 1
-# define YYSTYPE_IS_TRIVIAL 1
-#endif
-
-
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_PROGRAM = 3,                    /* PROGRAM  */
+  YYSYMBOL_CLASS = 4,                      /* CLASS  */
+  YYSYMBOL_METHOD = 5,                     /* METHOD  */
+  YYSYMBOL_ATTR = 6,                       /* ATTR  */
+  YYSYMBOL_FORMAL = 7,                     /* FORMAL  */
+  YYSYMBOL_BRANCH = 8,                     /* BRANCH  */
+  YYSYMBOL_ASSIGN = 9,                     /* ASSIGN  */
+  YYSYMBOL_STATIC_DISPATCH = 10,           /* STATIC_DISPATCH  */
+  YYSYMBOL_DISPATCH = 11,                  /* DISPATCH  */
+  YYSYMBOL_COND = 12,                      /* COND  */
+  YYSYMBOL_LOOP = 13,                      /* LOOP  */
+  YYSYMBOL_TYPCASE = 14,                   /* TYPCASE  */
+  YYSYMBOL_BLOCK = 15,                     /* BLOCK  */
+  YYSYMBOL_LET = 16,                       /* LET  */
+  YYSYMBOL_PLUS = 17,                      /* PLUS  */
+  YYSYMBOL_SUB = 18,                       /* SUB  */
+  YYSYMBOL_MUL = 19,                       /* MUL  */
+  YYSYMBOL_DIVIDE = 20,                    /* DIVIDE  */
+  YYSYMBOL_NEG = 21,                       /* NEG  */
+  YYSYMBOL_LT = 22,                        /* LT  */
+  YYSYMBOL_EQ = 23,                        /* EQ  */
+  YYSYMBOL_LEQ = 24,                       /* LEQ  */
+  YYSYMBOL_COMP = 25,                      /* COMP  */
+  YYSYMBOL_INT = 26,                       /* INT  */
+  YYSYMBOL_STR = 27,                       /* STR  */
+  YYSYMBOL_BOOL = 28,                      /* BOOL  */
+  YYSYMBOL_NEW = 29,                       /* NEW  */
+  YYSYMBOL_ISVOID = 30,                    /* ISVOID  */
+  YYSYMBOL_NO_EXPR = 31,                   /* NO_EXPR  */
+  YYSYMBOL_OBJECT = 32,                    /* OBJECT  */
+  YYSYMBOL_NO_TYPE = 33,                   /* NO_TYPE  */
+  YYSYMBOL_STR_CONST = 34,                 /* STR_CONST  */
+  YYSYMBOL_INT_CONST = 35,                 /* INT_CONST  */
+  YYSYMBOL_ID = 36,                        /* ID  */
+  YYSYMBOL_LINENO = 37,                    /* LINENO  */
+  YYSYMBOL_38_ = 38,                       /* '('  */
+  YYSYMBOL_39_ = 39,                       /* ')'  */
+  YYSYMBOL_40_ = 40,                       /* ':'  */
+  YYSYMBOL_YYACCEPT = 41,                  /* $accept  */
+  YYSYMBOL_program = 42,                   /* program  */
+  YYSYMBOL_nothing = 43,                   /* nothing  */
+  YYSYMBOL_class_list = 44,                /* class_list  */
+  YYSYMBOL_class = 45,                     /* class  */
+  YYSYMBOL_optional_feature_list = 46,     /* optional_feature_list  */
+  YYSYMBOL_feature_list = 47,              /* feature_list  */
+  YYSYMBOL_feature = 48,                   /* feature  */
+  YYSYMBOL_formals = 49,                   /* formals  */
+  YYSYMBOL_formal_list = 50,               /* formal_list  */
+  YYSYMBOL_formal = 51,                    /* formal  */
+  YYSYMBOL_expr = 52,                      /* expr  */
+  YYSYMBOL_expr_aux = 53,                  /* expr_aux  */
+  YYSYMBOL_actuals = 54,                   /* actuals  */
+  YYSYMBOL_expr_list = 55,                 /* expr_list  */
+  YYSYMBOL_case_list = 56,                 /* case_list  */
+  YYSYMBOL_simple_case = 57,               /* simple_case  */
+  YYSYMBOL_binding_list = 58,              /* binding_list  */
+  YYSYMBOL_binding = 59                    /* binding  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
 
-/* Copy the second part of user declarations.  */
 
 
-/* Line 216 of yacc.c.  */
-#line 223 "ast.tab.c"
 
 #ifdef short
 # undef short
 #endif
 
-#ifdef YYTYPE_UINT8
-typedef YYTYPE_UINT8 yytype_uint8;
-#else
-typedef unsigned char yytype_uint8;
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
 #endif
 
-#ifdef YYTYPE_INT8
-typedef YYTYPE_INT8 yytype_int8;
-#elif (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
 typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
 #else
-typedef short int yytype_int8;
+typedef short yytype_int16;
 #endif
 
-#ifdef YYTYPE_UINT16
-typedef YYTYPE_UINT16 yytype_uint16;
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
 #else
-typedef unsigned short int yytype_uint16;
+typedef short yytype_uint8;
 #endif
 
-#ifdef YYTYPE_INT16
-typedef YYTYPE_INT16 yytype_int16;
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
 #else
-typedef short int yytype_int16;
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
 #endif
 
 #ifndef YYSIZE_T
@@ -257,55 +277,106 @@ typedef short int yytype_int16;
 #  define YYSIZE_T __SIZE_TYPE__
 # elif defined size_t
 #  define YYSIZE_T size_t
-# elif ! defined YYSIZE_T && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
 #  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
 #  define YYSIZE_T size_t
 # else
-#  define YYSIZE_T unsigned int
+#  define YYSIZE_T unsigned
 # endif
 #endif
 
-#define YYSIZE_MAXIMUM ((YYSIZE_T) -1)
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_uint8 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
 
 #ifndef YY_
-# if YYENABLE_NLS
+# if defined YYENABLE_NLS && YYENABLE_NLS
 #  if ENABLE_NLS
 #   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
-#   define YY_(msgid) dgettext ("bison-runtime", msgid)
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
 #  endif
 # endif
 # ifndef YY_
-#  define YY_(msgid) msgid
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
 # endif
 #endif
 
 /* Suppress unused-variable warnings by "using" E.  */
 #if ! defined lint || defined __GNUC__
-# define YYUSE(e) ((void) (e))
+# define YY_USE(E) ((void) (E))
 #else
-# define YYUSE(e) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
-/* Identity function, used to suppress warnings about constant conditions.  */
-#ifndef lint
-# define YYID(n) (n)
-#else
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static int
-YYID (int i)
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
 #else
-static int
-YYID (i)
-    int i;
+# define YY_INITIAL_VALUE(Value) Value
 #endif
-{
-  return i;
-}
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
 #endif
 
-#if ! defined yyoverflow || YYERROR_VERBOSE
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
 
 /* The parser invokes alloca or malloc; define the necessary symbols.  */
 
@@ -322,11 +393,11 @@ YYID (i)
 #    define alloca _alloca
 #   else
 #    define YYSTACK_ALLOC alloca
-#    if ! defined _ALLOCA_H && ! defined _STDLIB_H && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
 #     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
-#     ifndef _STDLIB_H
-#      define _STDLIB_H 1
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
 #     endif
 #    endif
 #   endif
@@ -334,8 +405,8 @@ YYID (i)
 # endif
 
 # ifdef YYSTACK_ALLOC
-   /* Pacify GCC's `empty if-body' warning.  */
-#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (YYID (0))
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
 #  ifndef YYSTACK_ALLOC_MAXIMUM
     /* The OS might guarantee only one guard page at the bottom of the stack,
        and a page size can be as small as 4096 bytes.  So we cannot safely
@@ -349,111 +420,117 @@ YYID (i)
 #  ifndef YYSTACK_ALLOC_MAXIMUM
 #   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
 #  endif
-#  if (defined __cplusplus && ! defined _STDLIB_H \
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
        && ! ((defined YYMALLOC || defined malloc) \
-	     && (defined YYFREE || defined free)))
+             && (defined YYFREE || defined free)))
 #   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
-#   ifndef _STDLIB_H
-#    define _STDLIB_H 1
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
 #   endif
 #  endif
 #  ifndef YYMALLOC
 #   define YYMALLOC malloc
-#   if ! defined malloc && ! defined _STDLIB_H && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#   if ! defined malloc && ! defined EXIT_SUCCESS
 void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 #  ifndef YYFREE
 #   define YYFREE free
-#   if ! defined free && ! defined _STDLIB_H && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#   if ! defined free && ! defined EXIT_SUCCESS
 void free (void *); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 # endif
-#endif /* ! defined yyoverflow || YYERROR_VERBOSE */
-
+#endif /* !defined yyoverflow */
 
 #if (! defined yyoverflow \
      && (! defined __cplusplus \
-	 || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+         || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
 
 /* A type that is properly aligned for any stack member.  */
 union yyalloc
 {
-  yytype_int16 yyss;
-  YYSTYPE yyvs;
-  };
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+};
 
 /* The size of the maximum gap between one aligned stack and the next.  */
-# define YYSTACK_GAP_MAXIMUM (sizeof (union yyalloc) - 1)
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
 
 /* The size of an array large to enough to hold all stacks, each with
    N elements.  */
 # define YYSTACK_BYTES(N) \
-     ((N) * (sizeof (yytype_int16) + sizeof (YYSTYPE)) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
       + YYSTACK_GAP_MAXIMUM)
 
-/* Copy COUNT objects from FROM to TO.  The source and destination do
-   not overlap.  */
-# ifndef YYCOPY
-#  if defined __GNUC__ && 1 < __GNUC__
-#   define YYCOPY(To, From, Count) \
-      __builtin_memcpy (To, From, (Count) * sizeof (*(From)))
-#  else
-#   define YYCOPY(To, From, Count)		\
-      do					\
-	{					\
-	  YYSIZE_T yyi;				\
-	  for (yyi = 0; yyi < (Count); yyi++)	\
-	    (To)[yyi] = (From)[yyi];		\
-	}					\
-      while (YYID (0))
-#  endif
-# endif
+# define YYCOPY_NEEDED 1
 
 /* Relocate STACK from its old location to the new one.  The
    local variables YYSIZE and YYSTACKSIZE give the old and new number of
    elements in the stack, and YYPTR gives the new location of the
    stack.  Advance YYPTR to a properly aligned location for the next
    stack.  */
-# define YYSTACK_RELOCATE(Stack)					\
-    do									\
-      {									\
-	YYSIZE_T yynewbytes;						\
-	YYCOPY (&yyptr->Stack, Stack, yysize);				\
-	Stack = &yyptr->Stack;						\
-	yynewbytes = yystacksize * sizeof (*Stack) + YYSTACK_GAP_MAXIMUM; \
-	yyptr += yynewbytes / sizeof (*yyptr);				\
-      }									\
-    while (YYID (0))
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
 
 #endif
 
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
 /* YYFINAL -- State number of the termination state.  */
 #define YYFINAL  3
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   115
+#define YYLAST   124
 
 /* YYNTOKENS -- Number of terminals.  */
 #define YYNTOKENS  41
 /* YYNNTS -- Number of nonterminals.  */
-#define YYNNTS  17
+#define YYNNTS  19
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  51
-/* YYNRULES -- Number of states.  */
-#define YYNSTATES  122
+#define YYNRULES  55
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  132
 
-/* YYTRANSLATE(YYLEX) -- Bison symbol number corresponding to YYLEX.  */
-#define YYUNDEFTOK  2
+/* YYMAXUTOK -- Last valid token kind.  */
 #define YYMAXUTOK   292
 
-#define YYTRANSLATE(YYX)						\
-  ((unsigned int) (YYX) <= YYMAXUTOK ? yytranslate[YYX] : YYUNDEFTOK)
 
-/* YYTRANSLATE[YYLEX] -- Bison symbol number corresponding to YYLEX.  */
-static const yytype_uint8 yytranslate[] =
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_int8 yytranslate[] =
 {
        0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -488,112 +565,83 @@ static const yytype_uint8 yytranslate[] =
 };
 
 #if YYDEBUG
-/* YYPRHS[YYN] -- Index of the first RHS symbol of rule number YYN in
-   YYRHS.  */
-static const yytype_uint8 yyprhs[] =
-{
-       0,     0,     3,     8,    10,    11,    13,    16,    25,    26,
-      28,    30,    33,    40,    46,    47,    49,    51,    54,    59,
-      63,    67,    72,    79,    85,    91,    96,   100,   107,   112,
-     116,   120,   125,   130,   135,   140,   144,   149,   154,   159,
-     163,   167,   171,   175,   179,   182,   185,   189,   191,   194,
-     196,   199
-};
-
-/* YYRHS -- A `-1'-separated list of the rules' RHS.  */
-static const yytype_int8 yyrhs[] =
-{
-      42,     0,    -1,    43,    37,     3,    44,    -1,    43,    -1,
-      -1,    45,    -1,    44,    45,    -1,    37,     4,    36,    36,
-      34,    38,    46,    39,    -1,    -1,    47,    -1,    48,    -1,
-      47,    48,    -1,    37,     5,    36,    49,    36,    52,    -1,
-      37,     6,    36,    36,    52,    -1,    -1,    50,    -1,    51,
-      -1,    50,    51,    -1,    37,     7,    36,    36,    -1,    53,
-      40,    36,    -1,    53,    40,    33,    -1,    37,     9,    36,
-      52,    -1,    37,    10,    52,    36,    36,    54,    -1,    37,
-      11,    52,    36,    54,    -1,    37,    12,    52,    52,    52,
-      -1,    37,    13,    52,    52,    -1,    37,    15,    55,    -1,
-      37,    16,    36,    36,    52,    52,    -1,    37,    14,    52,
-      56,    -1,    37,    29,    36,    -1,    37,    30,    52,    -1,
-      37,    17,    52,    52,    -1,    37,    18,    52,    52,    -1,
-      37,    19,    52,    52,    -1,    37,    20,    52,    52,    -1,
-      37,    21,    52,    -1,    37,    22,    52,    52,    -1,    37,
-      23,    52,    52,    -1,    37,    24,    52,    52,    -1,    37,
-      25,    52,    -1,    37,    26,    35,    -1,    37,    27,    34,
-      -1,    37,    28,    35,    -1,    37,    32,    36,    -1,    37,
-      31,    -1,    38,    39,    -1,    38,    55,    39,    -1,    52,
-      -1,    55,    52,    -1,    57,    -1,    56,    57,    -1,    37,
-       8,    36,    36,    52,    -1
-};
-
-/* YYRLINE[YYN] -- source line where rule number YYN was defined.  */
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
 static const yytype_uint8 yyrline[] =
 {
-       0,    69,    69,    71,    77,    81,    84,    89,    96,    97,
-     102,   104,   108,   110,   115,   116,   121,   123,   127,   131,
-     135,   138,   141,   144,   147,   150,   153,   156,   159,   162,
-     165,   168,   171,   174,   177,   180,   183,   186,   189,   192,
-     195,   198,   201,   209,   212,   216,   218,   223,   225,   230,
-     232,   237
+       0,    64,    64,    66,    71,    75,    78,    83,    89,    90,
+      95,    97,   101,   103,   108,   109,   114,   116,   120,   124,
+     127,   131,   133,   135,   137,   139,   141,   143,   145,   147,
+     149,   151,   153,   155,   157,   159,   161,   163,   165,   167,
+     169,   171,   173,   175,   182,   184,   188,   190,   195,   197,
+     202,   204,   208,   214,   216,   220
 };
 #endif
 
-#if YYDEBUG || YYERROR_VERBOSE || YYTOKEN_TABLE
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
 /* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
    First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
 static const char *const yytname[] =
 {
-  "$end", "error", "$undefined", "PROGRAM", "CLASS", "METHOD", "ATTR",
-  "FORMAL", "BRANCH", "ASSIGN", "STATIC_DISPATCH", "DISPATCH", "COND",
-  "LOOP", "TYPCASE", "BLOCK", "LET", "PLUS", "SUB", "MUL", "DIVIDE", "NEG",
-  "LT", "EQ", "LEQ", "COMP", "INT", "STR", "BOOL", "NEW", "ISVOID",
-  "NO_EXPR", "OBJECT", "NO_TYPE", "STR_CONST", "INT_CONST", "ID", "LINENO",
-  "'('", "')'", "':'", "$accept", "program", "nothing", "class_list",
-  "class", "optional_feature_list", "feature_list", "feature", "formals",
-  "formal_list", "formal", "expr", "expr_aux", "actuals", "expr_list",
-  "case_list", "simple_case", 0
+  "\"end of file\"", "error", "\"invalid token\"", "PROGRAM", "CLASS",
+  "METHOD", "ATTR", "FORMAL", "BRANCH", "ASSIGN", "STATIC_DISPATCH",
+  "DISPATCH", "COND", "LOOP", "TYPCASE", "BLOCK", "LET", "PLUS", "SUB",
+  "MUL", "DIVIDE", "NEG", "LT", "EQ", "LEQ", "COMP", "INT", "STR", "BOOL",
+  "NEW", "ISVOID", "NO_EXPR", "OBJECT", "NO_TYPE", "STR_CONST",
+  "INT_CONST", "ID", "LINENO", "'('", "')'", "':'", "$accept", "program",
+  "nothing", "class_list", "class", "optional_feature_list",
+  "feature_list", "feature", "formals", "formal_list", "formal", "expr",
+  "expr_aux", "actuals", "expr_list", "case_list", "simple_case",
+  "binding_list", "binding", YY_NULLPTR
 };
-#endif
 
-# ifdef YYPRINT
-/* YYTOKNUM[YYLEX-NUM] -- Internal token number corresponding to
-   token YYLEX-NUM.  */
-static const yytype_uint16 yytoknum[] =
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
 {
-       0,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
-     285,   286,   287,   288,   289,   290,   291,   292,    40,    41,
-      58
-};
-# endif
+  return yytname[yysymbol];
+}
+#endif
 
-/* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
-static const yytype_uint8 yyr1[] =
-{
-       0,    41,    42,    42,    43,    44,    44,    45,    46,    46,
-      47,    47,    48,    48,    49,    49,    50,    50,    51,    52,
-      52,    53,    53,    53,    53,    53,    53,    53,    53,    53,
-      53,    53,    53,    53,    53,    53,    53,    53,    53,    53,
-      53,    53,    53,    53,    53,    54,    54,    55,    55,    56,
-      56,    57
-};
+#define YYPACT_NINF (-34)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-1)
 
-/* YYR2[YYN] -- Number of symbols composing right hand side of rule YYN.  */
-static const yytype_uint8 yyr2[] =
+#define yytable_value_is_error(Yyn) \
+  0
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int8 yypact[] =
 {
-       0,     2,     4,     1,     0,     1,     2,     8,     0,     1,
-       1,     2,     6,     5,     0,     1,     1,     2,     4,     3,
-       3,     4,     6,     5,     5,     4,     3,     6,     4,     3,
-       3,     4,     4,     4,     4,     3,     4,     4,     4,     3,
-       3,     3,     3,     3,     2,     2,     3,     1,     2,     1,
-       2,     5
+     -34,    27,    -8,   -34,    28,    -5,    29,    -5,   -34,    -2,
+     -34,     0,     3,     2,     4,    10,     5,     4,   -34,     7,
+      13,   -34,   -34,    16,    18,    48,    20,    16,   -34,    21,
+      23,    21,   -34,    92,   -34,    17,    24,   -34,    25,    21,
+      21,    21,    21,    21,    21,   -33,    21,    21,    21,    21,
+      21,    21,    21,    21,    21,    31,    30,    32,    26,    21,
+     -34,    33,   -32,   -34,    21,    34,    36,    21,    21,    37,
+     -34,    21,    39,    40,    21,    21,    21,    21,   -34,    21,
+      21,    21,   -34,   -34,   -34,   -34,   -34,   -34,   -34,   -34,
+     -34,   -34,    42,    35,    21,   -34,    55,    37,   -34,   -34,
+      21,    43,   -31,   -34,   -34,   -34,   -34,   -34,   -34,   -34,
+     -34,    35,   -30,   -34,   -34,    44,   -34,    21,    45,    21,
+     -34,   -34,   -34,   -11,    46,   -34,    21,   -34,   -34,    21,
+     -34,   -34
 };
 
-/* YYDEFACT[STATE-NAME] -- Default rule to reduce with in state
-   STATE-NUM when YYTABLE doesn't specify something else to do.  Zero
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
    means the default is an error.  */
-static const yytype_uint8 yydefact[] =
+static const yytype_int8 yydefact[] =
 {
        4,     0,     3,     1,     0,     0,     0,     2,     5,     0,
        6,     0,     0,     0,     8,     0,     0,     9,    10,     0,
@@ -601,89 +649,70 @@ static const yytype_uint8 yydefact[] =
        0,     0,    17,     0,    13,     0,     0,    12,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-      44,     0,     0,    18,     0,     0,     0,     0,     0,     0,
-      47,    26,     0,     0,     0,     0,     0,    35,     0,     0,
-       0,    39,    40,    41,    42,    29,    30,    43,    20,    19,
-      21,     0,     0,     0,    25,     0,    28,    49,    48,     0,
-      31,    32,    33,    34,    36,    37,    38,     0,     0,    23,
-      24,     0,    50,     0,    22,    45,     0,     0,    27,    46,
-       0,    51
-};
-
-/* YYDEFGOTO[NTERM-NUM].  */
-static const yytype_int8 yydefgoto[] =
-{
-      -1,     1,     2,     7,     8,    16,    17,    18,    26,    27,
-      28,    70,    35,   109,    71,    96,    97
+      45,     0,     0,    18,     0,     0,     0,     0,     0,     0,
+      48,    26,     0,     0,     0,     0,     0,     0,    36,     0,
+       0,     0,    40,    41,    42,    43,    30,    31,    44,    20,
+      19,    21,     0,     0,     0,    25,     0,    29,    50,    49,
+       0,     0,     0,    53,    32,    33,    34,    35,    37,    38,
+      39,     0,     0,    23,    24,     0,    51,     0,     0,     0,
+      54,    22,    46,     0,     0,    27,     0,    28,    47,     0,
+      55,    52
 };
 
-/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
-   STATE-NUM.  */
-#define YYPACT_NINF -35
-static const yytype_int8 yypact[] =
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int8 yypgoto[] =
 {
-     -35,     7,   -28,   -35,    23,   -10,    24,   -10,   -35,    -7,
-     -35,    -5,    -2,    -4,    -1,    10,    -6,    -1,   -35,     1,
-       4,   -35,   -35,     6,     5,    41,    16,     6,   -35,    17,
-      19,    17,   -35,    83,   -35,    13,    20,   -35,    21,    17,
-      17,    17,    17,    17,    17,    22,    17,    17,    17,    17,
-      17,    17,    17,    17,    17,    25,    27,    28,    26,    17,
-     -35,    29,   -32,   -35,    17,    30,    31,    17,    17,    32,
-     -35,    17,    35,    17,    17,    17,    17,   -35,    17,    17,
-      17,   -35,   -35,   -35,   -35,   -35,   -35,   -35,   -35,   -35,
-     -35,    36,    37,    17,   -35,    51,    32,   -35,   -35,    17,
-     -35,   -35,   -35,   -35,   -35,   -35,   -35,    37,   -34,   -35,
-     -35,    38,   -35,    17,   -35,   -35,   -31,    40,   -35,   -35,
-      17,   -35
+     -34,   -34,   -34,   -34,    61,   -34,   -34,    59,   -34,   -34,
+      56,   -29,   -34,   -27,   -26,   -34,   -12,   -34,   -15
 };
 
-/* YYPGOTO[NTERM-NUM].  */
-static const yytype_int8 yypgoto[] =
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int8 yydefgoto[] =
 {
-     -35,   -35,   -35,   -35,    61,   -35,   -35,    56,   -35,   -35,
-      50,   -29,   -35,   -27,   -30,   -35,   -17
+       0,     1,     2,     7,     8,    16,    17,    18,    26,    27,
+      28,    70,    35,   113,    71,    97,    98,   102,   103
 };
 
-/* YYTABLE[YYPACT[STATE-NUM]].  What to do in state STATE-NUM.  If
-   positive, shift that token.  If negative, reduce the rule which
-   number is the opposite.  If zero, do what YYDEFACT says.
-   If YYTABLE_NINF, syntax error.  */
-#define YYTABLE_NINF -1
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
 static const yytype_uint8 yytable[] =
 {
-      34,    88,    37,    33,    89,   115,    33,     3,   119,     4,
-      65,    66,    67,    68,    69,    19,    20,    73,    74,    75,
-      76,    77,    78,    79,    80,    81,     5,     6,     9,    11,
-      86,    12,    13,    21,    14,    90,    15,    23,    93,    94,
-      24,    29,    98,    25,   100,   101,   102,   103,    30,   104,
-     105,   106,    31,    62,    33,    36,    63,    64,    72,   111,
-      82,    83,    85,    84,   110,    87,    91,    92,    10,    95,
-     113,    99,   107,    22,   117,   108,   120,    32,   116,   112,
-     114,     0,     0,     0,   118,     0,     0,    98,     0,     0,
-       0,   121,    38,    39,    40,    41,    42,    43,    44,    45,
-      46,    47,    48,    49,    50,    51,    52,    53,    54,    55,
-      56,    57,    58,    59,    60,    61
+      34,    89,    37,    72,    90,    73,   101,    33,   119,   122,
+      65,    66,    67,    68,    69,    19,    20,    74,    75,    76,
+      77,    78,    79,    80,    81,    82,    33,     3,   128,     4,
+      87,     5,     6,     9,    11,    91,    12,    13,    94,    95,
+      14,    15,    99,    23,    21,   104,   105,   106,   107,    24,
+     108,   109,   110,    25,    29,    30,    31,    62,    33,    36,
+      63,    64,    86,   115,    84,   114,    83,    85,    10,    88,
+      92,   117,    93,   112,    96,   100,    22,   101,   111,   118,
+     124,   126,   129,    32,   121,   116,   123,   120,   125,     0,
+     127,     0,     0,     0,    99,     0,     0,   130,     0,     0,
+     131,    38,    39,    40,    41,    42,    43,    44,    45,    46,
+      47,    48,    49,    50,    51,    52,    53,    54,    55,    56,
+      57,    58,    59,    60,    61
 };
 
-static const yytype_int8 yycheck[] =
+static const yytype_int16 yycheck[] =
 {
-      29,    33,    31,    37,    36,    39,    37,     0,    39,    37,
+      29,    33,    31,    36,    36,    38,    37,    37,    39,    39,
       39,    40,    41,    42,    43,     5,     6,    46,    47,    48,
-      49,    50,    51,    52,    53,    54,     3,    37,     4,    36,
-      59,    36,    34,    39,    38,    64,    37,    36,    67,    68,
-      36,    36,    71,    37,    73,    74,    75,    76,     7,    78,
-      79,    80,    36,    40,    37,    36,    36,    36,    36,     8,
-      35,    34,    36,    35,    93,    36,    36,    36,     7,    37,
-      99,    36,    36,    17,    36,    38,    36,    27,   108,    96,
-     107,    -1,    -1,    -1,   113,    -1,    -1,   116,    -1,    -1,
-      -1,   120,     9,    10,    11,    12,    13,    14,    15,    16,
-      17,    18,    19,    20,    21,    22,    23,    24,    25,    26,
-      27,    28,    29,    30,    31,    32
+      49,    50,    51,    52,    53,    54,    37,     0,    39,    37,
+      59,     3,    37,     4,    36,    64,    36,    34,    67,    68,
+      38,    37,    71,    36,    39,    74,    75,    76,    77,    36,
+      79,    80,    81,    37,    36,     7,    36,    40,    37,    36,
+      36,    36,    36,     8,    34,    94,    35,    35,     7,    36,
+      36,   100,    36,    38,    37,    36,    17,    37,    36,    36,
+      36,    36,    36,    27,   111,    97,   112,   102,   117,    -1,
+     119,    -1,    -1,    -1,   123,    -1,    -1,   126,    -1,    -1,
+     129,     9,    10,    11,    12,    13,    14,    15,    16,    17,
+      18,    19,    20,    21,    22,    23,    24,    25,    26,    27,
+      28,    29,    30,    31,    32
 };
 
-/* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-   symbol of state STATE-NUM.  */
-static const yytype_uint8 yystos[] =
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int8 yystos[] =
 {
        0,    42,    43,     0,    37,     3,    37,    44,    45,     4,
       45,    36,    36,    34,    38,    37,    46,    47,    48,     5,
@@ -692,103 +721,72 @@ static const yytype_uint8 yystos[] =
       11,    12,    13,    14,    15,    16,    17,    18,    19,    20,
       21,    22,    23,    24,    25,    26,    27,    28,    29,    30,
       31,    32,    40,    36,    36,    52,    52,    52,    52,    52,
-      52,    55,    36,    52,    52,    52,    52,    52,    52,    52,
-      52,    52,    35,    34,    35,    36,    52,    36,    33,    36,
-      52,    36,    36,    52,    52,    37,    56,    57,    52,    36,
-      52,    52,    52,    52,    52,    52,    52,    36,    38,    54,
-      52,     8,    57,    52,    54,    39,    55,    36,    52,    39,
-      36,    52
+      52,    55,    36,    38,    52,    52,    52,    52,    52,    52,
+      52,    52,    52,    35,    34,    35,    36,    52,    36,    33,
+      36,    52,    36,    36,    52,    52,    37,    56,    57,    52,
+      36,    37,    58,    59,    52,    52,    52,    52,    52,    52,
+      52,    36,    38,    54,    52,     8,    57,    52,    36,    39,
+      59,    54,    39,    55,    36,    52,    36,    52,    39,    36,
+      52,    52
 };
 
-#define yyerrok		(yyerrstatus = 0)
-#define yyclearin	(yychar = YYEMPTY)
-#define YYEMPTY		(-2)
-#define YYEOF		0
-
-#define YYACCEPT	goto yyacceptlab
-#define YYABORT		goto yyabortlab
-#define YYERROR		goto yyerrorlab
-
-
-/* Like YYERROR except do call yyerror.  This remains here temporarily
-   to ease the transition to the new meaning of YYERROR, for GCC.
-   Once GCC version 2 has supplanted version 1, this can go.  */
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr1[] =
+{
+       0,    41,    42,    42,    43,    44,    44,    45,    46,    46,
+      47,    47,    48,    48,    49,    49,    50,    50,    51,    52,
+      52,    53,    53,    53,    53,    53,    53,    53,    53,    53,
+      53,    53,    53,    53,    53,    53,    53,    53,    53,    53,
+      53,    53,    53,    53,    53,    53,    54,    54,    55,    55,
+      56,    56,    57,    58,    58,    59
+};
 
-#define YYFAIL		goto yyerrlab
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     4,     1,     0,     1,     2,     8,     0,     1,
+       1,     2,     6,     5,     0,     1,     1,     2,     4,     3,
+       3,     4,     6,     5,     5,     4,     3,     6,     6,     4,
+       3,     3,     4,     4,     4,     4,     3,     4,     4,     4,
+       3,     3,     3,     3,     3,     2,     2,     3,     1,     2,
+       1,     2,     5,     1,     2,     4
+};
 
-#define YYRECOVERING()  (!!yyerrstatus)
 
-#define YYBACKUP(Token, Value)					\
-do								\
-  if (yychar == YYEMPTY && yylen == 1)				\
-    {								\
-      yychar = (Token);						\
-      yylval = (Value);						\
-      yytoken = YYTRANSLATE (yychar);				\
-      YYPOPSTACK (1);						\
-      goto yybackup;						\
-    }								\
-  else								\
-    {								\
-      yyerror (YY_("syntax error: cannot back up")); \
-      YYERROR;							\
-    }								\
-while (YYID (0))
-
-
-#define YYTERROR	1
-#define YYERRCODE	256
-
-
-/* YYLLOC_DEFAULT -- Set CURRENT to span from RHS[1] to RHS[N].
-   If N is 0, then set CURRENT to the empty location which ends
-   the previous symbol: RHS[0] (always defined).  */
-
-#define YYRHSLOC(Rhs, K) ((Rhs)[K])
-#ifndef YYLLOC_DEFAULT
-# define YYLLOC_DEFAULT(Current, Rhs, N)				\
-    do									\
-      if (YYID (N))                                                    \
-	{								\
-	  (Current).first_line   = YYRHSLOC (Rhs, 1).first_line;	\
-	  (Current).first_column = YYRHSLOC (Rhs, 1).first_column;	\
-	  (Current).last_line    = YYRHSLOC (Rhs, N).last_line;		\
-	  (Current).last_column  = YYRHSLOC (Rhs, N).last_column;	\
-	}								\
-      else								\
-	{								\
-	  (Current).first_line   = (Current).last_line   =		\
-	    YYRHSLOC (Rhs, 0).last_line;				\
-	  (Current).first_column = (Current).last_column =		\
-	    YYRHSLOC (Rhs, 0).last_column;				\
-	}								\
-    while (YYID (0))
-#endif
+enum { YYENOMEM = -2 };
 
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
 
-/* YY_LOCATION_PRINT -- Print the location on the stream.
-   This macro was not mandated originally: define only if we know
-   we won't break user code: when these are the locations we know.  */
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
 
-#ifndef YY_LOCATION_PRINT
-# if YYLTYPE_IS_TRIVIAL
-#  define YY_LOCATION_PRINT(File, Loc)			\
-     fprintf (File, "%d.%d-%d.%d",			\
-	      (Loc).first_line, (Loc).first_column,	\
-	      (Loc).last_line,  (Loc).last_column)
-# else
-#  define YY_LOCATION_PRINT(File, Loc) ((void) 0)
-# endif
-#endif
 
+#define YYRECOVERING()  (!!yyerrstatus)
 
-/* YYLEX -- calling `yylex' with the right arguments.  */
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
 
-#ifdef YYLEX_PARAM
-# define YYLEX yylex (YYLEX_PARAM)
-#else
-# define YYLEX yylex ()
-#endif
 
 /* Enable debugging if requested.  */
 #if YYDEBUG
@@ -798,80 +796,58 @@ while (YYID (0))
 #  define YYFPRINTF fprintf
 # endif
 
-# define YYDPRINTF(Args)			\
-do {						\
-  if (yydebug)					\
-    YYFPRINTF Args;				\
-} while (YYID (0))
-
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)			  \
-do {									  \
-  if (yydebug)								  \
-    {									  \
-      YYFPRINTF (stderr, "%s ", Title);					  \
-      yy_symbol_print (stderr,						  \
-		  Type, Value); \
-      YYFPRINTF (stderr, "\n");						  \
-    }									  \
-} while (YYID (0))
-
-
-/*--------------------------------.
-| Print this symbol on YYOUTPUT.  |
-`--------------------------------*/
-
-/*ARGSUSED*/
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_symbol_value_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep)
-#else
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
 static void
-yy_symbol_value_print (yyoutput, yytype, yyvaluep)
-    FILE *yyoutput;
-    int yytype;
-    YYSTYPE const * const yyvaluep;
-#endif
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
 {
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
   if (!yyvaluep)
     return;
-# ifdef YYPRINT
-  if (yytype < YYNTOKENS)
-    YYPRINT (yyoutput, yytoknum[yytype], *yyvaluep);
-# else
-  YYUSE (yyoutput);
-# endif
-  switch (yytype)
-    {
-      default:
-	break;
-    }
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-/*--------------------------------.
-| Print this symbol on YYOUTPUT.  |
-`--------------------------------*/
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
 static void
-yy_symbol_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep)
-#else
-static void
-yy_symbol_print (yyoutput, yytype, yyvaluep)
-    FILE *yyoutput;
-    int yytype;
-    YYSTYPE const * const yyvaluep;
-#endif
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
 {
-  if (yytype < YYNTOKENS)
-    YYFPRINTF (yyoutput, "token %s (", yytname[yytype]);
-  else
-    YYFPRINTF (yyoutput, "nterm %s (", yytname[yytype]);
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
 
-  yy_symbol_value_print (yyoutput, yytype, yyvaluep);
-  YYFPRINTF (yyoutput, ")");
+  yy_symbol_value_print (yyo, yykind, yyvaluep);
+  YYFPRINTF (yyo, ")");
 }
 
 /*------------------------------------------------------------------.
@@ -879,80 +855,68 @@ yy_symbol_print (yyoutput, yytype, yyvaluep)
 | TOP (included).                                                   |
 `------------------------------------------------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_stack_print (yytype_int16 *bottom, yytype_int16 *top)
-#else
 static void
-yy_stack_print (bottom, top)
-    yytype_int16 *bottom;
-    yytype_int16 *top;
-#endif
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
 {
   YYFPRINTF (stderr, "Stack now");
-  for (; bottom <= top; ++bottom)
-    YYFPRINTF (stderr, " %d", *bottom);
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
   YYFPRINTF (stderr, "\n");
 }
 
-# define YY_STACK_PRINT(Bottom, Top)				\
-do {								\
-  if (yydebug)							\
-    yy_stack_print ((Bottom), (Top));				\
-} while (YYID (0))
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
 
 
 /*------------------------------------------------.
 | Report that the YYRULE is going to be reduced.  |
 `------------------------------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_reduce_print (YYSTYPE *yyvsp, int yyrule)
-#else
 static void
-yy_reduce_print (yyvsp, yyrule)
-    YYSTYPE *yyvsp;
-    int yyrule;
-#endif
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule)
 {
+  int yylno = yyrline[yyrule];
   int yynrhs = yyr2[yyrule];
   int yyi;
-  unsigned long int yylno = yyrline[yyrule];
-  YYFPRINTF (stderr, "Reducing stack by rule %d (line %lu):\n",
-	     yyrule - 1, yylno);
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
   /* The symbols being reduced.  */
   for (yyi = 0; yyi < yynrhs; yyi++)
     {
-      fprintf (stderr, "   $%d = ", yyi + 1);
-      yy_symbol_print (stderr, yyrhs[yyprhs[yyrule] + yyi],
-		       &(yyvsp[(yyi + 1) - (yynrhs)])
-		       		       );
-      fprintf (stderr, "\n");
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)]);
+      YYFPRINTF (stderr, "\n");
     }
 }
 
-# define YY_REDUCE_PRINT(Rule)		\
-do {					\
-  if (yydebug)				\
-    yy_reduce_print (yyvsp, Rule); \
-} while (YYID (0))
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule); \
+} while (0)
 
 /* Nonzero means print parse trace.  It is left uninitialized so that
    multiple parsers can coexist.  */
 int yydebug;
 #else /* !YYDEBUG */
-# define YYDPRINTF(Args)
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
 # define YY_STACK_PRINT(Bottom, Top)
 # define YY_REDUCE_PRINT(Rule)
 #endif /* !YYDEBUG */
 
 
 /* YYINITDEPTH -- initial size of the parser's stacks.  */
-#ifndef	YYINITDEPTH
+#ifndef YYINITDEPTH
 # define YYINITDEPTH 200
 #endif
 
@@ -967,478 +931,219 @@ int yydebug;
 # define YYMAXDEPTH 10000
 #endif
 
-
 
-#if YYERROR_VERBOSE
 
-# ifndef yystrlen
-#  if defined __GLIBC__ && defined _STRING_H
-#   define yystrlen strlen
-#  else
-/* Return the length of YYSTR.  */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static YYSIZE_T
-yystrlen (const char *yystr)
-#else
-static YYSIZE_T
-yystrlen (yystr)
-    const char *yystr;
-#endif
-{
-  YYSIZE_T yylen;
-  for (yylen = 0; yystr[yylen]; yylen++)
-    continue;
-  return yylen;
-}
-#  endif
-# endif
 
-# ifndef yystpcpy
-#  if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
-#   define yystpcpy stpcpy
-#  else
-/* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
-   YYDEST.  */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static char *
-yystpcpy (char *yydest, const char *yysrc)
-#else
-static char *
-yystpcpy (yydest, yysrc)
-    char *yydest;
-    const char *yysrc;
-#endif
-{
-  char *yyd = yydest;
-  const char *yys = yysrc;
 
-  while ((*yyd++ = *yys++) != '\0')
-    continue;
-
-  return yyd - 1;
-}
-#  endif
-# endif
-
-# ifndef yytnamerr
-/* Copy to YYRES the contents of YYSTR after stripping away unnecessary
-   quotes and backslashes, so that it's suitable for yyerror.  The
-   heuristic is that double-quoting is unnecessary unless the string
-   contains an apostrophe, a comma, or backslash (other than
-   backslash-backslash).  YYSTR is taken from yytname.  If YYRES is
-   null, do not copy; instead, return the length of what the result
-   would have been.  */
-static YYSIZE_T
-yytnamerr (char *yyres, const char *yystr)
-{
-  if (*yystr == '"')
-    {
-      YYSIZE_T yyn = 0;
-      char const *yyp = yystr;
-
-      for (;;)
-	switch (*++yyp)
-	  {
-	  case '\'':
-	  case ',':
-	    goto do_not_strip_quotes;
-
-	  case '\\':
-	    if (*++yyp != '\\')
-	      goto do_not_strip_quotes;
-	    /* Fall through.  */
-	  default:
-	    if (yyres)
-	      yyres[yyn] = *yyp;
-	    yyn++;
-	    break;
-
-	  case '"':
-	    if (yyres)
-	      yyres[yyn] = '\0';
-	    return yyn;
-	  }
-    do_not_strip_quotes: ;
-    }
-
-  if (! yyres)
-    return yystrlen (yystr);
-
-  return yystpcpy (yyres, yystr) - yyres;
-}
-# endif
-
-/* Copy into YYRESULT an error message about the unexpected token
-   YYCHAR while in state YYSTATE.  Return the number of bytes copied,
-   including the terminating null byte.  If YYRESULT is null, do not
-   copy anything; just return the number of bytes that would be
-   copied.  As a special case, return 0 if an ordinary "syntax error"
-   message will do.  Return YYSIZE_MAXIMUM if overflow occurs during
-   size calculation.  */
-static YYSIZE_T
-yysyntax_error (char *yyresult, int yystate, int yychar)
-{
-  int yyn = yypact[yystate];
-
-  if (! (YYPACT_NINF < yyn && yyn <= YYLAST))
-    return 0;
-  else
-    {
-      int yytype = YYTRANSLATE (yychar);
-      YYSIZE_T yysize0 = yytnamerr (0, yytname[yytype]);
-      YYSIZE_T yysize = yysize0;
-      YYSIZE_T yysize1;
-      int yysize_overflow = 0;
-      enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-      char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
-      int yyx;
-
-# if 0
-      /* This is so xgettext sees the translatable formats that are
-	 constructed on the fly.  */
-      YY_("syntax error, unexpected %s");
-      YY_("syntax error, unexpected %s, expecting %s");
-      YY_("syntax error, unexpected %s, expecting %s or %s");
-      YY_("syntax error, unexpected %s, expecting %s or %s or %s");
-      YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s");
-# endif
-      char *yyfmt;
-      char const *yyf;
-      static char const yyunexpected[] = "syntax error, unexpected %s";
-      static char const yyexpecting[] = ", expecting %s";
-      static char const yyor[] = " or %s";
-      char yyformat[sizeof yyunexpected
-		    + sizeof yyexpecting - 1
-		    + ((YYERROR_VERBOSE_ARGS_MAXIMUM - 2)
-		       * (sizeof yyor - 1))];
-      char const *yyprefix = yyexpecting;
-
-      /* Start YYX at -YYN if negative to avoid negative indexes in
-	 YYCHECK.  */
-      int yyxbegin = yyn < 0 ? -yyn : 0;
-
-      /* Stay within bounds of both yycheck and yytname.  */
-      int yychecklim = YYLAST - yyn + 1;
-      int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
-      int yycount = 1;
-
-      yyarg[0] = yytname[yytype];
-      yyfmt = yystpcpy (yyformat, yyunexpected);
-
-      for (yyx = yyxbegin; yyx < yyxend; ++yyx)
-	if (yycheck[yyx + yyn] == yyx && yyx != YYTERROR)
-	  {
-	    if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-	      {
-		yycount = 1;
-		yysize = yysize0;
-		yyformat[sizeof yyunexpected - 1] = '\0';
-		break;
-	      }
-	    yyarg[yycount++] = yytname[yyx];
-	    yysize1 = yysize + yytnamerr (0, yytname[yyx]);
-	    yysize_overflow |= (yysize1 < yysize);
-	    yysize = yysize1;
-	    yyfmt = yystpcpy (yyfmt, yyprefix);
-	    yyprefix = yyor;
-	  }
-
-      yyf = YY_(yyformat);
-      yysize1 = yysize + yystrlen (yyf);
-      yysize_overflow |= (yysize1 < yysize);
-      yysize = yysize1;
-
-      if (yysize_overflow)
-	return YYSIZE_MAXIMUM;
-
-      if (yyresult)
-	{
-	  /* Avoid sprintf, as that infringes on the user's name space.
-	     Don't have undefined behavior even if the translation
-	     produced a string with the wrong number of "%s"s.  */
-	  char *yyp = yyresult;
-	  int yyi = 0;
-	  while ((*yyp = *yyf) != '\0')
-	    {
-	      if (*yyp == '%' && yyf[1] == 's' && yyi < yycount)
-		{
-		  yyp += yytnamerr (yyp, yyarg[yyi++]);
-		  yyf += 2;
-		}
-	      else
-		{
-		  yyp++;
-		  yyf++;
-		}
-	    }
-	}
-      return yysize;
-    }
-}
-#endif /* YYERROR_VERBOSE */
-
 
 /*-----------------------------------------------.
 | Release the memory associated to this symbol.  |
 `-----------------------------------------------*/
 
-/*ARGSUSED*/
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
 static void
-yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep)
-#else
-static void
-yydestruct (yymsg, yytype, yyvaluep)
-    const char *yymsg;
-    int yytype;
-    YYSTYPE *yyvaluep;
-#endif
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
 {
-  YYUSE (yyvaluep);
-
+  YY_USE (yyvaluep);
   if (!yymsg)
     yymsg = "Deleting";
-  YY_SYMBOL_PRINT (yymsg, yytype, yyvaluep, yylocationp);
-
-  switch (yytype)
-    {
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
 
-      default:
-	break;
-    }
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
-
-
-/* Prevent warnings from -Wmissing-prototypes.  */
-
-#ifdef YYPARSE_PARAM
-#if defined __STDC__ || defined __cplusplus
-int yyparse (void *YYPARSE_PARAM);
-#else
-int yyparse ();
-#endif
-#else /* ! YYPARSE_PARAM */
-#if defined __STDC__ || defined __cplusplus
-int yyparse (void);
-#else
-int yyparse ();
-#endif
-#endif /* ! YYPARSE_PARAM */
 
 
-
-/* The look-ahead symbol.  */
+/* Lookahead token kind.  */
 int yychar;
 
-/* The semantic value of the look-ahead symbol.  */
+/* The semantic value of the lookahead symbol.  */
 YYSTYPE yylval;
-
 /* Number of syntax errors so far.  */
 int yynerrs;
 
 
 
+
 /*----------.
 | yyparse.  |
 `----------*/
 
-#ifdef YYPARSE_PARAM
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-int
-yyparse (void *YYPARSE_PARAM)
-#else
-int
-yyparse (YYPARSE_PARAM)
-    void *YYPARSE_PARAM;
-#endif
-#else /* ! YYPARSE_PARAM */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
 int
 yyparse (void)
-#else
-int
-yyparse ()
-
-#endif
-#endif
 {
-  
-  int yystate;
-  int yyn;
-  int yyresult;
-  /* Number of tokens to shift before error messages enabled.  */
-  int yyerrstatus;
-  /* Look-ahead token as an internal (translated) token number.  */
-  int yytoken = 0;
-#if YYERROR_VERBOSE
-  /* Buffer for error messages, and its allocated size.  */
-  char yymsgbuf[128];
-  char *yymsg = yymsgbuf;
-  YYSIZE_T yymsg_alloc = sizeof yymsgbuf;
-#endif
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
 
-  /* Three stacks and their tools:
-     `yyss': related to states,
-     `yyvs': related to semantic values,
-     `yyls': related to locations.
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
 
-     Refer to the stacks thru separate pointers, to allow yyoverflow
-     to reallocate them elsewhere.  */
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
 
-  /* The state stack.  */
-  yytype_int16 yyssa[YYINITDEPTH];
-  yytype_int16 *yyss = yyssa;
-  yytype_int16 *yyssp;
-
-  /* The semantic value stack.  */
-  YYSTYPE yyvsa[YYINITDEPTH];
-  YYSTYPE *yyvs = yyvsa;
-  YYSTYPE *yyvsp;
-
-
-
-#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
 
-  YYSIZE_T yystacksize = YYINITDEPTH;
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
 
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
   /* The variables used to return semantic value and location from the
      action routines.  */
   YYSTYPE yyval;
 
 
+
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
+
   /* The number of symbols on the RHS of the reduced rule.
      Keep to zero when no symbol should be popped.  */
   int yylen = 0;
 
   YYDPRINTF ((stderr, "Starting parse\n"));
 
-  yystate = 0;
-  yyerrstatus = 0;
-  yynerrs = 0;
-  yychar = YYEMPTY;		/* Cause a token to be read.  */
-
-  /* Initialize stack pointers.
-     Waste one element of value and location stack
-     so that they stay on the same level as the state stack.
-     The wasted elements are never initialized.  */
-
-  yyssp = yyss;
-  yyvsp = yyvs;
+  yychar = YYEMPTY; /* Cause a token to be read.  */
 
   goto yysetstate;
 
+
 /*------------------------------------------------------------.
-| yynewstate -- Push a new state, which is found in yystate.  |
+| yynewstate -- push a new state, which is found in yystate.  |
 `------------------------------------------------------------*/
- yynewstate:
+yynewstate:
   /* In all cases, when you get here, the value and location stacks
      have just been pushed.  So pushing a state here evens the stacks.  */
   yyssp++;
 
- yysetstate:
-  *yyssp = yystate;
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
 
   if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
     {
       /* Get the current used size of the three stacks, in elements.  */
-      YYSIZE_T yysize = yyssp - yyss + 1;
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
 
-#ifdef yyoverflow
+# if defined yyoverflow
       {
-	/* Give user a chance to reallocate the stack.  Use copies of
-	   these so that the &'s don't force the real ones into
-	   memory.  */
-	YYSTYPE *yyvs1 = yyvs;
-	yytype_int16 *yyss1 = yyss;
-
-
-	/* Each stack pointer address is followed by the size of the
-	   data in use in that stack, in bytes.  This used to be a
-	   conditional around just the two extra args, but that might
-	   be undefined if yyoverflow is a macro.  */
-	yyoverflow (YY_("memory exhausted"),
-		    &yyss1, yysize * sizeof (*yyssp),
-		    &yyvs1, yysize * sizeof (*yyvsp),
-
-		    &yystacksize);
-
-	yyss = yyss1;
-	yyvs = yyvs1;
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
       }
-#else /* no yyoverflow */
-# ifndef YYSTACK_RELOCATE
-      goto yyexhaustedlab;
-# else
+# else /* defined YYSTACK_RELOCATE */
       /* Extend the stack our own way.  */
       if (YYMAXDEPTH <= yystacksize)
-	goto yyexhaustedlab;
+        YYNOMEM;
       yystacksize *= 2;
       if (YYMAXDEPTH < yystacksize)
-	yystacksize = YYMAXDEPTH;
+        yystacksize = YYMAXDEPTH;
 
       {
-	yytype_int16 *yyss1 = yyss;
-	union yyalloc *yyptr =
-	  (union yyalloc *) YYSTACK_ALLOC (YYSTACK_BYTES (yystacksize));
-	if (! yyptr)
-	  goto yyexhaustedlab;
-	YYSTACK_RELOCATE (yyss);
-	YYSTACK_RELOCATE (yyvs);
-
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
 #  undef YYSTACK_RELOCATE
-	if (yyss1 != yyssa)
-	  YYSTACK_FREE (yyss1);
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
       }
 # endif
-#endif /* no yyoverflow */
 
       yyssp = yyss + yysize - 1;
       yyvsp = yyvs + yysize - 1;
 
-
-      YYDPRINTF ((stderr, "Stack size increased to %lu\n",
-		  (unsigned long int) yystacksize));
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
 
       if (yyss + yystacksize - 1 <= yyssp)
-	YYABORT;
+        YYABORT;
     }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
 
-  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
 
   goto yybackup;
 
+
 /*-----------.
 | yybackup.  |
 `-----------*/
 yybackup:
-
   /* Do appropriate processing given the current state.  Read a
-     look-ahead token if we need one and don't already have one.  */
+     lookahead token if we need one and don't already have one.  */
 
-  /* First try to decide what to do without reference to look-ahead token.  */
+  /* First try to decide what to do without reference to lookahead token.  */
   yyn = yypact[yystate];
-  if (yyn == YYPACT_NINF)
+  if (yypact_value_is_default (yyn))
     goto yydefault;
 
-  /* Not known => get a look-ahead token if don't already have one.  */
+  /* Not known => get a lookahead token if don't already have one.  */
 
-  /* YYCHAR is either YYEMPTY or YYEOF or a valid look-ahead symbol.  */
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
   if (yychar == YYEMPTY)
     {
-      YYDPRINTF ((stderr, "Reading a token: "));
-      yychar = YYLEX;
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex ();
     }
 
   if (yychar <= YYEOF)
     {
-      yychar = yytoken = YYEOF;
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
       YYDPRINTF ((stderr, "Now at end of input.\n"));
     }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
   else
     {
       yytoken = YYTRANSLATE (yychar);
@@ -1453,30 +1158,26 @@ yybackup:
   yyn = yytable[yyn];
   if (yyn <= 0)
     {
-      if (yyn == 0 || yyn == YYTABLE_NINF)
-	goto yyerrlab;
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
       yyn = -yyn;
       goto yyreduce;
     }
 
-  if (yyn == YYFINAL)
-    YYACCEPT;
-
   /* Count tokens shifted since error; after three, turn off error
      status.  */
   if (yyerrstatus)
     yyerrstatus--;
 
-  /* Shift the look-ahead token.  */
+  /* Shift the lookahead token.  */
   YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
-
-  /* Discard the shifted token unless it is eof.  */
-  if (yychar != YYEOF)
-    yychar = YYEMPTY;
-
   yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
   goto yynewstate;
 
 
@@ -1491,14 +1192,14 @@ yydefault:
 
 
 /*-----------------------------.
-| yyreduce -- Do a reduction.  |
+| yyreduce -- do a reduction.  |
 `-----------------------------*/
 yyreduce:
   /* yyn is the number of a rule to reduce with.  */
   yylen = yyr2[yyn];
 
   /* If YYLEN is nonzero, implement the default value of the action:
-     `$$ = $1'.
+     '$$ = $1'.
 
      Otherwise, the following line sets YYVAL to garbage.
      This behavior is undocumented and Bison
@@ -1511,361 +1212,410 @@ yyreduce:
   YY_REDUCE_PRINT (yyn);
   switch (yyn)
     {
-        case 2:
-#line 70 "ast.y"
-    { node_lineno = (yyvsp[(2) - (4)].lineno); ast_root = program((yyvsp[(4) - (4)].classes)); }
+  case 2: /* program: nothing LINENO PROGRAM class_list  */
+#line 65 "ast.y"
+                { node_lineno = (yyvsp[-2].lineno); ast_root = program((yyvsp[0].classes)); }
+#line 1219 "ast.tab.c"
     break;
 
-  case 3:
-#line 72 "ast.y"
-    { exit(1); }
+  case 3: /* program: nothing  */
+#line 67 "ast.y"
+                { exit(1); }
+#line 1225 "ast.tab.c"
     break;
 
-  case 4:
-#line 77 "ast.y"
-    { current_line = 1; }
+  case 4: /* nothing: %empty  */
+#line 71 "ast.y"
+                { current_line = 1; }
+#line 1231 "ast.tab.c"
     break;
 
-  case 5:
-#line 82 "ast.y"
-    { (yyval.classes) = single_Classes((yyvsp[(1) - (1)].class_));
+  case 5: /* class_list: class  */
+#line 76 "ast.y"
+                { (yyval.classes) = single_Classes((yyvsp[0].class_));
                   parse_results = (yyval.classes); }
+#line 1238 "ast.tab.c"
     break;
 
-  case 6:
-#line 85 "ast.y"
-    { (yyval.classes) = append_Classes((yyvsp[(1) - (2)].classes),single_Classes((yyvsp[(2) - (2)].class_))); 
+  case 6: /* class_list: class_list class  */
+#line 79 "ast.y"
+                { (yyval.classes) = append_Classes((yyvsp[-1].classes),single_Classes((yyvsp[0].class_)));
                   parse_results = (yyval.classes); }
+#line 1245 "ast.tab.c"
     break;
 
-  case 7:
-#line 90 "ast.y"
-    { node_lineno = (yyvsp[(1) - (8)].lineno);
-		  (yyval.class_) = class_((yyvsp[(3) - (8)].symbol),(yyvsp[(4) - (8)].symbol),(yyvsp[(7) - (8)].features),(yyvsp[(5) - (8)].symbol)); }
+  case 7: /* class: LINENO CLASS ID ID STR_CONST '(' optional_feature_list ')'  */
+#line 84 "ast.y"
+                { node_lineno = (yyvsp[-7].lineno);
+		  (yyval.class_) = class_((yyvsp[-5].symbol),(yyvsp[-4].symbol),(yyvsp[-1].features),(yyvsp[-3].symbol)); }
+#line 1252 "ast.tab.c"
     break;
 
-  case 8:
+  case 8: /* optional_feature_list: %empty  */
+#line 89 "ast.y"
+                {  (yyval.features) = nil_Features(); }
+#line 1258 "ast.tab.c"
+    break;
+
+  case 9: /* optional_feature_list: feature_list  */
+#line 91 "ast.y"
+                {  (yyval.features) = (yyvsp[0].features); }
+#line 1264 "ast.tab.c"
+    break;
+
+  case 10: /* feature_list: feature  */
 #line 96 "ast.y"
-    {  (yyval.features) = nil_Features(); }
+                {  (yyval.features) = single_Features((yyvsp[0].feature)); }
+#line 1270 "ast.tab.c"
     break;
 
-  case 9:
+  case 11: /* feature_list: feature_list feature  */
 #line 98 "ast.y"
-    {  (yyval.features) = (yyvsp[(1) - (1)].features); }
+                {  (yyval.features) = append_Features((yyvsp[-1].features),single_Features((yyvsp[0].feature))); }
+#line 1276 "ast.tab.c"
     break;
 
-  case 10:
-#line 103 "ast.y"
-    {  (yyval.features) = single_Features((yyvsp[(1) - (1)].feature)); }
+  case 12: /* feature: LINENO METHOD ID formals ID expr  */
+#line 102 "ast.y"
+                { node_lineno = (yyvsp[-5].lineno); (yyval.feature) = method((yyvsp[-3].symbol),(yyvsp[-2].formals),(yyvsp[-1].symbol),(yyvsp[0].expression)); }
+#line 1282 "ast.tab.c"
     break;
 
-  case 11:
-#line 105 "ast.y"
-    {  (yyval.features) = append_Features((yyvsp[(1) - (2)].features),single_Features((yyvsp[(2) - (2)].feature))); }
+  case 13: /* feature: LINENO ATTR ID ID expr  */
+#line 104 "ast.y"
+                { node_lineno = (yyvsp[-4].lineno); (yyval.feature) = attr((yyvsp[-2].symbol),(yyvsp[-1].symbol),(yyvsp[0].expression)); }
+#line 1288 "ast.tab.c"
     break;
 
-  case 12:
-#line 109 "ast.y"
-    { node_lineno = (yyvsp[(1) - (6)].lineno); (yyval.feature) = method((yyvsp[(3) - (6)].symbol),(yyvsp[(4) - (6)].formals),(yyvsp[(5) - (6)].symbol),(yyvsp[(6) - (6)].expression)); }
+  case 14: /* formals: %empty  */
+#line 108 "ast.y"
+                { (yyval.formals) = nil_Formals(); }
+#line 1294 "ast.tab.c"
     break;
 
-  case 13:
-#line 111 "ast.y"
-    { node_lineno = (yyvsp[(1) - (5)].lineno); (yyval.feature) = attr((yyvsp[(3) - (5)].symbol),(yyvsp[(4) - (5)].symbol),(yyvsp[(5) - (5)].expression)); }
+  case 15: /* formals: formal_list  */
+#line 110 "ast.y"
+                { (yyval.formals) = (yyvsp[0].formals); }
+#line 1300 "ast.tab.c"
     break;
 
-  case 14:
+  case 16: /* formal_list: formal  */
 #line 115 "ast.y"
-    { (yyval.formals) = nil_Formals(); }
+                {  (yyval.formals) = single_Formals((yyvsp[0].formal)); }
+#line 1306 "ast.tab.c"
     break;
 
-  case 15:
+  case 17: /* formal_list: formal_list formal  */
 #line 117 "ast.y"
-    { (yyval.formals) = (yyvsp[(1) - (1)].formals); }
+                { (yyval.formals) = append_Formals((yyvsp[-1].formals),single_Formals((yyvsp[0].formal))); }
+#line 1312 "ast.tab.c"
     break;
 
-  case 16:
-#line 122 "ast.y"
-    {  (yyval.formals) = single_Formals((yyvsp[(1) - (1)].formal)); }
+  case 18: /* formal: LINENO FORMAL ID ID  */
+#line 121 "ast.y"
+                {  node_lineno = (yyvsp[-3].lineno); (yyval.formal) = formal((yyvsp[-1].symbol),(yyvsp[0].symbol)); }
+#line 1318 "ast.tab.c"
     break;
 
-  case 17:
-#line 124 "ast.y"
-    { (yyval.formals) = append_Formals((yyvsp[(1) - (2)].formals),single_Formals((yyvsp[(2) - (2)].formal))); }
+  case 19: /* expr: expr_aux ':' ID  */
+#line 125 "ast.y"
+          { (yyval.expression) = (yyvsp[-2].expression);
+            (yyval.expression)->set_type((yyvsp[0].symbol)); }
+#line 1325 "ast.tab.c"
     break;
 
-  case 18:
+  case 20: /* expr: expr_aux ':' NO_TYPE  */
 #line 128 "ast.y"
-    {  node_lineno = (yyvsp[(1) - (4)].lineno); (yyval.formal) = formal((yyvsp[(3) - (4)].symbol),(yyvsp[(4) - (4)].symbol)); }
+          { (yyval.expression) = (yyvsp[-2].expression); }
+#line 1331 "ast.tab.c"
     break;
 
-  case 19:
+  case 21: /* expr_aux: LINENO ASSIGN ID expr  */
 #line 132 "ast.y"
-    { (yyval.expression) = (yyvsp[(1) - (3)].expression);
-            (yyval.expression)->set_type((yyvsp[(3) - (3)].symbol)); }
+          { node_lineno = (yyvsp[-3].lineno); (yyval.expression) = assign((yyvsp[-1].symbol),(yyvsp[0].expression)); }
+#line 1337 "ast.tab.c"
+    break;
+
+  case 22: /* expr_aux: LINENO STATIC_DISPATCH expr ID ID actuals  */
+#line 134 "ast.y"
+          { node_lineno = (yyvsp[-5].lineno); (yyval.expression) = static_dispatch((yyvsp[-3].expression),(yyvsp[-2].symbol),(yyvsp[-1].symbol),(yyvsp[0].expressions));}
+#line 1343 "ast.tab.c"
     break;
 
-  case 20:
+  case 23: /* expr_aux: LINENO DISPATCH expr ID actuals  */
 #line 136 "ast.y"
-    { (yyval.expression) = (yyvsp[(1) - (3)].expression); }
+          { node_lineno = (yyvsp[-4].lineno); (yyval.expression) = dispatch((yyvsp[-2].expression),(yyvsp[-1].symbol),(yyvsp[0].expressions)); }
+#line 1349 "ast.tab.c"
     break;
 
-  case 21:
-#line 139 "ast.y"
-    { node_lineno = (yyvsp[(1) - (4)].lineno); (yyval.expression) = assign((yyvsp[(3) - (4)].symbol),(yyvsp[(4) - (4)].expression)); }
+  case 24: /* expr_aux: LINENO COND expr expr expr  */
+#line 138 "ast.y"
+          { node_lineno = (yyvsp[-4].lineno); (yyval.expression) = cond((yyvsp[-2].expression),(yyvsp[-1].expression),(yyvsp[0].expression)); }
+#line 1355 "ast.tab.c"
     break;
 
-  case 22:
+  case 25: /* expr_aux: LINENO LOOP expr expr  */
+#line 140 "ast.y"
+          { node_lineno = (yyvsp[-3].lineno); (yyval.expression) = loop((yyvsp[-1].expression),(yyvsp[0].expression)); }
+#line 1361 "ast.tab.c"
+    break;
+
+  case 26: /* expr_aux: LINENO BLOCK expr_list  */
 #line 142 "ast.y"
-    { node_lineno = (yyvsp[(1) - (6)].lineno); (yyval.expression) = static_dispatch((yyvsp[(3) - (6)].expression),(yyvsp[(4) - (6)].symbol),(yyvsp[(5) - (6)].symbol),(yyvsp[(6) - (6)].expressions));}
+          { node_lineno = (yyvsp[-2].lineno); (yyval.expression) = block((yyvsp[0].expressions)); }
+#line 1367 "ast.tab.c"
     break;
 
-  case 23:
-#line 145 "ast.y"
-    { node_lineno = (yyvsp[(1) - (5)].lineno); (yyval.expression) = dispatch((yyvsp[(3) - (5)].expression),(yyvsp[(4) - (5)].symbol),(yyvsp[(5) - (5)].expressions)); }
+  case 27: /* expr_aux: LINENO LET ID ID expr expr  */
+#line 144 "ast.y"
+          { node_lineno = (yyvsp[-5].lineno); (yyval.expression) = let((yyvsp[-3].symbol),(yyvsp[-2].symbol),(yyvsp[-1].expression),(yyvsp[0].expression)); }
+#line 1373 "ast.tab.c"
     break;
 
-  case 24:
-#line 148 "ast.y"
-    { node_lineno = (yyvsp[(1) - (5)].lineno); (yyval.expression) = cond((yyvsp[(3) - (5)].expression),(yyvsp[(4) - (5)].expression),(yyvsp[(5) - (5)].expression)); }
+  case 28: /* expr_aux: LINENO LET '(' binding_list ')' expr  */
+#line 146 "ast.y"
+          { node_lineno = (yyvsp[-5].lineno); (yyval.expression) = let(finish_list((yyvsp[-2].binding_buffer)),(yyvsp[0].expression)); }
+#line 1379 "ast.tab.c"
     break;
 
-  case 25:
-#line 151 "ast.y"
-    { node_lineno = (yyvsp[(1) - (4)].lineno); (yyval.expression) = loop((yyvsp[(3) - (4)].expression),(yyvsp[(4) - (4)].expression)); }
+  case 29: /* expr_aux: LINENO TYPCASE expr case_list  */
+#line 148 "ast.y"
+          { node_lineno = (yyvsp[-3].lineno); (yyval.expression) = typcase((yyvsp[-1].expression),(yyvsp[0].cases)); }
+#line 1385 "ast.tab.c"
     break;
 
-  case 26:
-#line 154 "ast.y"
-    { node_lineno = (yyvsp[(1) - (3)].lineno); (yyval.expression) = block((yyvsp[(3) - (3)].expressions)); }
+  case 30: /* expr_aux: LINENO NEW ID  */
+#line 150 "ast.y"
+          { node_lineno = (yyvsp[-2].lineno); (yyval.expression) = new_((yyvsp[0].symbol)); }
+#line 1391 "ast.tab.c"
     break;
 
-  case 27:
-#line 157 "ast.y"
-    { node_lineno = (yyvsp[(1) - (6)].lineno); (yyval.expression) = let((yyvsp[(3) - (6)].symbol),(yyvsp[(4) - (6)].symbol),(yyvsp[(5) - (6)].expression),(yyvsp[(6) - (6)].expression)); }
+  case 31: /* expr_aux: LINENO ISVOID expr  */
+#line 152 "ast.y"
+          { node_lineno = (yyvsp[-2].lineno); (yyval.expression) = isvoid((yyvsp[0].expression)); }
+#line 1397 "ast.tab.c"
     break;
 
-  case 28:
-#line 160 "ast.y"
-    { node_lineno = (yyvsp[(1) - (4)].lineno); (yyval.expression) = typcase((yyvsp[(3) - (4)].expression),(yyvsp[(4) - (4)].cases)); }
+  case 32: /* expr_aux: LINENO PLUS expr expr  */
+#line 154 "ast.y"
+          { node_lineno = (yyvsp[-3].lineno); (yyval.expression) = plus((yyvsp[-1].expression),(yyvsp[0].expression)); }
+#line 1403 "ast.tab.c"
     break;
 
-  case 29:
-#line 163 "ast.y"
-    { node_lineno = (yyvsp[(1) - (3)].lineno); (yyval.expression) = new_((yyvsp[(3) - (3)].symbol)); }
+  case 33: /* expr_aux: LINENO SUB expr expr  */
+#line 156 "ast.y"
+          { node_lineno = (yyvsp[-3].lineno); (yyval.expression) = sub((yyvsp[-1].expression),(yyvsp[0].expression)); }
+#line 1409 "ast.tab.c"
     break;
 
-  case 30:
-#line 166 "ast.y"
-    { node_lineno = (yyvsp[(1) - (3)].lineno); (yyval.expression) = isvoid((yyvsp[(3) - (3)].expression)); }
+  case 34: /* expr_aux: LINENO MUL expr expr  */
+#line 158 "ast.y"
+          { node_lineno = (yyvsp[-3].lineno); (yyval.expression) = mul((yyvsp[-1].expression),(yyvsp[0].expression)); }
+#line 1415 "ast.tab.c"
     break;
 
-  case 31:
-#line 169 "ast.y"
-    { node_lineno = (yyvsp[(1) - (4)].lineno); (yyval.expression) = plus((yyvsp[(3) - (4)].expression),(yyvsp[(4) - (4)].expression)); }
+  case 35: /* expr_aux: LINENO DIVIDE expr expr  */
+#line 160 "ast.y"
+          { node_lineno = (yyvsp[-3].lineno); (yyval.expression) = divide((yyvsp[-1].expression),(yyvsp[0].expression)); }
+#line 1421 "ast.tab.c"
     break;
 
-  case 32:
-#line 172 "ast.y"
-    { node_lineno = (yyvsp[(1) - (4)].lineno); (yyval.expression) = sub((yyvsp[(3) - (4)].expression),(yyvsp[(4) - (4)].expression)); }
+  case 36: /* expr_aux: LINENO NEG expr  */
+#line 162 "ast.y"
+          { node_lineno = (yyvsp[-2].lineno); (yyval.expression) = neg((yyvsp[0].expression)); }
+#line 1427 "ast.tab.c"
     break;
 
-  case 33:
-#line 175 "ast.y"
-    { node_lineno = (yyvsp[(1) - (4)].lineno); (yyval.expression) = mul((yyvsp[(3) - (4)].expression),(yyvsp[(4) - (4)].expression)); }
+  case 37: /* expr_aux: LINENO LT expr expr  */
+#line 164 "ast.y"
+          { node_lineno = (yyvsp[-3].lineno); (yyval.expression) = lt((yyvsp[-1].expression),(yyvsp[0].expression)); }
+#line 1433 "ast.tab.c"
     break;
 
-  case 34:
-#line 178 "ast.y"
-    { node_lineno = (yyvsp[(1) - (4)].lineno); (yyval.expression) = divide((yyvsp[(3) - (4)].expression),(yyvsp[(4) - (4)].expression)); }
+  case 38: /* expr_aux: LINENO EQ expr expr  */
+#line 166 "ast.y"
+          { node_lineno = (yyvsp[-3].lineno); (yyval.expression) = eq((yyvsp[-1].expression),(yyvsp[0].expression)); }
+#line 1439 "ast.tab.c"
     break;
 
-  case 35:
-#line 181 "ast.y"
-    { node_lineno = (yyvsp[(1) - (3)].lineno); (yyval.expression) = neg((yyvsp[(3) - (3)].expression)); }
+  case 39: /* expr_aux: LINENO LEQ expr expr  */
+#line 168 "ast.y"
+          { node_lineno = (yyvsp[-3].lineno); (yyval.expression) = leq((yyvsp[-1].expression),(yyvsp[0].expression)); }
+#line 1445 "ast.tab.c"
     break;
 
-  case 36:
-#line 184 "ast.y"
-    { node_lineno = (yyvsp[(1) - (4)].lineno); (yyval.expression) = lt((yyvsp[(3) - (4)].expression),(yyvsp[(4) - (4)].expression)); }
+  case 40: /* expr_aux: LINENO COMP expr  */
+#line 170 "ast.y"
+          { node_lineno = (yyvsp[-2].lineno); (yyval.expression) = comp((yyvsp[0].expression)); }
+#line 1451 "ast.tab.c"
     break;
 
-  case 37:
-#line 187 "ast.y"
-    { node_lineno = (yyvsp[(1) - (4)].lineno); (yyval.expression) = eq((yyvsp[(3) - (4)].expression),(yyvsp[(4) - (4)].expression)); }
+  case 41: /* expr_aux: LINENO INT INT_CONST  */
+#line 172 "ast.y"
+          { node_lineno = (yyvsp[-2].lineno); (yyval.expression) = int_const((yyvsp[0].symbol)); }
+#line 1457 "ast.tab.c"
     break;
 
-  case 38:
-#line 190 "ast.y"
-    { node_lineno = (yyvsp[(1) - (4)].lineno); (yyval.expression) = leq((yyvsp[(3) - (4)].expression),(yyvsp[(4) - (4)].expression)); }
+  case 42: /* expr_aux: LINENO STR STR_CONST  */
+#line 174 "ast.y"
+          { node_lineno = (yyvsp[-2].lineno); (yyval.expression) = string_const((yyvsp[0].symbol)); }
+#line 1463 "ast.tab.c"
     break;
 
-  case 39:
-#line 193 "ast.y"
-    { node_lineno = (yyvsp[(1) - (3)].lineno); (yyval.expression) = comp((yyvsp[(3) - (3)].expression)); }
+  case 43: /* expr_aux: LINENO BOOL INT_CONST  */
+#line 176 "ast.y"
+          { node_lineno = (yyvsp[-2].lineno);
+            if (*((yyvsp[0].symbol)->get_string()) == '1')
+	      (yyval.expression) = bool_const(1);
+	    else
+              (yyval.expression) = bool_const(0);
+          }
+#line 1474 "ast.tab.c"
     break;
 
-  case 40:
-#line 196 "ast.y"
-    { node_lineno = (yyvsp[(1) - (3)].lineno); (yyval.expression) = int_const((yyvsp[(3) - (3)].symbol)); }
+  case 44: /* expr_aux: LINENO OBJECT ID  */
+#line 183 "ast.y"
+          { node_lineno = (yyvsp[-2].lineno); (yyval.expression) = object((yyvsp[0].symbol)); }
+#line 1480 "ast.tab.c"
     break;
 
-  case 41:
-#line 199 "ast.y"
-    { node_lineno = (yyvsp[(1) - (3)].lineno); (yyval.expression) = string_const((yyvsp[(3) - (3)].symbol)); }
+  case 45: /* expr_aux: LINENO NO_EXPR  */
+#line 185 "ast.y"
+          { node_lineno = (yyvsp[-1].lineno); (yyval.expression) = no_expr(); }
+#line 1486 "ast.tab.c"
     break;
 
-  case 42:
-#line 202 "ast.y"
-    { node_lineno = (yyvsp[(1) - (3)].lineno); 
-            if (*((yyvsp[(3) - (3)].symbol)->get_string()) == '1')
-	      (yyval.expression) = bool_const(1); 
-	    else
-              (yyval.expression) = bool_const(0);
-          }
+  case 46: /* actuals: '(' ')'  */
+#line 189 "ast.y"
+          {  (yyval.expressions) = nil_Expressions(); }
+#line 1492 "ast.tab.c"
     break;
 
-  case 43:
-#line 210 "ast.y"
-    { node_lineno = (yyvsp[(1) - (3)].lineno); (yyval.expression) = object((yyvsp[(3) - (3)].symbol)); }
+  case 47: /* actuals: '(' expr_list ')'  */
+#line 191 "ast.y"
+          {  (yyval.expressions) = (yyvsp[-1].expressions); }
+#line 1498 "ast.tab.c"
     break;
 
-  case 44:
-#line 213 "ast.y"
-    { node_lineno = (yyvsp[(1) - (2)].lineno); (yyval.expression) = no_expr(); }
+  case 48: /* expr_list: expr  */
+#line 196 "ast.y"
+          { (yyval.expressions) = single_Expressions((yyvsp[0].expression)); }
+#line 1504 "ast.tab.c"
     break;
 
-  case 45:
-#line 217 "ast.y"
-    {  (yyval.expressions) = nil_Expressions(); }
+  case 49: /* expr_list: expr_list expr  */
+#line 198 "ast.y"
+          { (yyval.expressions) = append_Expressions((yyvsp[-1].expressions),single_Expressions((yyvsp[0].expression))); }
+#line 1510 "ast.tab.c"
     break;
 
-  case 46:
-#line 219 "ast.y"
-    {  (yyval.expressions) = (yyvsp[(2) - (3)].expressions); }
+  case 50: /* case_list: simple_case  */
+#line 203 "ast.y"
+          { (yyval.cases) = single_Cases((yyvsp[0].case_)); }
+#line 1516 "ast.tab.c"
     break;
 
-  case 47:
-#line 224 "ast.y"
-    { (yyval.expressions) = single_Expressions((yyvsp[(1) - (1)].expression)); }
+  case 51: /* case_list: case_list simple_case  */
+#line 205 "ast.y"
+          { (yyval.cases) = append_Cases((yyvsp[-1].cases),single_Cases((yyvsp[0].case_))); }
+#line 1522 "ast.tab.c"
     break;
 
-  case 48:
-#line 226 "ast.y"
-    { (yyval.expressions) = append_Expressions((yyvsp[(1) - (2)].expressions),single_Expressions((yyvsp[(2) - (2)].expression))); }
+  case 52: /* simple_case: LINENO BRANCH ID ID expr  */
+#line 209 "ast.y"
+          { node_lineno = (yyvsp[-4].lineno); (yyval.case_) = branch((yyvsp[-2].symbol),(yyvsp[-1].symbol),(yyvsp[0].expression)); }
+#line 1528 "ast.tab.c"
     break;
 
-  case 49:
-#line 231 "ast.y"
-    { (yyval.cases) = single_Cases((yyvsp[(1) - (1)].case_)); }
+  case 53: /* binding_list: binding  */
+#line 215 "ast.y"
+          { (yyval.binding_buffer) = (new list_buffer<Binding>)->add((yyvsp[0].binding)); }
+#line 1534 "ast.tab.c"
     break;
 
-  case 50:
-#line 233 "ast.y"
-    { (yyval.cases) = append_Cases((yyvsp[(1) - (2)].cases),single_Cases((yyvsp[(2) - (2)].case_))); }
+  case 54: /* binding_list: binding_list binding  */
+#line 217 "ast.y"
+          { (yyval.binding_buffer) = (yyvsp[-1].binding_buffer)->add((yyvsp[0].binding)); }
+#line 1540 "ast.tab.c"
     break;
 
-  case 51:
-#line 238 "ast.y"
-    { node_lineno = (yyvsp[(1) - (5)].lineno); (yyval.case_) = branch((yyvsp[(3) - (5)].symbol),(yyvsp[(4) - (5)].symbol),(yyvsp[(5) - (5)].expression)); }
+  case 55: /* binding: LINENO ID ID expr  */
+#line 221 "ast.y"
+          { node_lineno = (yyvsp[-3].lineno); (yyval.binding) = binding((yyvsp[-2].symbol),(yyvsp[-1].symbol),(yyvsp[0].expression)); }
+#line 1546 "ast.tab.c"
     break;
 
 
-/* Line 1267 of yacc.c.  */
-#line 1776 "ast.tab.c"
+#line 1550 "ast.tab.c"
+
       default: break;
     }
-  YY_SYMBOL_PRINT ("-> $$ =", yyr1[yyn], &yyval, &yyloc);
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
 
   YYPOPSTACK (yylen);
   yylen = 0;
-  YY_STACK_PRINT (yyss, yyssp);
 
   *++yyvsp = yyval;
 
-
-  /* Now `shift' the result of the reduction.  Determine what state
+  /* Now 'shift' the result of the reduction.  Determine what state
      that goes to, based on the state we popped back to and the rule
      number reduced by.  */
-
-  yyn = yyr1[yyn];
-
-  yystate = yypgoto[yyn - YYNTOKENS] + *yyssp;
-  if (0 <= yystate && yystate <= YYLAST && yycheck[yystate] == *yyssp)
-    yystate = yytable[yystate];
-  else
-    yystate = yydefgoto[yyn - YYNTOKENS];
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
 
   goto yynewstate;
 
 
-/*------------------------------------.
-| yyerrlab -- here on detecting error |
-`------------------------------------*/
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
 yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
   /* If not already recovering from an error, report this error.  */
   if (!yyerrstatus)
     {
       ++yynerrs;
-#if ! YYERROR_VERBOSE
       yyerror (YY_("syntax error"));
-#else
-      {
-	YYSIZE_T yysize = yysyntax_error (0, yystate, yychar);
-	if (yymsg_alloc < yysize && yymsg_alloc < YYSTACK_ALLOC_MAXIMUM)
-	  {
-	    YYSIZE_T yyalloc = 2 * yysize;
-	    if (! (yysize <= yyalloc && yyalloc <= YYSTACK_ALLOC_MAXIMUM))
-	      yyalloc = YYSTACK_ALLOC_MAXIMUM;
-	    if (yymsg != yymsgbuf)
-	      YYSTACK_FREE (yymsg);
-	    yymsg = (char *) YYSTACK_ALLOC (yyalloc);
-	    if (yymsg)
-	      yymsg_alloc = yyalloc;
-	    else
-	      {
-		yymsg = yymsgbuf;
-		yymsg_alloc = sizeof yymsgbuf;
-	      }
-	  }
-
-	if (0 < yysize && yysize <= yymsg_alloc)
-	  {
-	    (void) yysyntax_error (yymsg, yystate, yychar);
-	    yyerror (yymsg);
-	  }
-	else
-	  {
-	    yyerror (YY_("syntax error"));
-	    if (yysize != 0)
-	      goto yyexhaustedlab;
-	  }
-      }
-#endif
     }
 
-
-
   if (yyerrstatus == 3)
     {
-      /* If just tried and failed to reuse look-ahead token after an
-	 error, discard it.  */
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
 
       if (yychar <= YYEOF)
-	{
-	  /* Return failure if at end of input.  */
-	  if (yychar == YYEOF)
-	    YYABORT;
-	}
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
       else
-	{
-	  yydestruct ("Error: discarding",
-		      yytoken, &yylval);
-	  yychar = YYEMPTY;
-	}
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval);
+          yychar = YYEMPTY;
+        }
     }
 
-  /* Else will try to reuse look-ahead token after shifting the error
+  /* Else will try to reuse lookahead token after shifting the error
      token.  */
   goto yyerrlab1;
 
@@ -1874,14 +1624,13 @@ yyerrlab:
 | yyerrorlab -- error raised explicitly by YYERROR.  |
 `---------------------------------------------------*/
 yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
 
-  /* Pacify compilers like GCC when the user code never invokes
-     YYERROR and the label yyerrorlab therefore never appears in user
-     code.  */
-  if (/*CONSTCOND*/ 0)
-     goto yyerrorlab;
-
-  /* Do not reclaim the symbols of the rule which action triggered
+  /* Do not reclaim the symbols of the rule whose action triggered
      this YYERROR.  */
   YYPOPSTACK (yylen);
   yylen = 0;
@@ -1894,42 +1643,42 @@ yyerrorlab:
 | yyerrlab1 -- common code for both syntax error and YYERROR.  |
 `-------------------------------------------------------------*/
 yyerrlab1:
-  yyerrstatus = 3;	/* Each real token shifted decrements this.  */
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
 
+  /* Pop stack until we find a state that shifts the error token.  */
   for (;;)
     {
       yyn = yypact[yystate];
-      if (yyn != YYPACT_NINF)
-	{
-	  yyn += YYTERROR;
-	  if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYTERROR)
-	    {
-	      yyn = yytable[yyn];
-	      if (0 < yyn)
-		break;
-	    }
-	}
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
 
       /* Pop the current state because it cannot handle the error token.  */
       if (yyssp == yyss)
-	YYABORT;
+        YYABORT;
 
 
       yydestruct ("Error: popping",
-		  yystos[yystate], yyvsp);
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
       YYPOPSTACK (1);
       yystate = *yyssp;
       YY_STACK_PRINT (yyss, yyssp);
     }
 
-  if (yyn == YYFINAL)
-    YYACCEPT;
-
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 
 
   /* Shift the error token.  */
-  YY_SYMBOL_PRINT ("Shifting", yystos[yyn], yyvsp, yylsp);
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
 
   yystate = yyn;
   goto yynewstate;
@@ -1940,53 +1689,57 @@ yyerrlab1:
 `-------------------------------------*/
 yyacceptlab:
   yyresult = 0;
-  goto yyreturn;
+  goto yyreturnlab;
+
 
 /*-----------------------------------.
 | yyabortlab -- YYABORT comes here.  |
 `-----------------------------------*/
 yyabortlab:
   yyresult = 1;
-  goto yyreturn;
+  goto yyreturnlab;
 
-#ifndef yyoverflow
-/*-------------------------------------------------.
-| yyexhaustedlab -- memory exhaustion comes here.  |
-`-------------------------------------------------*/
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
 yyexhaustedlab:
   yyerror (YY_("memory exhausted"));
   yyresult = 2;
-  /* Fall through.  */
-#endif
+  goto yyreturnlab;
 
-yyreturn:
-  if (yychar != YYEOF && yychar != YYEMPTY)
-     yydestruct ("Cleanup: discarding lookahead",
-		 yytoken, &yylval);
-  /* Do not reclaim the symbols of the rule which action triggered
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != YYEMPTY)
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
      this YYABORT or YYACCEPT.  */
   YYPOPSTACK (yylen);
   YY_STACK_PRINT (yyss, yyssp);
   while (yyssp != yyss)
     {
       yydestruct ("Cleanup: popping",
-		  yystos[*yyssp], yyvsp);
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
       YYPOPSTACK (1);
     }
 #ifndef yyoverflow
   if (yyss != yyssa)
     YYSTACK_FREE (yyss);
 #endif
-#if YYERROR_VERBOSE
-  if (yymsg != yymsgbuf)
-    YYSTACK_FREE (yymsg);
-#endif
-  /* Make sure YYID is used.  */
-  return YYID (yyresult);
-}
 
+  return yyresult;
+}
 
-#line 243 "ast.y"
+#line 224 "ast.y"
 
 
 void ast_yyerror(char *msg)
@@ -1995,5 +1748,3 @@ void ast_yyerror(char *msg)
    cerr << msg << endl;
    exit(1);
 }
-
-
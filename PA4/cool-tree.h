@@ -109,6 +109,20 @@ public:
 };
 
 
+// define simple phylum - Binding
+typedef class Binding_class *Binding;
+
+class Binding_class : public tree_node {
+public:
+   tree_node *copy()		 { return copy_Binding(); }
+   virtual Binding copy_Binding() = 0;
+
+#ifdef Binding_EXTRAS
+   Binding_EXTRAS
+#endif
+};
+
+
 // define the class for phylum - LIST
 // define list phlyum - Classes
 typedef list_node<Class_> Classes_class;
@@ -135,6 +149,11 @@ typedef list_node<Case> Cases_class;
 typedef Cases_class *Cases;
 
 
+// define list phlyum - Bindings
+typedef list_node<Binding> Bindings_class;
+typedef Bindings_class *Bindings;
+
+
 // define the class for constructors
 // define constructor - program
 class program_class : public Program_class {
@@ -298,6 +317,33 @@ public:
 };
 
 
+// define constructor - binding
+class binding_class : public Binding_class {
+protected:
+   Symbol identifier;
+   Symbol type_decl;
+   Expression init;
+public:
+   binding_class(Symbol a1, Symbol a2, Expression a3) {
+      identifier = a1;
+      type_decl = a2;
+      init = a3;
+   }
+   Binding copy_Binding();
+   void dump(ostream& stream, int n);
+   Symbol get_identifier() const { return copy_Symbol(identifier); }
+   Symbol get_type_decl() const { return copy_Symbol(type_decl); }
+   Expression& get_init_expr() { return init; }
+
+#ifdef Binding_SHARED_EXTRAS
+   Binding_SHARED_EXTRAS
+#endif
+#ifdef binding_EXTRAS
+   binding_EXTRAS
+#endif
+};
+
+
 // define constructor - assign
 class assign_class : public Expression_class {
 protected:
@@ -488,23 +534,17 @@ public:
 // define constructor - let
 class let_class : public Expression_class {
 protected:
-   Symbol identifier;
-   Symbol type_decl;
-   Expression init;
+   Bindings bindings;
    Expression body;
 public:
-   let_class(Symbol a1, Symbol a2, Expression a3, Expression a4) {
-      identifier = a1;
-      type_decl = a2;
-      init = a3;
-      body = a4;
+   let_class(Bindings a1, Expression a2) {
+      bindings = a1;
+      body = a2;
    }
    Expression copy_Expression();
    void dump(ostream& stream, int n);
    expr_type get_expr_type() { return expr_type::EXP_LET; }
-   Symbol get_identifier() const { return copy_Symbol(identifier); }
-   Symbol get_type_decl() const { return copy_Symbol(type_decl); }
-   Expression& get_init_expr() { return init; }
+   Bindings get_bindings() { return bindings; }
    Expression& get_body() { return body; }
 
 #ifdef Expression_SHARED_EXTRAS
@@ -746,6 +786,7 @@ public:
    Expression copy_Expression();
    void dump(ostream& stream, int n);
    expr_type get_expr_type() { return expr_type::EXP_INT_CONST; }
+   Symbol get_token() const { return copy_Symbol(token); }
 
 #ifdef Expression_SHARED_EXTRAS
    Expression_SHARED_EXTRAS
@@ -767,6 +808,7 @@ public:
    Expression copy_Expression();
    void dump(ostream& stream, int n);
    expr_type get_expr_type() { return expr_type::EXP_BOOL_CONST; }
+   Boolean get_val() const { return copy_Boolean(val); }
 
 #ifdef Expression_SHARED_EXTRAS
    Expression_SHARED_EXTRAS
@@ -788,6 +830,7 @@ public:
    Expression copy_Expression();
    void dump(ostream& stream, int n);
    expr_type get_expr_type() { return expr_type::EXP_STRING_CONST; }
+   Symbol get_token() const { return copy_Symbol(token); }
 
 #ifdef Expression_SHARED_EXTRAS
    Expression_SHARED_EXTRAS
@@ -898,12 +941,16 @@ Expressions append_Expressions(Expressions, Expressions);
 Cases nil_Cases();
 Cases single_Cases(Case);
 Cases append_Cases(Cases, Cases);
+Bindings nil_Bindings();
+Bindings single_Bindings(Binding);
+Bindings append_Bindings(Bindings, Bindings);
 Program program(Classes);
 Class_ class_(Symbol, Symbol, Features, Symbol);
 Feature method(Symbol, Formals, Symbol, Expression);
 Feature attr(Symbol, Symbol, Expression);
 Formal formal(Symbol, Symbol);
 Case branch(Symbol, Symbol, Expression);
+Binding binding(Symbol, Symbol, Expression);
 Expression assign(Symbol, Expression);
 Expression static_dispatch(Expression, Symbol, Symbol, Expressions);
 Expression dispatch(Expression, Symbol, Expressions);
@@ -911,6 +958,7 @@ Expression cond(Expression, Expression, Expression);
 Expression loop(Expression, Expression);
 Expression typcase(Expression, Cases);
 Expression block(Expressions);
+Expression let(Bindings, Expression);
 Expression let(Symbol, Symbol, Expression, Expression);
 Expression plus(Expression, Expression);
 Expression sub(Expression, Expression);
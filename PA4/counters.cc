@@ -0,0 +1,95 @@
+//
+// See copyright.h for copyright notice and limitation of liability
+// and disclaimer of warranty provisions.
+//
+#include "copyright.h"
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  counters.cc
+//
+//  The per-thread blocks behind COUNT_VISIT and COUNT_CALL (counters.h)
+//  and their report.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include "counters.h"
+
+#ifdef COUNTERS
+
+#include <stdio.h>
+#include <string.h>
+#include <mutex>
+#include <vector>
+
+static const char *counter_names[COUNTER_COUNT] = {
+  "SymbolTable::lookup",
+  "SymbolTable::probe",
+  "StringTable::add_string",
+  "StringTable::lookup_string",
+  "StringTable::lookup",
+  "list_node::nth",
+  "get_method_from_class_or_ancestry",
+  "get_attribute_from_class_or_ancestry",
+  "find_type_of_method_in_class_or_ancestry",
+  "find_type_of_attribute_in_class_or_ancestry",
+};
+
+static std::vector<CounterValues *> blocks;  // of all threads, never freed
+static std::mutex blocks_lock;               // taken once per thread
+thread_local CounterValues *counter_block = NULL;
+
+CounterValues *counter_block_new()
+{
+  counter_block = new CounterValues[COUNTER_COUNT];
+  memset(counter_block, 0, COUNTER_COUNT * sizeof(CounterValues));
+  std::lock_guard<std::mutex> guard(blocks_lock);
+  blocks.push_back(counter_block);
+  return counter_block;
+}
+
+void counters_report(ostream& out, bool json)
+{
+  CounterValues total[COUNTER_COUNT];
+  memset(total, 0, sizeof(total));
+  {
+    std::lock_guard<std::mutex> guard(blocks_lock);
+    for (size_t i = 0; i < blocks.size(); i++)
+      for (int c = 0; c < COUNTER_COUNT; c++) {
+        total[c].calls += blocks[i][c].calls;
+        total[c].hits += blocks[i][c].hits;
+        total[c].visited += blocks[i][c].visited;
+      }
+  }
+
+  char line[200];
+  const char *sep = "";
+  for (int c = 0; c < COUNTER_COUNT; c++) {
+    CounterValues& v = total[c];
+    if (v.calls == 0)
+      continue;
+    if (!json && *sep == '\0') {
+      snprintf(line, sizeof(line), "%-44s %10s %7s %13s\n",
+               "counter", "calls", "hit %", "visited/call");
+      out << line;
+    }
+    if (json)
+      snprintf(line, sizeof(line), "%s{\"name\": \"%s\", \"calls\": %lu, "
+               "\"hits\": %lu, \"visited\": %lu}",
+               sep, counter_names[c], v.calls, v.hits, v.visited);
+    else
+      snprintf(line, sizeof(line), "%-44s %10lu %7.1f %13.1f\n",
+               counter_names[c], v.calls, 100.0 * v.hits / v.calls,
+               (double) v.visited / v.calls);
+    out << line;
+    sep = ", ";
+  }
+}
+
+#else
+
+void counters_report(ostream&, bool)
+{
+}
+
+#endif
@@ -166,10 +166,6 @@ bool validate_expression(Class_ in_class, Feature in_feature, Expression& e, Sym
   } else {
     e->set_type(idtable.add_string(Object->get_string()));
   }
-
-  if (!expression_is_valid) {
-      DEBUG_ACTION(std::cout << "Expression class(#) " << (int) e->get_expr_type() << " was faulty." << std::endl);
-  }
   return expression_is_valid;
 }
 
@@ -198,8 +194,7 @@ bool validate_exp_assign(Class_ in_class, Feature in_feature, Expression e, Symb
       }
 
       // The expression may be the type exactly, or a subtype of it.
-      return still_valid && (type == get_expression_type(in_class, assign_rhs_expr, sym_tab) ||
-                            is_super_type_of(type, get_expression_type(in_class, assign_rhs_expr, sym_tab), sym_tab));
+      return still_valid && conforms_in_class(in_class, get_expression_type(in_class, assign_rhs_expr, sym_tab), type, sym_tab);
     } 
     // Case II 
     else {
@@ -211,8 +206,7 @@ bool validate_exp_assign(Class_ in_class, Feature in_feature, Expression e, Symb
       }
 
       // The expression may be the type exactly, or a subtype of it.
-      return still_valid && (type == get_expression_type(in_class, assign_rhs_expr, sym_tab) ||
-                            is_super_type_of(type, get_expression_type(in_class, assign_rhs_expr, sym_tab), sym_tab));
+      return still_valid && conforms_in_class(in_class, get_expression_type(in_class, assign_rhs_expr, sym_tab), type, sym_tab);
     }
   } else {
     return false;
@@ -228,7 +222,7 @@ bool validate_exp_static_dispatch(Class_ in_class, Feature in_feature, Expressio
   Symbol expr_type = get_expression_type(in_class, expr, sym_tab);
   bool still_valid = validate_expression(in_class, in_feature, expr, sym_tab);
   
-  if (!is_super_type_of(type_name, expr_type, sym_tab)) {
+  if (!conforms_in_class(in_class, expr_type, type_name, sym_tab)) {
     still_valid =  false;
   }
 
@@ -250,8 +244,7 @@ bool validate_exp_static_dispatch(Class_ in_class, Feature in_feature, Expressio
 
         Expression nth_exp = args->nth(i);
         still_valid =  validate_expression(in_class, in_feature, nth_exp, sym_tab) \
-                  && (desired_formals->nth(i)->get_type() == get_expression_type(in_class, args->nth(i), sym_tab) \
-                      || is_super_type_of(desired_formals->nth(i)->get_type(), get_expression_type(in_class, args->nth(i), sym_tab), sym_tab)) \
+                  && conforms_in_class(in_class, get_expression_type(in_class, args->nth(i), sym_tab), desired_formals->nth(i)->get_type(), sym_tab) \
                   && still_valid;
       }
     } else {
@@ -354,9 +347,9 @@ bool validate_case(Class_ in_class, Feature in_feature, Case c, SymbolTable<Symb
   sym_tab->enterscope();
   sym_tab->addid(branch_id, data);
  
+  // The type of the branch body is not constrained by the declared type
+  // of the branch; the case has the lub of the body types.
   still_valid = validate_expression(in_class, in_feature, branch_expression, sym_tab);
-  Symbol s = get_expression_type(in_class, branch_expression, sym_tab);
-  still_valid = still_valid && is_super_type_of(branch_type, s, sym_tab);
 
   sym_tab->exitscope();
   return still_valid;
@@ -373,28 +366,35 @@ bool validate_exp_block(Class_ in_class, Feature in_feature, Expression e, Symbo
     still_valid = okay && still_valid;
   }
 
-  // DEBUG_ACTION(std::cout << "Block just validated says: " << still_valid << std::endl);
-
   return still_valid;
 }
 bool validate_exp_let(Class_ in_class, Feature in_feature, Expression e, SymbolTable<Symbol, symbol_table_data>* sym_tab) {
   let_class* let_exp = (let_class*) e;
-  Symbol id = let_exp->get_identifier();
-  Symbol type_decl = let_exp->get_type_decl();
-  Expression init_expr = let_exp->get_init_expr();
+  Bindings bindings = let_exp->get_bindings();
   Expression body = let_exp->get_body();
+  bool still_valid = true;
+
+  /* All the bindings share one scope; each one is added after its init
+     expression is typed, so it sees only the bindings before it. */
+  sym_tab->enterscope();
+  for (int i = bindings->first(); bindings->more(i); i = bindings->next(i)) {
+    binding_class* binding = (binding_class*) bindings->nth(i);
+    Symbol id = binding->get_identifier();
+    Symbol type_decl = binding->get_type_decl();
+    Expression init_expr = binding->get_init_expr();
 
-  bool still_valid = sym_tab->lookup(type_decl) != NULL ? true : false;
-  still_valid = id != self && still_valid;
+    still_valid = sym_tab->lookup(type_decl) != NULL && still_valid;
+    still_valid = id != self && still_valid;
 
-  Symbol init_expr_type = get_expression_type(in_class, init_expr, sym_tab);
-  still_valid = (init_expr_type == No_type || (type_decl == init_expr_type) || is_super_type_of(type_decl, init_expr_type, sym_tab)) && still_valid;
+    Symbol init_expr_type = get_expression_type(in_class, init_expr, sym_tab);
+    still_valid = (init_expr_type == No_type || (type_decl == init_expr_type) ||
+                   (type_decl != SELF_TYPE && conforms_in_class(in_class, init_expr_type, type_decl, sym_tab))) && still_valid;
 
-  symbol_table_data* data = new symbol_table_data({NULL, NULL, type_decl, NULL});
-  sym_tab->enterscope();
-  sym_tab->addid(id, data);
-  
-  still_valid = validate_expression(in_class, in_feature, init_expr, sym_tab) && still_valid;
+    symbol_table_data* data = new symbol_table_data({NULL, NULL, type_decl, NULL});
+    sym_tab->addid(id, data);
+
+    still_valid = validate_expression(in_class, in_feature, init_expr, sym_tab) && still_valid;
+  }
   still_valid = validate_expression(in_class, in_feature, body, sym_tab) && still_valid;
 
   sym_tab->exitscope();
@@ -91,7 +91,6 @@ namespace mycode {
         // The signature and return type declared in this class must match.
         if (method_class* corresponding_parent_method = 
            (method_class*) get_method_from_class_or_ancestry(method->get_name(), in_class->get_parent_name() ,sym_tab)) { 
-          DEBUG_ACTION(std::cout << "There is an inherited method named: " << method->get_name() << std::endl);
           Formals parent_formals = corresponding_parent_method->get_formals();
           // For signatures to match, they must have equal number of parameters.
           // And return types must be the same.
@@ -2,14 +2,6 @@
 
 #include "cool-tree.h"
 
-#define DEBUGGING_
-
-#ifdef DEBUGGING
-#define DEBUG_ACTION(x) x << std::flush
-#else
-#define DEBUG_ACTION(x)
-#endif
-
 namespace mycode {
 
   typedef struct data {
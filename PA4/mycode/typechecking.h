@@ -47,16 +47,20 @@ namespace mycode {
     if (data) {
       Features fs = data->features;
       if (fs == NULL) {
+        COUNT_CALL(COUNTER_METHOD_ANCESTRY, false);
         return NULL;
       }
       for (int i = fs->first(); fs->more(i); i = fs->next(i)) {
         Feature f = fs->nth(i);
+        COUNT_VISIT(COUNTER_METHOD_ANCESTRY);
         if (f->get_type() == 'm' && f->get_name() == feature_name) {
+          COUNT_CALL(COUNTER_METHOD_ANCESTRY, true);
           return f;
         }
       }
       return get_method_from_class_or_ancestry(feature_name, data->parent, sym_tab);
     }
+    COUNT_CALL(COUNTER_METHOD_ANCESTRY, false);
     return NULL;
   }
   Feature get_method_from_class(Symbol method_name, Symbol class_name, SymbolTable<Symbol, symbol_table_data>*& sym_tab) {
@@ -85,16 +89,20 @@ namespace mycode {
     if (data) {
       Features fs = data->features;
       if (fs == NULL) {
+        COUNT_CALL(COUNTER_ATTRIBUTE_ANCESTRY, false);
         return NULL;
       }
       for (int i = fs->first(); fs->more(i); i = fs->next(i)) {
         Feature f = fs->nth(i);
+        COUNT_VISIT(COUNTER_ATTRIBUTE_ANCESTRY);
         if (f->get_type() == 'a' && f->get_name() == feature_name) {
+          COUNT_CALL(COUNTER_ATTRIBUTE_ANCESTRY, true);
           return f;
         }
       }
       return get_attribute_from_class_or_ancestry(feature_name, data->parent, sym_tab);
     }
+    COUNT_CALL(COUNTER_ATTRIBUTE_ANCESTRY, false);
     return NULL;
   }
 
@@ -125,12 +133,15 @@ namespace mycode {
       Features fs = data->features;
       for (int i = fs->first(); fs->more(i); i = fs->next(i)) {
         Feature f = fs->nth(i);
+        COUNT_VISIT(COUNTER_ATTRIBUTE_TYPE_ANCESTRY);
         if (f->get_type() == 'a' && f->get_name() == feature_name) {
+          COUNT_CALL(COUNTER_ATTRIBUTE_TYPE_ANCESTRY, true);
           return f->get_type_decl();
         }
       }
       return find_type_of_attribute_in_class_or_ancestry(feature_name, data->parent, sym_tab);
     }
+    COUNT_CALL(COUNTER_ATTRIBUTE_TYPE_ANCESTRY, false);
     return NULL;
   }
 
@@ -142,12 +153,15 @@ namespace mycode {
       }
       for (int i = fs->first(); fs->more(i); i = fs->next(i)) {
         Feature f = fs->nth(i);
+        COUNT_VISIT(COUNTER_METHOD_TYPE_ANCESTRY);
         if (f->get_type() == 'm' && f->get_name() == feature_name) {
+          COUNT_CALL(COUNTER_METHOD_TYPE_ANCESTRY, true);
           return f->get_return_type();
         }
       }
       return find_type_of_method_in_class_or_ancestry(feature_name, data->parent, sym_tab);
     }
+    COUNT_CALL(COUNTER_METHOD_TYPE_ANCESTRY, false);
     return NULL;
   }
 
@@ -164,6 +178,13 @@ namespace mycode {
     return false;
   }
 
+  // A value whose static type is `child', which may be SELF_TYPE, can be
+  // used where a `parent' is expected in class c.
+  bool conforms_in_class(Class_ c, Symbol child, Symbol parent, SymbolTable<Symbol, symbol_table_data>*& sym_tab) {
+    if (child == SELF_TYPE) child = c->get_name();
+    return is_super_type_of(parent, child, sym_tab);
+  }
+
 
   /**
  * This function gets the type of an expression.
@@ -244,11 +265,15 @@ Symbol get_expression_type(Class_ c, Expression e, SymbolTable<Symbol, symbol_ta
     }
     case expr_type::EXP_LET: {
       let_class* let_exp = (let_class*) e;
+      Bindings bindings = let_exp->get_bindings();
       sym_tab->enterscope();
-      Symbol identifier = let_exp->get_identifier();
-      Symbol decl_type = let_exp->get_type_decl();
-      symbol_table_data* data = new symbol_table_data({NULL, NULL, decl_type, NULL, NULL});
-      sym_tab->addid(identifier, data);
+      for (int i = bindings->first(); bindings->more(i); i = bindings->next(i)) {
+        binding_class* binding = (binding_class*) bindings->nth(i);
+        Symbol identifier = binding->get_identifier();
+        Symbol decl_type = binding->get_type_decl();
+        symbol_table_data* data = new symbol_table_data({NULL, NULL, decl_type, NULL, NULL});
+        sym_tab->addid(identifier, data);
+      }
       Symbol ret_type = get_expression_type(c, let_exp->get_body(), sym_tab);
       sym_tab->exitscope();
       return ret_type;
@@ -351,22 +376,20 @@ Symbol evaluate_lub_of_types(Symbol s1, Symbol s2, SymbolTable<Symbol, symbol_ta
 }
 
 Symbol get_cases_lub(Class_ c, Cases the_cases, SymbolTable<Symbol, symbol_table_data>*& sym_tab) {
-  Symbol curr_lub = Object;
+  Symbol curr_lub = NULL;
 
-  int i = the_cases->first();
-  branch_class* ith_branch = (branch_class*) the_cases->nth(i);
-  curr_lub = get_expression_type(c, ith_branch->get_expr(), sym_tab);
-  Symbol ith_branch_expr_type;
-  for (i = the_cases->next(i); the_cases->more(i); i = the_cases->next(i)) {
+  // Each branch body is typed with its identifier bound to the branch type.
+  for (int i = the_cases->first(); the_cases->more(i); i = the_cases->next(i)) {
     branch_class* ith_branch = (branch_class*) the_cases->nth(i);
 
     sym_tab->enterscope();
     symbol_table_data* data = new symbol_table_data({NULL, NULL, ith_branch->get_type_decl(), NULL});
     sym_tab->addid(ith_branch->get_name(), data);
-    ith_branch_expr_type = get_expression_type(c, ith_branch->get_expr(), sym_tab);
+    Symbol ith_branch_expr_type = get_expression_type(c, ith_branch->get_expr(), sym_tab);
 
     sym_tab->exitscope();
-    curr_lub = evaluate_lub_of_types(curr_lub, ith_branch_expr_type, sym_tab);
+    curr_lub = curr_lub == NULL ? ith_branch_expr_type
+                                : evaluate_lub_of_types(curr_lub, ith_branch_expr_type, sym_tab);
   }
   return curr_lub;
 }
@@ -1,9 +1,12 @@
 #include <stdio.h>
 #include "cool-tree.h"
+#include "ast-stream.h"
+#include "stats.h"
 
 extern Program ast_root;      // root of the abstract syntax tree
 FILE *ast_file = stdin;       // we read the AST from standard input
 extern int ast_yyparse(void); // entry point to the AST parser
+extern int binary_stream;     // write the AST in binary (-b)
 
 int cool_yydebug;     // not used, but needed to link with handle_flags
 char *curr_filename;
@@ -12,8 +15,26 @@ void handle_flags(int argc, char *argv[]);
 
 int main(int argc, char *argv[]) {
   handle_flags(argc,argv);
-  ast_yyparse();
-  ast_root->semant();
-  ast_root->dump_with_types(cout,0);
+  // the AST may be text or binary; the first byte tells
+  {
+    StatsPass pass("read AST");
+    if (ast_stream_is_binary(ast_file))
+      ast_root = ast_stream_read(ast_file);
+    else
+      ast_yyparse();
+  }
+  {
+    StatsPass pass("semant");
+    ast_root->semant();
+  }
+  {
+    StatsPass pass("write AST");
+    if (binary_stream)
+      ast_root->dump_binary(cout);
+    else
+      ast_root->dump_with_types(cout,0);
+  }
+  stats_report("semant");
+  trace_write();
 }
 
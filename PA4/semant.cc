@@ -5,6 +5,7 @@
 #include "semant.h"
 #include "symtab.h"
 #include "utilities.h"
+#include "stats.h"
 
 #include <vector>
 #include <string>
@@ -147,12 +148,11 @@ ClassTable::ClassTable(Classes classes) : semant_errors(0) , error_stream(cerr)
     semant_error() << "Class Main is not defined." << std::endl;
   }
 
+  StatsPass *pass = new StatsPass("inheritance graph");
   mycode::inheritance_graph* i_graph = mycode::build_inheritance_graph(classes_list, faulty_class);
+  delete pass;
 
-  if (!faulty_class) {
-    DEBUG_ACTION(std::cout << "Built inheritance graph successfully." << std::endl);
-  } else {
-    DEBUG_ACTION(std::cout << "Unable to build inheritance graph. Program is semantically incorrect." << std::endl);
+  if (faulty_class) {
     semant_error(faulty_class) << "Error with class " << faulty_class->get_name() << endl;
   }
 
@@ -314,25 +314,29 @@ void program_class::semant()
   initialize_constants();
 
   /* ClassTable constructor may do some semantic analysis */
+  StatsPass *pass = new StatsPass("class table");
   ClassTable *classtable = new ClassTable(classes);
+  delete pass;
 
   /* some semantic analysis code may go here */
 
   SymbolTable<Symbol, mycode::symbol_table_data>* symbol_table(new SymbolTable<Symbol, mycode::symbol_table_data>);
 
+  pass = new StatsPass("global scope");
   mycode::initialize_symbol_table_with_globals(classes_list, symbol_table);
+  delete pass;
   
   if (classtable->errors()) {
   	cerr << "Compilation halted due to static semantic errors." << endl;
 	  exit(1);
   }
   else {
+    // validate_class also sets the type of every expression
+    StatsPass pass("feature validation");
     for (int i = 0; classes->more(i); i = classes->next(i)) {
       Class_ c = classes->nth(i);
-      DEBUG_ACTION(std::cout << " Validating Class " << ((class__class*)c->copy_Class_())->get_name() << std::endl);
-      if (mycode::validate_class(c, symbol_table) ) {      
-        DEBUG_ACTION(std::cout << "Class " << ((class__class*)c->copy_Class_())->get_name() << " is okay."<< std::endl);
-      } else {
+      TRACE_SCOPE("validate_class", c->get_name()->get_string());
+      if (!mycode::validate_class(c, symbol_table)) {
         classtable->semant_error(c) << "Error validating class " << ((class__class*)c->copy_Class_())->get_name() << std::endl;
       }
     }
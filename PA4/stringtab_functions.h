@@ -9,6 +9,7 @@
 #define min(a,b) (a > b ? b : a)
 
 #include "stringtab.h"
+#include "counters.h"
 #include <stdio.h>
 
 //
@@ -32,10 +33,15 @@ template <class Elem>
 Elem *StringTable<Elem>::add_string(char *s, int maxchars)
 {
   int len = min((int) strlen(s),maxchars);
-  for(List<Elem> *l = tbl; l; l = l->tl())
-    if (l->hd()->equal_string(s,len))
+  for(List<Elem> *l = tbl; l; l = l->tl()) {
+    COUNT_VISIT(COUNTER_STRTAB_ADD);
+    if (l->hd()->equal_string(s,len)) {
+      COUNT_CALL(COUNTER_STRTAB_ADD, true);
       return l->hd();
+    }
+  }
 
+  COUNT_CALL(COUNTER_STRTAB_ADD, false);
   Elem *e = new Elem(s,len,index++);
   tbl = new List<Elem>(e, tbl);
   return e;
@@ -50,9 +56,13 @@ template <class Elem>
 Elem *StringTable<Elem>::lookup_string(char *s)
 {
   int len = strlen(s);
-  for(List<Elem> *l = tbl; l; l = l->tl())
-    if (l->hd()->equal_string(s,len))
+  for(List<Elem> *l = tbl; l; l = l->tl()) {
+    COUNT_VISIT(COUNTER_STRTAB_LOOKUP_STRING);
+    if (l->hd()->equal_string(s,len)) {
+      COUNT_CALL(COUNTER_STRTAB_LOOKUP_STRING, true);
       return l->hd();
+    }
+  }
   assert(0);   // fail if string is not found
   return NULL; // to avoid compiler warning
 }
@@ -64,9 +74,13 @@ Elem *StringTable<Elem>::lookup_string(char *s)
 template <class Elem>
 Elem *StringTable<Elem>::lookup(int ind)
 {
-  for(List<Elem> *l = tbl; l; l = l->tl())
-    if (l->hd()->equal_index(ind))
+  for(List<Elem> *l = tbl; l; l = l->tl()) {
+    COUNT_VISIT(COUNTER_STRTAB_LOOKUP);
+    if (l->hd()->equal_index(ind)) {
+      COUNT_CALL(COUNTER_STRTAB_LOOKUP, true);
       return l->hd();
+    }
+  }
   assert(0);   // fail if string is not found
   return NULL; // to avoid compiler warning
 }
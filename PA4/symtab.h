@@ -15,6 +15,7 @@
 #define _SYMTAB_H_
 
 #include "list.h"
+#include "counters.h"
 
 //
 // SymtabEnty<SYM,DAT> defines the entry for a symbol table that associates
@@ -130,11 +131,14 @@ public:
    {
        for(ScopeList *i = tbl; i != NULL; i=i->tl()) {
 	   for( Scope *j = i->hd(); j != NULL; j = j->tl()) {
+	       COUNT_VISIT(COUNTER_SYMTAB_LOOKUP);
 	       if (s == j->hd()->get_id()) {
+		   COUNT_CALL(COUNTER_SYMTAB_LOOKUP, true);
 		   return (j->hd()->get_info());
 	       }
 	   }
        }
+       COUNT_CALL(COUNTER_SYMTAB_LOOKUP, false);
        return NULL;
    }
 
@@ -146,10 +150,13 @@ public:
 	   fatal_error("probe: No scope in symbol table.");
        }
        for(Scope *i = tbl->hd(); i != NULL; i = i->tl()) {
+	   COUNT_VISIT(COUNTER_SYMTAB_PROBE);
 	   if (s == i->hd()->get_id()) {
+	       COUNT_CALL(COUNTER_SYMTAB_PROBE, true);
 	       return(i->hd()->get_info());
 	   }
        }
+       COUNT_CALL(COUNTER_SYMTAB_PROBE, false);
        return(NULL);
    }
 
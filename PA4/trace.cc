@@ -0,0 +1,129 @@
+//
+// See copyright.h for copyright notice and limitation of liability
+// and disclaimer of warranty provisions.
+//
+#include "copyright.h"
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  trace.cc
+//
+//  The per-thread ring buffers behind TraceScope (trace.h) and the
+//  writer of the Chrome trace event file.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include "trace.h"
+
+#ifdef TRACE
+
+#include <stdio.h>
+#include <unistd.h>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "cool-io.h"
+
+struct TraceRecord {
+  const char *cat;
+  const char *name;
+  long long start;
+  long long end;
+};
+
+struct TraceBuffer {
+  int tid;                      // 1 for the main thread
+  unsigned long count;          // events recorded; the ring holds the last
+  TraceRecord ring[TRACE_RING_SIZE];
+};
+
+static std::vector<TraceBuffer *> buffers;  // of all threads, never freed
+static std::mutex buffers_lock;             // taken once per thread
+static thread_local TraceBuffer *buffer = NULL;
+static int next_tid = 2;                    // of the other threads
+static std::thread::id main_thread = std::this_thread::get_id();
+
+void trace_event(const char *cat, const char *name, long long start,
+                 long long end)
+{
+  if (buffer == NULL) {
+    buffer = new TraceBuffer;
+    buffer->count = 0;
+    std::lock_guard<std::mutex> guard(buffers_lock);
+    buffers.push_back(buffer);
+    buffer->tid = std::this_thread::get_id() == main_thread ? 1 : next_tid++;
+  }
+  TraceRecord& r = buffer->ring[buffer->count++ % TRACE_RING_SIZE];
+  r.cat = cat;
+  r.name = name;
+  r.start = start;
+  r.end = end;
+}
+
+static void json_string(FILE *f, const char *s)
+{
+  fputc('"', f);
+  for (; *s; s++) {
+    if (*s == '"' || *s == '\\')
+      fputc('\\', f);
+    fputc((unsigned char) *s < ' ' ? ' ' : *s, f);
+  }
+  fputc('"', f);
+}
+
+void trace_write()
+{
+  if (trace_filename == NULL)
+    return;
+  FILE *f = fopen(trace_filename, "w");
+  if (f == NULL) {
+    cerr << "Cannot open trace file " << trace_filename << endl;
+    return;
+  }
+
+  std::lock_guard<std::mutex> guard(buffers_lock);
+  long long origin = -1;        // timestamps are from the first event
+  for (size_t i = 0; i < buffers.size(); i++) {
+    TraceBuffer *b = buffers[i];
+    unsigned long first = b->count > TRACE_RING_SIZE
+                          ? b->count - TRACE_RING_SIZE : 0;
+    for (unsigned long n = first; n < b->count; n++) {
+      long long start = b->ring[n % TRACE_RING_SIZE].start;
+      if (origin < 0 || start < origin)
+        origin = start;
+    }
+  }
+
+  int pid = getpid();
+  fprintf(f, "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n");
+  const char *sep = "";
+  for (size_t i = 0; i < buffers.size(); i++) {
+    TraceBuffer *b = buffers[i];
+    fprintf(f, "%s{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": %d, "
+            "\"tid\": %d, \"args\": {\"name\": ", sep, pid, b->tid);
+    if (b->tid == 1)
+      fprintf(f, "\"main\"");
+    else
+      fprintf(f, "\"thread %d\"", b->tid);
+    fprintf(f, "}}");
+    sep = ",\n";
+
+    unsigned long first = b->count > TRACE_RING_SIZE
+                          ? b->count - TRACE_RING_SIZE : 0;
+    for (unsigned long n = first; n < b->count; n++) {
+      TraceRecord& r = b->ring[n % TRACE_RING_SIZE];
+      fprintf(f, "%s{\"name\": ", sep);
+      json_string(f, r.name);
+      fprintf(f, ", \"cat\": ");
+      json_string(f, r.cat);
+      fprintf(f, ", \"ph\": \"X\", \"ts\": %.3f, \"dur\": %.3f, "
+              "\"pid\": %d, \"tid\": %d}",
+              (r.start - origin) / 1000.0, (r.end - r.start) / 1000.0,
+              pid, b->tid);
+    }
+  }
+  fprintf(f, "\n]}\n");
+  fclose(f);
+}
+
+#endif
@@ -47,3 +47,7 @@ tree_node *tree_node::set(tree_node *t) {
    line_number = t->line_number;
    return this;
 }
+
+void tree_node::set_line_number(int n) {
+   line_number = n;
+}
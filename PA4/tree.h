@@ -15,7 +15,9 @@
 ///////////////////////////////////////////////////////////////////////////
  
 
+#include <stdlib.h>
 #include "stringtab.h"
+#include "counters.h"
 #include "cool-io.h"
 
 /////////////////////////////////////////////////////////////////////
@@ -47,6 +49,10 @@
 //           sets the line number and type of "this" to the values in
 //           the argument tree_node.  Returns "this".
 //
+//       void set_line_number(int n)
+//           sets the line number of "this" to n, for nodes built
+//           before their line is known.
+//
 //
 ////////////////////////////////////////////////////////////////////////////
 class tree_node {
@@ -59,6 +65,7 @@ public:
     virtual void dump(ostream& stream, int n) = 0;
     int get_line_number();
     tree_node *set(tree_node *);
+    void set_line_number(int);
 };
 
 ///////////////////////////////////////////////////////////////////
@@ -110,6 +117,12 @@ public:
 //     list_node<Elem>::single(e);     where "e" has type Elem
 //     list_node<Elem>::append(l1,l2);
 //
+//     Lists built by append are trees as deep as the list is long, so nth
+//     and len take time linear in the length.  A parser that builds a
+//     long list one element at a time should add the elements to a
+//     list_buffer instead (see below) and turn it into a flat_list_node
+//     when the list is complete.
+//
 //////////////////////////////////////////////////////////////////////////////
 
 template <class Elem> class list_node : public tree_node {
@@ -174,6 +187,49 @@ public:
 };
 
 
+//
+// A list kept in one array; nth and len take constant time.  It is made
+// by finish_list from a list_buffer and owns the buffer's array.
+//
+template <class Elem> class flat_list_node : public list_node<Elem> {
+private:
+    Elem *elems;
+    int length;
+public:
+    flat_list_node(Elem *e, int n) {
+	elems = e;
+	length = n;
+    }
+    ~flat_list_node() { free(elems); }
+    list_node<Elem> *copy_list();
+    int len();
+    Elem nth_length(int n, int &len);
+    void dump(ostream& stream, int n);
+};
+
+
+//
+// A growable array of list elements.  The parser allocates one when it
+// sees the first element of a list, adds the rest with add (which
+// returns the buffer, so an action can read "$$ = $1->add($2)"), and
+// passes the buffer to finish_list once, which deletes it and returns
+// the list.
+//
+template <class Elem> class list_buffer {
+private:
+    Elem *elems;
+    int length;
+    int capacity;
+    template <class E> friend list_node<E> *finish_list(list_buffer<E> *b);
+public:
+    list_buffer() {
+	elems = NULL;
+	length = capacity = 0;
+    }
+    list_buffer<Elem> *add(Elem e);
+};
+
+
 template <class Elem> single_list_node<Elem> *list(Elem x);
 template <class Elem> append_node<Elem> *cons(Elem x, list_node<Elem> *l);
 template <class Elem> append_node<Elem> *xcons(list_node<Elem> *l, Elem x);
@@ -199,6 +255,7 @@ template <class Elem> Elem list_node<Elem>::nth(int n)
     int len;
     Elem tmp = nth_length(n ,len);
 
+    COUNT_CALL(COUNTER_LIST_NTH, tmp != NULL);
     if (tmp)
 	return tmp;
     else {
@@ -213,6 +270,7 @@ template <class Elem> Elem append_node<Elem>::nth(int n)
     int len;
     Elem tmp = nth_length(n ,len);
 
+    COUNT_CALL(COUNTER_LIST_NTH, tmp != NULL);
     if (tmp)
 	return tmp;
     else {
@@ -257,6 +315,7 @@ template <class Elem> int nil_node<Elem>::len()
 ///////////////////////////////////////////////////////////////////////////
 template <class Elem> Elem nil_node<Elem>::nth_length(int, int &len)
 {
+    COUNT_VISIT(COUNTER_LIST_NTH);
     len = 0;
     return NULL;
 }
@@ -310,6 +369,7 @@ template <class Elem> int single_list_node<Elem>::len()
 ///////////////////////////////////////////////////////////////////////////
 template <class Elem> Elem single_list_node<Elem>::nth_length(int n, int &len)
 {
+    COUNT_VISIT(COUNTER_LIST_NTH);
     len = 1;
     if (n)
 	return NULL;
@@ -366,6 +426,7 @@ template <class Elem> int append_node<Elem>::len()
 ///////////////////////////////////////////////////////////////////////////
 template <class Elem> Elem append_node<Elem>::nth_length(int n, int &len)
 {
+    COUNT_VISIT(COUNTER_LIST_NTH);
     int rlen;
     Elem tmp = some->nth_length(n, len);
 
@@ -428,4 +489,108 @@ template <class Elem> append_node<Elem> *xcons(list_node<Elem> *l, Elem x)
     return new append_node<Elem>(l, list(x));
 }
 
+
+///////////////////////////////////////////////////////////////////////////
+//
+// flat_list_node::copy_list
+//
+// return the deep copy of the flat_list_node
+//
+///////////////////////////////////////////////////////////////////////////
+template <class Elem> list_node<Elem> *flat_list_node<Elem>::copy_list()
+{
+    Elem *copy = (Elem *) malloc(length * sizeof(Elem));
+    for (int i = 0; i < length; i++)
+	copy[i] = (Elem) elems[i]->copy();
+    return new flat_list_node<Elem>(copy, length);
+}
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+// flat_list_node::len
+//
+// return the length of the flat_list_node
+//
+///////////////////////////////////////////////////////////////////////////
+template <class Elem> int flat_list_node<Elem>::len()
+{
+    return length;
+}
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+// flat_list_node::nth_length
+//
+// return the nth element on the list
+//
+///////////////////////////////////////////////////////////////////////////
+template <class Elem> Elem flat_list_node<Elem>::nth_length(int n, int &len)
+{
+    COUNT_VISIT(COUNTER_LIST_NTH);
+    len = length;
+    if (n < 0 || n >= length)
+	return NULL;
+    else
+	return elems[n];
+}
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+// flat_list_node::dump
+//
+// dump for list node
+//
+///////////////////////////////////////////////////////////////////////////
+template <class Elem> void flat_list_node<Elem>::dump(ostream& stream, int n)
+{
+    stream << pad(n) << "list\n";
+    for (int i = 0; i < length; i++)
+      elems[i]->dump(stream, n+2);
+    stream << pad(n) << "(end_of_list)\n";
+}
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+// list_buffer::add
+//
+// append an element, doubling the array when it is full
+//
+///////////////////////////////////////////////////////////////////////////
+template <class Elem> list_buffer<Elem> *list_buffer<Elem>::add(Elem e)
+{
+    if (length == capacity) {
+	capacity = capacity ? 2 * capacity : 8;
+	elems = (Elem *) realloc(elems, capacity * sizeof(Elem));
+    }
+    elems[length++] = e;
+    return this;
+}
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+// finish_list
+//
+// turn a list_buffer into a list, trimming its array to the elements
+// added, and delete the buffer
+//
+///////////////////////////////////////////////////////////////////////////
+template <class Elem> list_node<Elem> *finish_list(list_buffer<Elem> *b)
+{
+    list_node<Elem> *l;
+
+    if (b->length == 0) {
+	free(b->elems);
+	l = new nil_node<Elem>();
+    } else
+	l = new flat_list_node<Elem>(
+	  (Elem *) realloc(b->elems, b->length * sizeof(Elem)), b->length);
+    delete b;
+    return l;
+}
+
 #endif /* TREE_H */
@@ -0,0 +1,831 @@
+//
+// See copyright.h for copyright notice and limitation of liability
+// and disclaimer of warranty provisions.
+//
+#include "copyright.h"
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  ast-stream.cc
+//
+//  Writer and reader for the binary AST; see ast-stream.h for the
+//  layout.  write_binary is a recursive traversal with one method per
+//  kind of node, like dump_with_types in dumptype.cc.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "ast-stream.h"
+#include "utilities.h"
+
+static unsigned int zigzag(int v)
+{
+  return ((unsigned int) v << 1) ^ (unsigned int) (v >> 31);
+}
+
+static int unzigzag(unsigned int v)
+{
+  return (int) (v >> 1) ^ -(int) (v & 1);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  AstStreamWriter
+//
+//////////////////////////////////////////////////////////////////////////////
+
+void AstStreamWriter::put_varint(std::string& out, unsigned int v)
+{
+  while (v >= 0x80) {
+    out += (char) (v | 0x80);
+    v >>= 7;
+  }
+  out += (char) v;
+}
+
+int AstStreamWriter::intern(AstSymbolKind kind, Symbol s)
+{
+  std::map<Symbol, int>::iterator it = symbol_index.find(s);
+  if (it != symbol_index.end())
+    return it->second;
+
+  int index = symbols.size();
+  symbols.push_back(std::make_pair((char) kind, s));
+  symbol_index[s] = index;
+  return index;
+}
+
+//
+// Starts the record of a class: notes its offset for the class index
+// and counts its lines from 0, so that it can be decoded by itself.
+//
+void AstStreamWriter::begin_class()
+{
+  class_offsets.push_back(nodes.size());
+  last_line = 0;
+}
+
+void AstStreamWriter::put_node(AstNodeTag tag, int lineno)
+{
+  nodes += (char) tag;
+  put_varint(nodes, zigzag(lineno - last_line));
+  last_line = lineno;
+}
+
+//
+// Types are written shifted up by one, so that 0 can stand for a node
+// whose type has not been set.
+//
+void AstStreamWriter::put_type(Symbol type)
+{
+  put_varint(nodes, type == NULL ? 0 : intern(AS_ID, type) + 1);
+}
+
+void AstStreamWriter::flush(ostream& out)
+{
+  std::string header(AST_STREAM_MAGIC, 4);
+  put_varint(header, AST_STREAM_VERSION);
+
+  put_varint(header, symbols.size());
+  for (size_t i = 0; i < symbols.size(); i++) {
+    Symbol s = symbols[i].second;
+    header += symbols[i].first;
+    put_varint(header, s->get_len());
+    header.append(s->get_string(), s->get_len());
+    header += '\0';
+  }
+
+  put_varint(header, class_offsets.size());
+  for (size_t i = 0; i < class_offsets.size(); i++)
+    put_varint(header, class_offsets[i]);
+
+  out.write(header.data(), header.size());
+  out.write(nodes.data(), nodes.size());
+  out.flush();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  write_binary
+//
+//   Each node writes its tag and line, then its fields in the order
+//   dump_with_types prints them, then (for expressions) its type.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+void program_class::dump_binary(ostream& stream)
+{
+  AstStreamWriter w;
+  write_binary(w);
+  w.flush(stream);
+}
+
+void program_class::write_binary(AstStreamWriter& w)
+{
+  w.put_node(AST_PROGRAM, line_number);
+  w.put_length(classes->len());
+  for (int i = classes->first(); classes->more(i); i = classes->next(i))
+    classes->nth(i)->write_binary(w);
+}
+
+void class__class::write_binary(AstStreamWriter& w)
+{
+  w.begin_class();
+  w.put_node(AST_CLASS, line_number);
+  w.put_id(name);
+  w.put_id(parent);
+  w.put_str(filename);
+  w.put_length(features->len());
+  for (int i = features->first(); features->more(i); i = features->next(i))
+    features->nth(i)->write_binary(w);
+}
+
+void method_class::write_binary(AstStreamWriter& w)
+{
+  w.put_node(AST_METHOD, line_number);
+  w.put_id(name);
+  w.put_length(formals->len());
+  for (int i = formals->first(); formals->more(i); i = formals->next(i))
+    formals->nth(i)->write_binary(w);
+  w.put_id(return_type);
+  expr->write_binary(w);
+}
+
+void attr_class::write_binary(AstStreamWriter& w)
+{
+  w.put_node(AST_ATTR, line_number);
+  w.put_id(name);
+  w.put_id(type_decl);
+  init->write_binary(w);
+}
+
+void formal_class::write_binary(AstStreamWriter& w)
+{
+  w.put_node(AST_FORMAL, line_number);
+  w.put_id(name);
+  w.put_id(type_decl);
+}
+
+void branch_class::write_binary(AstStreamWriter& w)
+{
+  w.put_node(AST_BRANCH, line_number);
+  w.put_id(name);
+  w.put_id(type_decl);
+  expr->write_binary(w);
+}
+
+void binding_class::write_binary(AstStreamWriter& w)
+{
+  w.put_node(AST_BINDING, line_number);
+  w.put_id(identifier);
+  w.put_id(type_decl);
+  init->write_binary(w);
+}
+
+void assign_class::write_binary(AstStreamWriter& w)
+{
+  w.put_node(AST_ASSIGN, line_number);
+  w.put_id(name);
+  expr->write_binary(w);
+  w.put_type(type);
+}
+
+void static_dispatch_class::write_binary(AstStreamWriter& w)
+{
+  w.put_node(AST_STATIC_DISPATCH, line_number);
+  expr->write_binary(w);
+  w.put_id(type_name);
+  w.put_id(name);
+  w.put_length(actual->len());
+  for (int i = actual->first(); actual->more(i); i = actual->next(i))
+    actual->nth(i)->write_binary(w);
+  w.put_type(type);
+}
+
+void dispatch_class::write_binary(AstStreamWriter& w)
+{
+  w.put_node(AST_DISPATCH, line_number);
+  expr->write_binary(w);
+  w.put_id(name);
+  w.put_length(actual->len());
+  for (int i = actual->first(); actual->more(i); i = actual->next(i))
+    actual->nth(i)->write_binary(w);
+  w.put_type(type);
+}
+
+void cond_class::write_binary(AstStreamWriter& w)
+{
+  w.put_node(AST_COND, line_number);
+  pred->write_binary(w);
+  then_exp->write_binary(w);
+  else_exp->write_binary(w);
+  w.put_type(type);
+}
+
+void loop_class::write_binary(AstStreamWriter& w)
+{
+  w.put_node(AST_LOOP, line_number);
+  pred->write_binary(w);
+  body->write_binary(w);
+  w.put_type(type);
+}
+
+void typcase_class::write_binary(AstStreamWriter& w)
+{
+  w.put_node(AST_TYPCASE, line_number);
+  expr->write_binary(w);
+  w.put_length(cases->len());
+  for (int i = cases->first(); cases->more(i); i = cases->next(i))
+    cases->nth(i)->write_binary(w);
+  w.put_type(type);
+}
+
+void block_class::write_binary(AstStreamWriter& w)
+{
+  w.put_node(AST_BLOCK, line_number);
+  w.put_length(body->len());
+  for (int i = body->first(); body->more(i); i = body->next(i))
+    body->nth(i)->write_binary(w);
+  w.put_type(type);
+}
+
+void let_class::write_binary(AstStreamWriter& w)
+{
+  w.put_node(AST_LET, line_number);
+  w.put_length(bindings->len());
+  for (int i = bindings->first(); bindings->more(i); i = bindings->next(i))
+    bindings->nth(i)->write_binary(w);
+  body->write_binary(w);
+  w.put_type(type);
+}
+
+void plus_class::write_binary(AstStreamWriter& w)
+{
+  w.put_node(AST_PLUS, line_number);
+  e1->write_binary(w);
+  e2->write_binary(w);
+  w.put_type(type);
+}
+
+void sub_class::write_binary(AstStreamWriter& w)
+{
+  w.put_node(AST_SUB, line_number);
+  e1->write_binary(w);
+  e2->write_binary(w);
+  w.put_type(type);
+}
+
+void mul_class::write_binary(AstStreamWriter& w)
+{
+  w.put_node(AST_MUL, line_number);
+  e1->write_binary(w);
+  e2->write_binary(w);
+  w.put_type(type);
+}
+
+void divide_class::write_binary(AstStreamWriter& w)
+{
+  w.put_node(AST_DIVIDE, line_number);
+  e1->write_binary(w);
+  e2->write_binary(w);
+  w.put_type(type);
+}
+
+void neg_class::write_binary(AstStreamWriter& w)
+{
+  w.put_node(AST_NEG, line_number);
+  e1->write_binary(w);
+  w.put_type(type);
+}
+
+void lt_class::write_binary(AstStreamWriter& w)
+{
+  w.put_node(AST_LT, line_number);
+  e1->write_binary(w);
+  e2->write_binary(w);
+  w.put_type(type);
+}
+
+void eq_class::write_binary(AstStreamWriter& w)
+{
+  w.put_node(AST_EQ, line_number);
+  e1->write_binary(w);
+  e2->write_binary(w);
+  w.put_type(type);
+}
+
+void leq_class::write_binary(AstStreamWriter& w)
+{
+  w.put_node(AST_LEQ, line_number);
+  e1->write_binary(w);
+  e2->write_binary(w);
+  w.put_type(type);
+}
+
+void comp_class::write_binary(AstStreamWriter& w)
+{
+  w.put_node(AST_COMP, line_number);
+  e1->write_binary(w);
+  w.put_type(type);
+}
+
+void int_const_class::write_binary(AstStreamWriter& w)
+{
+  w.put_node(AST_INT_CONST, line_number);
+  w.put_int(token);
+  w.put_type(type);
+}
+
+void bool_const_class::write_binary(AstStreamWriter& w)
+{
+  w.put_node(AST_BOOL_CONST, line_number);
+  w.put_int(val ? 1 : 0);
+  w.put_type(type);
+}
+
+void string_const_class::write_binary(AstStreamWriter& w)
+{
+  w.put_node(AST_STRING_CONST, line_number);
+  w.put_str(token);
+  w.put_type(type);
+}
+
+void new__class::write_binary(AstStreamWriter& w)
+{
+  w.put_node(AST_NEW, line_number);
+  w.put_id(type_name);
+  w.put_type(type);
+}
+
+void isvoid_class::write_binary(AstStreamWriter& w)
+{
+  w.put_node(AST_ISVOID, line_number);
+  e1->write_binary(w);
+  w.put_type(type);
+}
+
+void no_expr_class::write_binary(AstStreamWriter& w)
+{
+  w.put_node(AST_NO_EXPR, line_number);
+  w.put_type(type);
+}
+
+void object_class::write_binary(AstStreamWriter& w)
+{
+  w.put_node(AST_OBJECT, line_number);
+  w.put_id(name);
+  w.put_type(type);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  AstStreamReader
+//
+//////////////////////////////////////////////////////////////////////////////
+
+static void malformed()
+{
+  fatal_error("Malformed binary AST\n");
+}
+
+int AstStreamReader::get_byte()
+{
+  if (pos >= end)
+    fatal_error("Truncated binary AST\n");
+  return (unsigned char) *pos++;
+}
+
+unsigned int AstStreamReader::get_varint()
+{
+  unsigned int v = 0;
+  for (int shift = 0; shift < 35; shift += 7) {
+    unsigned char c = get_byte();
+    v |= (unsigned int) (c & 0x7f) << shift;
+    if (!(c & 0x80))
+      return v;
+  }
+  malformed();
+  return 0;
+}
+
+Symbol AstStreamReader::get_symbol()
+{
+  unsigned int index = get_varint();
+  if (index >= symbols.size())
+    malformed();
+  return symbols[index];
+}
+
+//
+// Reads the tag and line of a node.  The line is left in `line' for the
+// caller, which must stamp it on the node after building the children.
+//
+int AstStreamReader::get_tag()
+{
+  int tag = get_byte();
+  line += unzigzag(get_varint());
+  return tag;
+}
+
+//
+// Nodes take their line number from node_lineno when they are made;
+// the reader sets it afterwards instead, since the children are made
+// first.
+//
+template <class T> T AstStreamReader::at_line(T node, int lineno)
+{
+  node->set_line_number(lineno);
+  return keep(node);
+}
+
+//
+// Remembers a node made for read_features, so release can delete it.
+//
+template <class T> T AstStreamReader::keep(T node)
+{
+  if (tracking)
+    made.push_back(node);
+  return node;
+}
+
+//
+// A class is read from its own start of line numbers, so that it can be
+// decoded by itself.
+//
+Class_ AstStreamReader::read_class()
+{
+  line = 0;
+  if (get_tag() != AST_CLASS)
+    malformed();
+  int lineno = line;
+  Symbol name = get_symbol();
+  Symbol parent = get_symbol();
+  Symbol filename = get_symbol();
+  return at_line(class_(name, parent, read_features(), filename), lineno);
+}
+
+Features AstStreamReader::read_features()
+{
+  int n = get_varint();
+  list_buffer<Feature> *features = new list_buffer<Feature>;
+  for (int i = 0; i < n; i++)
+    features->add(read_feature());
+  return keep(finish_list(features));
+}
+
+Feature AstStreamReader::read_feature()
+{
+  int tag = get_tag();
+  int lineno = line;
+  Symbol name = get_symbol();
+  if (tag == AST_METHOD) {
+    int n = get_varint();
+    list_buffer<Formal> *formals = new list_buffer<Formal>;
+    for (int i = 0; i < n; i++)
+      formals->add(read_formal());
+    Symbol return_type = get_symbol();
+    Expression expr = read_expression();
+    return at_line(method(name, keep(finish_list(formals)), return_type, expr), lineno);
+  }
+  if (tag != AST_ATTR)
+    malformed();
+  Symbol type_decl = get_symbol();
+  Expression init = read_expression();
+  return at_line(attr(name, type_decl, init), lineno);
+}
+
+Formal AstStreamReader::read_formal()
+{
+  if (get_tag() != AST_FORMAL)
+    malformed();
+  int lineno = line;
+  Symbol name = get_symbol();
+  Symbol type_decl = get_symbol();
+  return at_line(formal(name, type_decl), lineno);
+}
+
+Case AstStreamReader::read_case()
+{
+  if (get_tag() != AST_BRANCH)
+    malformed();
+  int lineno = line;
+  Symbol name = get_symbol();
+  Symbol type_decl = get_symbol();
+  Expression expr = read_expression();
+  return at_line(branch(name, type_decl, expr), lineno);
+}
+
+Binding AstStreamReader::read_binding()
+{
+  if (get_tag() != AST_BINDING)
+    malformed();
+  int lineno = line;
+  Symbol identifier = get_symbol();
+  Symbol type_decl = get_symbol();
+  Expression init = read_expression();
+  return at_line(binding(identifier, type_decl, init), lineno);
+}
+
+Expressions AstStreamReader::read_expressions()
+{
+  int n = get_varint();
+  list_buffer<Expression> *exprs = new list_buffer<Expression>;
+  for (int i = 0; i < n; i++)
+    exprs->add(read_expression());
+  return keep(finish_list(exprs));
+}
+
+Expression AstStreamReader::read_expression()
+{
+  int tag = get_tag();
+  int lineno = line;
+  Expression e = NULL;
+  switch (tag) {
+  case AST_ASSIGN: {
+    Symbol name = get_symbol();
+    e = assign(name, read_expression());
+    break;
+  }
+  case AST_STATIC_DISPATCH: {
+    Expression expr = read_expression();
+    Symbol type_name = get_symbol();
+    Symbol name = get_symbol();
+    e = static_dispatch(expr, type_name, name, read_expressions());
+    break;
+  }
+  case AST_DISPATCH: {
+    Expression expr = read_expression();
+    Symbol name = get_symbol();
+    e = dispatch(expr, name, read_expressions());
+    break;
+  }
+  case AST_COND: {
+    Expression pred = read_expression();
+    Expression then_exp = read_expression();
+    e = cond(pred, then_exp, read_expression());
+    break;
+  }
+  case AST_LOOP: {
+    Expression pred = read_expression();
+    e = loop(pred, read_expression());
+    break;
+  }
+  case AST_TYPCASE: {
+    Expression expr = read_expression();
+    int n = get_varint();
+    list_buffer<Case> *cases = new list_buffer<Case>;
+    for (int i = 0; i < n; i++)
+      cases->add(read_case());
+    e = typcase(expr, keep(finish_list(cases)));
+    break;
+  }
+  case AST_BLOCK:
+    e = block(read_expressions());
+    break;
+  case AST_LET: {
+    int n = get_varint();
+    list_buffer<Binding> *bindings = new list_buffer<Binding>;
+    for (int i = 0; i < n; i++)
+      bindings->add(read_binding());
+    e = let(keep(finish_list(bindings)), read_expression());
+    break;
+  }
+  case AST_PLUS: {
+    Expression e1 = read_expression();
+    e = plus(e1, read_expression());
+    break;
+  }
+  case AST_SUB: {
+    Expression e1 = read_expression();
+    e = sub(e1, read_expression());
+    break;
+  }
+  case AST_MUL: {
+    Expression e1 = read_expression();
+    e = mul(e1, read_expression());
+    break;
+  }
+  case AST_DIVIDE: {
+    Expression e1 = read_expression();
+    e = divide(e1, read_expression());
+    break;
+  }
+  case AST_NEG:
+    e = neg(read_expression());
+    break;
+  case AST_LT: {
+    Expression e1 = read_expression();
+    e = lt(e1, read_expression());
+    break;
+  }
+  case AST_EQ: {
+    Expression e1 = read_expression();
+    e = eq(e1, read_expression());
+    break;
+  }
+  case AST_LEQ: {
+    Expression e1 = read_expression();
+    e = leq(e1, read_expression());
+    break;
+  }
+  case AST_COMP:
+    e = comp(read_expression());
+    break;
+  case AST_INT_CONST:
+    e = int_const(get_symbol());
+    break;
+  case AST_BOOL_CONST:
+    e = bool_const(get_varint() != 0);
+    break;
+  case AST_STRING_CONST:
+    e = string_const(get_symbol());
+    break;
+  case AST_NEW:
+    e = new_(get_symbol());
+    break;
+  case AST_ISVOID:
+    e = isvoid(read_expression());
+    break;
+  case AST_NO_EXPR:
+    e = no_expr();
+    break;
+  case AST_OBJECT:
+    e = object(get_symbol());
+    break;
+  default:
+    malformed();
+  }
+
+  unsigned int type_index = get_varint();
+  if (type_index > symbols.size())
+    malformed();
+  if (type_index != 0)
+    e->set_type(symbols[type_index - 1]);
+  return at_line(e, lineno);
+}
+
+//
+// Loads the header of the stream in `buf': the symbols, which are
+// entered in the string tables straight from the buffer, and the class
+// index.  The writer enters the symbols in the order a text AST shows
+// them, so the string tables come out the same as after reading the
+// text, and so does the generated code.  The buffer must stay valid as
+// long as classes are read from it.
+//
+void AstStreamReader::open(const char *buf, size_t len)
+{
+  pos = buf;
+  end = buf + len;
+  if (len < 4 || memcmp(buf, AST_STREAM_MAGIC, 4) != 0)
+    malformed();
+  pos += 4;
+  if (get_varint() != AST_STREAM_VERSION)
+    fatal_error("Unsupported binary AST version\n");
+
+  unsigned int count = get_varint();
+  symbols.resize(count);
+  for (unsigned int i = 0; i < count; i++) {
+    int kind = get_byte();
+    unsigned int n = get_varint();
+    if (n >= (size_t) (end - pos) || pos[n] != '\0')
+      malformed();
+    char *s = (char *) pos;
+    switch (kind) {
+    case AS_ID:  symbols[i] = idtable.add_string(s, n);     break;
+    case AS_INT: symbols[i] = inttable.add_string(s, n);    break;
+    case AS_STR: symbols[i] = stringtable.add_string(s, n); break;
+    default:     malformed();
+    }
+    pos += n + 1;
+  }
+
+  count = get_varint();
+  class_offsets.resize(count);
+  for (unsigned int i = 0; i < count; i++)
+    class_offsets[i] = get_varint();
+
+  // the node section starts with the program and its class count
+  nodes = pos;
+  line = 0;
+  if (get_tag() != AST_PROGRAM)
+    malformed();
+  program_line = line;
+  if (get_varint() != count)
+    malformed();
+  for (unsigned int i = 0; i < count; i++)
+    if (class_offsets[i] >= (size_t) (end - nodes))
+      malformed();
+}
+
+//
+// Decodes the whole tree.
+//
+Program AstStreamReader::read()
+{
+  list_buffer<Class_> *classes = new list_buffer<Class_>;
+  pos = nodes;
+  get_tag();
+  get_varint();
+  for (size_t i = 0; i < class_offsets.size(); i++)
+    classes->add(read_class());
+  if (pos != end)
+    malformed();
+  return at_line(program(keep(finish_list(classes))), program_line);
+}
+
+//
+// Decodes only the name, parent and file name of every class.  The
+// program returned has classes without features; read_features(i)
+// decodes the features of the i-th class when they are needed.
+//
+Program AstStreamReader::read_classes()
+{
+  list_buffer<Class_> *classes = new list_buffer<Class_>;
+  for (size_t i = 0; i < class_offsets.size(); i++) {
+    pos = nodes + class_offsets[i];
+    line = 0;
+    if (get_tag() != AST_CLASS)
+      malformed();
+    int lineno = line;
+    Symbol name = get_symbol();
+    Symbol parent = get_symbol();
+    Symbol filename = get_symbol();
+    classes->add(at_line(class_(name, parent, nil_Features(), filename), lineno));
+  }
+  return at_line(program(keep(finish_list(classes))), program_line);
+}
+
+//
+// Decodes the features of the i-th class.  Everything made here is
+// deleted by the next call to release.
+//
+Features AstStreamReader::read_features(int i)
+{
+  if (i < 0 || (size_t) i >= class_offsets.size())
+    fatal_error("Bad class index in binary AST\n");
+  pos = nodes + class_offsets[i];
+  line = 0;
+  get_tag();
+  get_symbol();
+  get_symbol();
+  get_symbol();
+
+  tracking = true;
+  Features features = read_features();
+  tracking = false;
+  return features;
+}
+
+void AstStreamReader::release()
+{
+  for (size_t i = 0; i < made.size(); i++)
+    delete made[i];
+  made.clear();
+}
+
+bool ast_stream_is_binary(FILE *f)
+{
+  int c = getc(f);
+  if (c == EOF)
+    return false;
+  ungetc(c, f);
+  return c == AST_STREAM_MAGIC[0];
+}
+
+//
+// A regular file is mapped from the current position to its end; a pipe
+// is read into memory.  Either way the buffer is never released, since
+// the symbols and classes read from it may be needed until the end.
+//
+const char *ast_stream_map(FILE *f, size_t *len)
+{
+  struct stat st;
+  long start = ftell(f);
+  if (start >= 0 && fstat(fileno(f), &st) == 0 && S_ISREG(st.st_mode) &&
+      st.st_size > start) {
+    void *map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fileno(f), 0);
+    if (map != MAP_FAILED) {
+      *len = st.st_size - start;
+      return (const char *) map + start;
+    }
+  }
+
+  std::vector<char> *buf = new std::vector<char>;
+  char chunk[65536];
+  size_t n;
+  while ((n = fread(chunk, 1, sizeof(chunk), f)) > 0)
+    buf->insert(buf->end(), chunk, chunk + n);
+  *len = buf->size();
+  return buf->empty() ? NULL : &(*buf)[0];
+}
+
+Program ast_stream_read(FILE *f)
+{
+  size_t len;
+  const char *buf = ast_stream_map(f, &len);
+  AstStreamReader reader;
+  reader.open(buf, len);
+  return reader.read();
+}
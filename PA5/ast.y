@@ -0,0 +1,231 @@
+/*
+ *  ast.y
+ *              Parser for the abstract syntax trees written by
+ *              dump_with_types (dumptype.cc).
+ */
+%{
+
+#include "cool-io.h"
+#include "cool-tree.h"
+#include "stringtab.h"
+#include "utilities.h"
+
+void ast_yyerror(char *);
+extern int node_lineno;
+extern int yylex();           /* the entry point to the lexer  */
+Program ast_root;             /* the result of the parse  */
+Classes parse_results;        /* for use in parsing multiple files */
+int omerrs = 0;               /* number of errors in lexing and parsing */
+int current_line = 0;         /* debugging, current line for input file */
+
+%}
+
+%union {
+  int lineno;
+  Boolean boolean;
+  Symbol symbol;
+  Program program;
+  Class_ class_;
+  Classes classes;
+  Feature feature;
+  Features features;
+  Formal formal;
+  Formals formals;
+  Case case_;
+  Cases cases;
+  Binding binding;
+  list_buffer<Binding> *binding_buffer;
+  Expression expression;
+  Expressions expressions;
+}
+
+%token PROGRAM CLASS METHOD ATTR FORMAL BRANCH ASSIGN STATIC_DISPATCH
+%token DISPATCH COND LOOP TYPCASE BLOCK LET PLUS SUB MUL DIVIDE NEG LT EQ
+%token LEQ COMP INT STR BOOL NEW ISVOID NO_EXPR OBJECT NO_TYPE
+%token <symbol> STR_CONST INT_CONST ID
+%token <lineno> LINENO
+
+%type <program> program
+%type <classes> class_list
+%type <class_> class
+%type <features> optional_feature_list feature_list
+%type <feature> feature
+%type <formals> formals formal_list
+%type <formal> formal
+%type <expression> expr expr_aux
+%type <expressions> actuals expr_list
+%type <cases> case_list
+%type <case_> simple_case
+%type <binding_buffer> binding_list
+%type <binding> binding
+
+%%
+
+program : nothing LINENO PROGRAM class_list
+		{ node_lineno = $2; ast_root = program($4); }
+	| nothing
+		{ exit(1); }
+	;
+
+nothing :
+		{ current_line = 1; }
+	;
+
+class_list
+	: class
+		{ $$ = single_Classes($1);
+                  parse_results = $$; }
+	| class_list class
+		{ $$ = append_Classes($1,single_Classes($2));
+                  parse_results = $$; }
+	;
+
+class  : LINENO CLASS ID ID STR_CONST '(' optional_feature_list ')'
+		{ node_lineno = $1;
+		  $$ = class_($3,$4,$7,$5); }
+	;
+
+optional_feature_list:
+		{  $$ = nil_Features(); }
+	| feature_list
+		{  $$ = $1; }
+	;
+
+feature_list
+	: feature
+		{  $$ = single_Features($1); }
+	| feature_list feature
+		{  $$ = append_Features($1,single_Features($2)); }
+	;
+
+feature : LINENO METHOD ID formals ID expr
+		{ node_lineno = $1; $$ = method($3,$4,$5,$6); }
+	| LINENO ATTR ID ID expr
+		{ node_lineno = $1; $$ = attr($3,$4,$5); }
+	;
+
+formals :
+		{ $$ = nil_Formals(); }
+	| formal_list
+		{ $$ = $1; }
+	;
+
+formal_list
+	: formal
+		{  $$ = single_Formals($1); }
+	| formal_list formal
+		{ $$ = append_Formals($1,single_Formals($2)); }
+	;
+
+formal  : LINENO FORMAL ID ID
+		{  node_lineno = $1; $$ = formal($3,$4); }
+	;
+
+expr : expr_aux ':' ID
+	  { $$ = $1;
+            $$->set_type($3); }
+     | expr_aux ':' NO_TYPE
+	  { $$ = $1; }
+     ;
+
+expr_aux : LINENO ASSIGN ID expr
+	  { node_lineno = $1; $$ = assign($3,$4); }
+	 | LINENO STATIC_DISPATCH expr ID ID actuals
+	  { node_lineno = $1; $$ = static_dispatch($3,$4,$5,$6);}
+	 | LINENO DISPATCH expr ID actuals
+	  { node_lineno = $1; $$ = dispatch($3,$4,$5); }
+	 | LINENO COND expr expr expr
+	  { node_lineno = $1; $$ = cond($3,$4,$5); }
+	 | LINENO LOOP expr expr
+	  { node_lineno = $1; $$ = loop($3,$4); }
+	 | LINENO BLOCK expr_list
+	  { node_lineno = $1; $$ = block($3); }
+	 | LINENO LET ID ID expr expr
+	  { node_lineno = $1; $$ = let($3,$4,$5,$6); }
+	 | LINENO LET '(' binding_list ')' expr
+	  { node_lineno = $1; $$ = let(finish_list($4),$6); }
+	 | LINENO TYPCASE expr case_list
+	  { node_lineno = $1; $$ = typcase($3,$4); }
+	 | LINENO NEW ID
+	  { node_lineno = $1; $$ = new_($3); }
+	 | LINENO ISVOID expr
+	  { node_lineno = $1; $$ = isvoid($3); }
+	 | LINENO PLUS expr expr
+	  { node_lineno = $1; $$ = plus($3,$4); }
+	 | LINENO SUB expr expr
+	  { node_lineno = $1; $$ = sub($3,$4); }
+	 | LINENO MUL expr expr
+	  { node_lineno = $1; $$ = mul($3,$4); }
+	 | LINENO DIVIDE expr expr
+	  { node_lineno = $1; $$ = divide($3,$4); }
+	 | LINENO NEG expr
+	  { node_lineno = $1; $$ = neg($3); }
+	 | LINENO LT expr expr
+	  { node_lineno = $1; $$ = lt($3,$4); }
+	 | LINENO EQ expr expr
+	  { node_lineno = $1; $$ = eq($3,$4); }
+	 | LINENO LEQ expr expr
+	  { node_lineno = $1; $$ = leq($3,$4); }
+	 | LINENO COMP expr
+	  { node_lineno = $1; $$ = comp($3); }
+	 | LINENO INT INT_CONST
+	  { node_lineno = $1; $$ = int_const($3); }
+	 | LINENO STR STR_CONST
+	  { node_lineno = $1; $$ = string_const($3); }
+	 | LINENO BOOL INT_CONST
+	  { node_lineno = $1;
+            if (*($3->get_string()) == '1')
+	      $$ = bool_const(1);
+	    else
+              $$ = bool_const(0);
+          }
+	 | LINENO OBJECT ID
+	  { node_lineno = $1; $$ = object($3); }
+	 | LINENO NO_EXPR
+	  { node_lineno = $1; $$ = no_expr(); }
+	 ;
+
+actuals : '(' ')'
+	  {  $$ = nil_Expressions(); }
+	| '(' expr_list ')'
+	  {  $$ = $2; }
+	;
+
+expr_list
+	: expr
+	  { $$ = single_Expressions($1); }
+	| expr_list expr
+	  { $$ = append_Expressions($1,single_Expressions($2)); }
+	;
+
+case_list
+	: simple_case
+	  { $$ = single_Cases($1); }
+	| case_list simple_case
+	  { $$ = append_Cases($1,single_Cases($2)); }
+	;
+
+simple_case : LINENO BRANCH ID ID expr
+	  { node_lineno = $1; $$ = branch($3,$4,$5); }
+	;
+
+/* The bindings of a let with more than one; see let_class::dump_with_types. */
+binding_list
+	: binding
+	  { $$ = (new list_buffer<Binding>)->add($1); }
+	| binding_list binding
+	  { $$ = $1->add($2); }
+	;
+
+binding : LINENO ID ID expr
+	  { node_lineno = $1; $$ = binding($2,$3,$4); }
+	;
+
+%%
+
+void ast_yyerror(char *msg)
+{
+   cerr << "Error in ast parsing (line " << current_line << "): ";
+   cerr << msg << endl;
+   exit(1);
+}
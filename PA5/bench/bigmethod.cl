@@ -0,0 +1,1517 @@
+(*
+ *  Big method: one main of 1500 statements, each with two calls and
+ *  their temporaries.  The program does little; it is here for the
+ *  time cgen takes on a long method, which must grow with its length
+ *  and not with its length times its temporaries.
+ *)
+
+class Main inherits IO {
+  id(x : Int) : Int { x };
+
+  main() : Object {
+    let x : Int <- 3, n : Int <- 0 in {
+      n <- n + id(x + 0) + id(x * 0);
+      n <- n + id(x + 1) + id(x * 1);
+      n <- n + id(x + 2) + id(x * 2);
+      n <- n + id(x + 3) + id(x * 3);
+      n <- n + id(x + 4) + id(x * 4);
+      n <- n + id(x + 5) + id(x * 5);
+      n <- n + id(x + 6) + id(x * 6);
+      n <- n + id(x + 7) + id(x * 7);
+      n <- n + id(x + 8) + id(x * 8);
+      n <- n + id(x + 9) + id(x * 9);
+      n <- n + id(x + 10) + id(x * 10);
+      n <- n + id(x + 11) + id(x * 11);
+      n <- n + id(x + 12) + id(x * 12);
+      n <- n + id(x + 13) + id(x * 13);
+      n <- n + id(x + 14) + id(x * 14);
+      n <- n + id(x + 15) + id(x * 15);
+      n <- n + id(x + 16) + id(x * 16);
+      n <- n + id(x + 17) + id(x * 17);
+      n <- n + id(x + 18) + id(x * 18);
+      n <- n + id(x + 19) + id(x * 19);
+      n <- n + id(x + 20) + id(x * 20);
+      n <- n + id(x + 21) + id(x * 21);
+      n <- n + id(x + 22) + id(x * 22);
+      n <- n + id(x + 23) + id(x * 23);
+      n <- n + id(x + 24) + id(x * 24);
+      n <- n + id(x + 25) + id(x * 25);
+      n <- n + id(x + 26) + id(x * 26);
+      n <- n + id(x + 27) + id(x * 27);
+      n <- n + id(x + 28) + id(x * 28);
+      n <- n + id(x + 29) + id(x * 29);
+      n <- n + id(x + 30) + id(x * 30);
+      n <- n + id(x + 31) + id(x * 31);
+      n <- n + id(x + 32) + id(x * 32);
+      n <- n + id(x + 33) + id(x * 33);
+      n <- n + id(x + 34) + id(x * 34);
+      n <- n + id(x + 35) + id(x * 35);
+      n <- n + id(x + 36) + id(x * 36);
+      n <- n + id(x + 37) + id(x * 37);
+      n <- n + id(x + 38) + id(x * 38);
+      n <- n + id(x + 39) + id(x * 39);
+      n <- n + id(x + 40) + id(x * 40);
+      n <- n + id(x + 41) + id(x * 41);
+      n <- n + id(x + 42) + id(x * 42);
+      n <- n + id(x + 43) + id(x * 43);
+      n <- n + id(x + 44) + id(x * 44);
+      n <- n + id(x + 45) + id(x * 45);
+      n <- n + id(x + 46) + id(x * 46);
+      n <- n + id(x + 47) + id(x * 47);
+      n <- n + id(x + 48) + id(x * 48);
+      n <- n + id(x + 49) + id(x * 49);
+      n <- n + id(x + 50) + id(x * 50);
+      n <- n + id(x + 51) + id(x * 51);
+      n <- n + id(x + 52) + id(x * 52);
+      n <- n + id(x + 53) + id(x * 53);
+      n <- n + id(x + 54) + id(x * 54);
+      n <- n + id(x + 55) + id(x * 55);
+      n <- n + id(x + 56) + id(x * 56);
+      n <- n + id(x + 57) + id(x * 57);
+      n <- n + id(x + 58) + id(x * 58);
+      n <- n + id(x + 59) + id(x * 59);
+      n <- n + id(x + 60) + id(x * 60);
+      n <- n + id(x + 61) + id(x * 61);
+      n <- n + id(x + 62) + id(x * 62);
+      n <- n + id(x + 63) + id(x * 63);
+      n <- n + id(x + 64) + id(x * 64);
+      n <- n + id(x + 65) + id(x * 65);
+      n <- n + id(x + 66) + id(x * 66);
+      n <- n + id(x + 67) + id(x * 67);
+      n <- n + id(x + 68) + id(x * 68);
+      n <- n + id(x + 69) + id(x * 69);
+      n <- n + id(x + 70) + id(x * 70);
+      n <- n + id(x + 71) + id(x * 71);
+      n <- n + id(x + 72) + id(x * 72);
+      n <- n + id(x + 73) + id(x * 73);
+      n <- n + id(x + 74) + id(x * 74);
+      n <- n + id(x + 75) + id(x * 75);
+      n <- n + id(x + 76) + id(x * 76);
+      n <- n + id(x + 77) + id(x * 77);
+      n <- n + id(x + 78) + id(x * 78);
+      n <- n + id(x + 79) + id(x * 79);
+      n <- n + id(x + 80) + id(x * 80);
+      n <- n + id(x + 81) + id(x * 81);
+      n <- n + id(x + 82) + id(x * 82);
+      n <- n + id(x + 83) + id(x * 83);
+      n <- n + id(x + 84) + id(x * 84);
+      n <- n + id(x + 85) + id(x * 85);
+      n <- n + id(x + 86) + id(x * 86);
+      n <- n + id(x + 87) + id(x * 87);
+      n <- n + id(x + 88) + id(x * 88);
+      n <- n + id(x + 89) + id(x * 89);
+      n <- n + id(x + 90) + id(x * 90);
+      n <- n + id(x + 91) + id(x * 91);
+      n <- n + id(x + 92) + id(x * 92);
+      n <- n + id(x + 93) + id(x * 93);
+      n <- n + id(x + 94) + id(x * 94);
+      n <- n + id(x + 95) + id(x * 95);
+      n <- n + id(x + 96) + id(x * 96);
+      n <- n + id(x + 97) + id(x * 97);
+      n <- n + id(x + 98) + id(x * 98);
+      n <- n + id(x + 99) + id(x * 99);
+      n <- n + id(x + 100) + id(x * 100);
+      n <- n + id(x + 101) + id(x * 101);
+      n <- n + id(x + 102) + id(x * 102);
+      n <- n + id(x + 103) + id(x * 103);
+      n <- n + id(x + 104) + id(x * 104);
+      n <- n + id(x + 105) + id(x * 105);
+      n <- n + id(x + 106) + id(x * 106);
+      n <- n + id(x + 107) + id(x * 107);
+      n <- n + id(x + 108) + id(x * 108);
+      n <- n + id(x + 109) + id(x * 109);
+      n <- n + id(x + 110) + id(x * 110);
+      n <- n + id(x + 111) + id(x * 111);
+      n <- n + id(x + 112) + id(x * 112);
+      n <- n + id(x + 113) + id(x * 113);
+      n <- n + id(x + 114) + id(x * 114);
+      n <- n + id(x + 115) + id(x * 115);
+      n <- n + id(x + 116) + id(x * 116);
+      n <- n + id(x + 117) + id(x * 117);
+      n <- n + id(x + 118) + id(x * 118);
+      n <- n + id(x + 119) + id(x * 119);
+      n <- n + id(x + 120) + id(x * 120);
+      n <- n + id(x + 121) + id(x * 121);
+      n <- n + id(x + 122) + id(x * 122);
+      n <- n + id(x + 123) + id(x * 123);
+      n <- n + id(x + 124) + id(x * 124);
+      n <- n + id(x + 125) + id(x * 125);
+      n <- n + id(x + 126) + id(x * 126);
+      n <- n + id(x + 127) + id(x * 127);
+      n <- n + id(x + 128) + id(x * 128);
+      n <- n + id(x + 129) + id(x * 129);
+      n <- n + id(x + 130) + id(x * 130);
+      n <- n + id(x + 131) + id(x * 131);
+      n <- n + id(x + 132) + id(x * 132);
+      n <- n + id(x + 133) + id(x * 133);
+      n <- n + id(x + 134) + id(x * 134);
+      n <- n + id(x + 135) + id(x * 135);
+      n <- n + id(x + 136) + id(x * 136);
+      n <- n + id(x + 137) + id(x * 137);
+      n <- n + id(x + 138) + id(x * 138);
+      n <- n + id(x + 139) + id(x * 139);
+      n <- n + id(x + 140) + id(x * 140);
+      n <- n + id(x + 141) + id(x * 141);
+      n <- n + id(x + 142) + id(x * 142);
+      n <- n + id(x + 143) + id(x * 143);
+      n <- n + id(x + 144) + id(x * 144);
+      n <- n + id(x + 145) + id(x * 145);
+      n <- n + id(x + 146) + id(x * 146);
+      n <- n + id(x + 147) + id(x * 147);
+      n <- n + id(x + 148) + id(x * 148);
+      n <- n + id(x + 149) + id(x * 149);
+      n <- n + id(x + 150) + id(x * 150);
+      n <- n + id(x + 151) + id(x * 151);
+      n <- n + id(x + 152) + id(x * 152);
+      n <- n + id(x + 153) + id(x * 153);
+      n <- n + id(x + 154) + id(x * 154);
+      n <- n + id(x + 155) + id(x * 155);
+      n <- n + id(x + 156) + id(x * 156);
+      n <- n + id(x + 157) + id(x * 157);
+      n <- n + id(x + 158) + id(x * 158);
+      n <- n + id(x + 159) + id(x * 159);
+      n <- n + id(x + 160) + id(x * 160);
+      n <- n + id(x + 161) + id(x * 161);
+      n <- n + id(x + 162) + id(x * 162);
+      n <- n + id(x + 163) + id(x * 163);
+      n <- n + id(x + 164) + id(x * 164);
+      n <- n + id(x + 165) + id(x * 165);
+      n <- n + id(x + 166) + id(x * 166);
+      n <- n + id(x + 167) + id(x * 167);
+      n <- n + id(x + 168) + id(x * 168);
+      n <- n + id(x + 169) + id(x * 169);
+      n <- n + id(x + 170) + id(x * 170);
+      n <- n + id(x + 171) + id(x * 171);
+      n <- n + id(x + 172) + id(x * 172);
+      n <- n + id(x + 173) + id(x * 173);
+      n <- n + id(x + 174) + id(x * 174);
+      n <- n + id(x + 175) + id(x * 175);
+      n <- n + id(x + 176) + id(x * 176);
+      n <- n + id(x + 177) + id(x * 177);
+      n <- n + id(x + 178) + id(x * 178);
+      n <- n + id(x + 179) + id(x * 179);
+      n <- n + id(x + 180) + id(x * 180);
+      n <- n + id(x + 181) + id(x * 181);
+      n <- n + id(x + 182) + id(x * 182);
+      n <- n + id(x + 183) + id(x * 183);
+      n <- n + id(x + 184) + id(x * 184);
+      n <- n + id(x + 185) + id(x * 185);
+      n <- n + id(x + 186) + id(x * 186);
+      n <- n + id(x + 187) + id(x * 187);
+      n <- n + id(x + 188) + id(x * 188);
+      n <- n + id(x + 189) + id(x * 189);
+      n <- n + id(x + 190) + id(x * 190);
+      n <- n + id(x + 191) + id(x * 191);
+      n <- n + id(x + 192) + id(x * 192);
+      n <- n + id(x + 193) + id(x * 193);
+      n <- n + id(x + 194) + id(x * 194);
+      n <- n + id(x + 195) + id(x * 195);
+      n <- n + id(x + 196) + id(x * 196);
+      n <- n + id(x + 197) + id(x * 197);
+      n <- n + id(x + 198) + id(x * 198);
+      n <- n + id(x + 199) + id(x * 199);
+      n <- n + id(x + 200) + id(x * 200);
+      n <- n + id(x + 201) + id(x * 201);
+      n <- n + id(x + 202) + id(x * 202);
+      n <- n + id(x + 203) + id(x * 203);
+      n <- n + id(x + 204) + id(x * 204);
+      n <- n + id(x + 205) + id(x * 205);
+      n <- n + id(x + 206) + id(x * 206);
+      n <- n + id(x + 207) + id(x * 207);
+      n <- n + id(x + 208) + id(x * 208);
+      n <- n + id(x + 209) + id(x * 209);
+      n <- n + id(x + 210) + id(x * 210);
+      n <- n + id(x + 211) + id(x * 211);
+      n <- n + id(x + 212) + id(x * 212);
+      n <- n + id(x + 213) + id(x * 213);
+      n <- n + id(x + 214) + id(x * 214);
+      n <- n + id(x + 215) + id(x * 215);
+      n <- n + id(x + 216) + id(x * 216);
+      n <- n + id(x + 217) + id(x * 217);
+      n <- n + id(x + 218) + id(x * 218);
+      n <- n + id(x + 219) + id(x * 219);
+      n <- n + id(x + 220) + id(x * 220);
+      n <- n + id(x + 221) + id(x * 221);
+      n <- n + id(x + 222) + id(x * 222);
+      n <- n + id(x + 223) + id(x * 223);
+      n <- n + id(x + 224) + id(x * 224);
+      n <- n + id(x + 225) + id(x * 225);
+      n <- n + id(x + 226) + id(x * 226);
+      n <- n + id(x + 227) + id(x * 227);
+      n <- n + id(x + 228) + id(x * 228);
+      n <- n + id(x + 229) + id(x * 229);
+      n <- n + id(x + 230) + id(x * 230);
+      n <- n + id(x + 231) + id(x * 231);
+      n <- n + id(x + 232) + id(x * 232);
+      n <- n + id(x + 233) + id(x * 233);
+      n <- n + id(x + 234) + id(x * 234);
+      n <- n + id(x + 235) + id(x * 235);
+      n <- n + id(x + 236) + id(x * 236);
+      n <- n + id(x + 237) + id(x * 237);
+      n <- n + id(x + 238) + id(x * 238);
+      n <- n + id(x + 239) + id(x * 239);
+      n <- n + id(x + 240) + id(x * 240);
+      n <- n + id(x + 241) + id(x * 241);
+      n <- n + id(x + 242) + id(x * 242);
+      n <- n + id(x + 243) + id(x * 243);
+      n <- n + id(x + 244) + id(x * 244);
+      n <- n + id(x + 245) + id(x * 245);
+      n <- n + id(x + 246) + id(x * 246);
+      n <- n + id(x + 247) + id(x * 247);
+      n <- n + id(x + 248) + id(x * 248);
+      n <- n + id(x + 249) + id(x * 249);
+      n <- n + id(x + 250) + id(x * 250);
+      n <- n + id(x + 251) + id(x * 251);
+      n <- n + id(x + 252) + id(x * 252);
+      n <- n + id(x + 253) + id(x * 253);
+      n <- n + id(x + 254) + id(x * 254);
+      n <- n + id(x + 255) + id(x * 255);
+      n <- n + id(x + 256) + id(x * 256);
+      n <- n + id(x + 257) + id(x * 257);
+      n <- n + id(x + 258) + id(x * 258);
+      n <- n + id(x + 259) + id(x * 259);
+      n <- n + id(x + 260) + id(x * 260);
+      n <- n + id(x + 261) + id(x * 261);
+      n <- n + id(x + 262) + id(x * 262);
+      n <- n + id(x + 263) + id(x * 263);
+      n <- n + id(x + 264) + id(x * 264);
+      n <- n + id(x + 265) + id(x * 265);
+      n <- n + id(x + 266) + id(x * 266);
+      n <- n + id(x + 267) + id(x * 267);
+      n <- n + id(x + 268) + id(x * 268);
+      n <- n + id(x + 269) + id(x * 269);
+      n <- n + id(x + 270) + id(x * 270);
+      n <- n + id(x + 271) + id(x * 271);
+      n <- n + id(x + 272) + id(x * 272);
+      n <- n + id(x + 273) + id(x * 273);
+      n <- n + id(x + 274) + id(x * 274);
+      n <- n + id(x + 275) + id(x * 275);
+      n <- n + id(x + 276) + id(x * 276);
+      n <- n + id(x + 277) + id(x * 277);
+      n <- n + id(x + 278) + id(x * 278);
+      n <- n + id(x + 279) + id(x * 279);
+      n <- n + id(x + 280) + id(x * 280);
+      n <- n + id(x + 281) + id(x * 281);
+      n <- n + id(x + 282) + id(x * 282);
+      n <- n + id(x + 283) + id(x * 283);
+      n <- n + id(x + 284) + id(x * 284);
+      n <- n + id(x + 285) + id(x * 285);
+      n <- n + id(x + 286) + id(x * 286);
+      n <- n + id(x + 287) + id(x * 287);
+      n <- n + id(x + 288) + id(x * 288);
+      n <- n + id(x + 289) + id(x * 289);
+      n <- n + id(x + 290) + id(x * 290);
+      n <- n + id(x + 291) + id(x * 291);
+      n <- n + id(x + 292) + id(x * 292);
+      n <- n + id(x + 293) + id(x * 293);
+      n <- n + id(x + 294) + id(x * 294);
+      n <- n + id(x + 295) + id(x * 295);
+      n <- n + id(x + 296) + id(x * 296);
+      n <- n + id(x + 297) + id(x * 297);
+      n <- n + id(x + 298) + id(x * 298);
+      n <- n + id(x + 299) + id(x * 299);
+      n <- n + id(x + 300) + id(x * 300);
+      n <- n + id(x + 301) + id(x * 301);
+      n <- n + id(x + 302) + id(x * 302);
+      n <- n + id(x + 303) + id(x * 303);
+      n <- n + id(x + 304) + id(x * 304);
+      n <- n + id(x + 305) + id(x * 305);
+      n <- n + id(x + 306) + id(x * 306);
+      n <- n + id(x + 307) + id(x * 307);
+      n <- n + id(x + 308) + id(x * 308);
+      n <- n + id(x + 309) + id(x * 309);
+      n <- n + id(x + 310) + id(x * 310);
+      n <- n + id(x + 311) + id(x * 311);
+      n <- n + id(x + 312) + id(x * 312);
+      n <- n + id(x + 313) + id(x * 313);
+      n <- n + id(x + 314) + id(x * 314);
+      n <- n + id(x + 315) + id(x * 315);
+      n <- n + id(x + 316) + id(x * 316);
+      n <- n + id(x + 317) + id(x * 317);
+      n <- n + id(x + 318) + id(x * 318);
+      n <- n + id(x + 319) + id(x * 319);
+      n <- n + id(x + 320) + id(x * 320);
+      n <- n + id(x + 321) + id(x * 321);
+      n <- n + id(x + 322) + id(x * 322);
+      n <- n + id(x + 323) + id(x * 323);
+      n <- n + id(x + 324) + id(x * 324);
+      n <- n + id(x + 325) + id(x * 325);
+      n <- n + id(x + 326) + id(x * 326);
+      n <- n + id(x + 327) + id(x * 327);
+      n <- n + id(x + 328) + id(x * 328);
+      n <- n + id(x + 329) + id(x * 329);
+      n <- n + id(x + 330) + id(x * 330);
+      n <- n + id(x + 331) + id(x * 331);
+      n <- n + id(x + 332) + id(x * 332);
+      n <- n + id(x + 333) + id(x * 333);
+      n <- n + id(x + 334) + id(x * 334);
+      n <- n + id(x + 335) + id(x * 335);
+      n <- n + id(x + 336) + id(x * 336);
+      n <- n + id(x + 337) + id(x * 337);
+      n <- n + id(x + 338) + id(x * 338);
+      n <- n + id(x + 339) + id(x * 339);
+      n <- n + id(x + 340) + id(x * 340);
+      n <- n + id(x + 341) + id(x * 341);
+      n <- n + id(x + 342) + id(x * 342);
+      n <- n + id(x + 343) + id(x * 343);
+      n <- n + id(x + 344) + id(x * 344);
+      n <- n + id(x + 345) + id(x * 345);
+      n <- n + id(x + 346) + id(x * 346);
+      n <- n + id(x + 347) + id(x * 347);
+      n <- n + id(x + 348) + id(x * 348);
+      n <- n + id(x + 349) + id(x * 349);
+      n <- n + id(x + 350) + id(x * 350);
+      n <- n + id(x + 351) + id(x * 351);
+      n <- n + id(x + 352) + id(x * 352);
+      n <- n + id(x + 353) + id(x * 353);
+      n <- n + id(x + 354) + id(x * 354);
+      n <- n + id(x + 355) + id(x * 355);
+      n <- n + id(x + 356) + id(x * 356);
+      n <- n + id(x + 357) + id(x * 357);
+      n <- n + id(x + 358) + id(x * 358);
+      n <- n + id(x + 359) + id(x * 359);
+      n <- n + id(x + 360) + id(x * 360);
+      n <- n + id(x + 361) + id(x * 361);
+      n <- n + id(x + 362) + id(x * 362);
+      n <- n + id(x + 363) + id(x * 363);
+      n <- n + id(x + 364) + id(x * 364);
+      n <- n + id(x + 365) + id(x * 365);
+      n <- n + id(x + 366) + id(x * 366);
+      n <- n + id(x + 367) + id(x * 367);
+      n <- n + id(x + 368) + id(x * 368);
+      n <- n + id(x + 369) + id(x * 369);
+      n <- n + id(x + 370) + id(x * 370);
+      n <- n + id(x + 371) + id(x * 371);
+      n <- n + id(x + 372) + id(x * 372);
+      n <- n + id(x + 373) + id(x * 373);
+      n <- n + id(x + 374) + id(x * 374);
+      n <- n + id(x + 375) + id(x * 375);
+      n <- n + id(x + 376) + id(x * 376);
+      n <- n + id(x + 377) + id(x * 377);
+      n <- n + id(x + 378) + id(x * 378);
+      n <- n + id(x + 379) + id(x * 379);
+      n <- n + id(x + 380) + id(x * 380);
+      n <- n + id(x + 381) + id(x * 381);
+      n <- n + id(x + 382) + id(x * 382);
+      n <- n + id(x + 383) + id(x * 383);
+      n <- n + id(x + 384) + id(x * 384);
+      n <- n + id(x + 385) + id(x * 385);
+      n <- n + id(x + 386) + id(x * 386);
+      n <- n + id(x + 387) + id(x * 387);
+      n <- n + id(x + 388) + id(x * 388);
+      n <- n + id(x + 389) + id(x * 389);
+      n <- n + id(x + 390) + id(x * 390);
+      n <- n + id(x + 391) + id(x * 391);
+      n <- n + id(x + 392) + id(x * 392);
+      n <- n + id(x + 393) + id(x * 393);
+      n <- n + id(x + 394) + id(x * 394);
+      n <- n + id(x + 395) + id(x * 395);
+      n <- n + id(x + 396) + id(x * 396);
+      n <- n + id(x + 397) + id(x * 397);
+      n <- n + id(x + 398) + id(x * 398);
+      n <- n + id(x + 399) + id(x * 399);
+      n <- n + id(x + 400) + id(x * 400);
+      n <- n + id(x + 401) + id(x * 401);
+      n <- n + id(x + 402) + id(x * 402);
+      n <- n + id(x + 403) + id(x * 403);
+      n <- n + id(x + 404) + id(x * 404);
+      n <- n + id(x + 405) + id(x * 405);
+      n <- n + id(x + 406) + id(x * 406);
+      n <- n + id(x + 407) + id(x * 407);
+      n <- n + id(x + 408) + id(x * 408);
+      n <- n + id(x + 409) + id(x * 409);
+      n <- n + id(x + 410) + id(x * 410);
+      n <- n + id(x + 411) + id(x * 411);
+      n <- n + id(x + 412) + id(x * 412);
+      n <- n + id(x + 413) + id(x * 413);
+      n <- n + id(x + 414) + id(x * 414);
+      n <- n + id(x + 415) + id(x * 415);
+      n <- n + id(x + 416) + id(x * 416);
+      n <- n + id(x + 417) + id(x * 417);
+      n <- n + id(x + 418) + id(x * 418);
+      n <- n + id(x + 419) + id(x * 419);
+      n <- n + id(x + 420) + id(x * 420);
+      n <- n + id(x + 421) + id(x * 421);
+      n <- n + id(x + 422) + id(x * 422);
+      n <- n + id(x + 423) + id(x * 423);
+      n <- n + id(x + 424) + id(x * 424);
+      n <- n + id(x + 425) + id(x * 425);
+      n <- n + id(x + 426) + id(x * 426);
+      n <- n + id(x + 427) + id(x * 427);
+      n <- n + id(x + 428) + id(x * 428);
+      n <- n + id(x + 429) + id(x * 429);
+      n <- n + id(x + 430) + id(x * 430);
+      n <- n + id(x + 431) + id(x * 431);
+      n <- n + id(x + 432) + id(x * 432);
+      n <- n + id(x + 433) + id(x * 433);
+      n <- n + id(x + 434) + id(x * 434);
+      n <- n + id(x + 435) + id(x * 435);
+      n <- n + id(x + 436) + id(x * 436);
+      n <- n + id(x + 437) + id(x * 437);
+      n <- n + id(x + 438) + id(x * 438);
+      n <- n + id(x + 439) + id(x * 439);
+      n <- n + id(x + 440) + id(x * 440);
+      n <- n + id(x + 441) + id(x * 441);
+      n <- n + id(x + 442) + id(x * 442);
+      n <- n + id(x + 443) + id(x * 443);
+      n <- n + id(x + 444) + id(x * 444);
+      n <- n + id(x + 445) + id(x * 445);
+      n <- n + id(x + 446) + id(x * 446);
+      n <- n + id(x + 447) + id(x * 447);
+      n <- n + id(x + 448) + id(x * 448);
+      n <- n + id(x + 449) + id(x * 449);
+      n <- n + id(x + 450) + id(x * 450);
+      n <- n + id(x + 451) + id(x * 451);
+      n <- n + id(x + 452) + id(x * 452);
+      n <- n + id(x + 453) + id(x * 453);
+      n <- n + id(x + 454) + id(x * 454);
+      n <- n + id(x + 455) + id(x * 455);
+      n <- n + id(x + 456) + id(x * 456);
+      n <- n + id(x + 457) + id(x * 457);
+      n <- n + id(x + 458) + id(x * 458);
+      n <- n + id(x + 459) + id(x * 459);
+      n <- n + id(x + 460) + id(x * 460);
+      n <- n + id(x + 461) + id(x * 461);
+      n <- n + id(x + 462) + id(x * 462);
+      n <- n + id(x + 463) + id(x * 463);
+      n <- n + id(x + 464) + id(x * 464);
+      n <- n + id(x + 465) + id(x * 465);
+      n <- n + id(x + 466) + id(x * 466);
+      n <- n + id(x + 467) + id(x * 467);
+      n <- n + id(x + 468) + id(x * 468);
+      n <- n + id(x + 469) + id(x * 469);
+      n <- n + id(x + 470) + id(x * 470);
+      n <- n + id(x + 471) + id(x * 471);
+      n <- n + id(x + 472) + id(x * 472);
+      n <- n + id(x + 473) + id(x * 473);
+      n <- n + id(x + 474) + id(x * 474);
+      n <- n + id(x + 475) + id(x * 475);
+      n <- n + id(x + 476) + id(x * 476);
+      n <- n + id(x + 477) + id(x * 477);
+      n <- n + id(x + 478) + id(x * 478);
+      n <- n + id(x + 479) + id(x * 479);
+      n <- n + id(x + 480) + id(x * 480);
+      n <- n + id(x + 481) + id(x * 481);
+      n <- n + id(x + 482) + id(x * 482);
+      n <- n + id(x + 483) + id(x * 483);
+      n <- n + id(x + 484) + id(x * 484);
+      n <- n + id(x + 485) + id(x * 485);
+      n <- n + id(x + 486) + id(x * 486);
+      n <- n + id(x + 487) + id(x * 487);
+      n <- n + id(x + 488) + id(x * 488);
+      n <- n + id(x + 489) + id(x * 489);
+      n <- n + id(x + 490) + id(x * 490);
+      n <- n + id(x + 491) + id(x * 491);
+      n <- n + id(x + 492) + id(x * 492);
+      n <- n + id(x + 493) + id(x * 493);
+      n <- n + id(x + 494) + id(x * 494);
+      n <- n + id(x + 495) + id(x * 495);
+      n <- n + id(x + 496) + id(x * 496);
+      n <- n + id(x + 497) + id(x * 497);
+      n <- n + id(x + 498) + id(x * 498);
+      n <- n + id(x + 499) + id(x * 499);
+      n <- n + id(x + 500) + id(x * 500);
+      n <- n + id(x + 501) + id(x * 501);
+      n <- n + id(x + 502) + id(x * 502);
+      n <- n + id(x + 503) + id(x * 503);
+      n <- n + id(x + 504) + id(x * 504);
+      n <- n + id(x + 505) + id(x * 505);
+      n <- n + id(x + 506) + id(x * 506);
+      n <- n + id(x + 507) + id(x * 507);
+      n <- n + id(x + 508) + id(x * 508);
+      n <- n + id(x + 509) + id(x * 509);
+      n <- n + id(x + 510) + id(x * 510);
+      n <- n + id(x + 511) + id(x * 511);
+      n <- n + id(x + 512) + id(x * 512);
+      n <- n + id(x + 513) + id(x * 513);
+      n <- n + id(x + 514) + id(x * 514);
+      n <- n + id(x + 515) + id(x * 515);
+      n <- n + id(x + 516) + id(x * 516);
+      n <- n + id(x + 517) + id(x * 517);
+      n <- n + id(x + 518) + id(x * 518);
+      n <- n + id(x + 519) + id(x * 519);
+      n <- n + id(x + 520) + id(x * 520);
+      n <- n + id(x + 521) + id(x * 521);
+      n <- n + id(x + 522) + id(x * 522);
+      n <- n + id(x + 523) + id(x * 523);
+      n <- n + id(x + 524) + id(x * 524);
+      n <- n + id(x + 525) + id(x * 525);
+      n <- n + id(x + 526) + id(x * 526);
+      n <- n + id(x + 527) + id(x * 527);
+      n <- n + id(x + 528) + id(x * 528);
+      n <- n + id(x + 529) + id(x * 529);
+      n <- n + id(x + 530) + id(x * 530);
+      n <- n + id(x + 531) + id(x * 531);
+      n <- n + id(x + 532) + id(x * 532);
+      n <- n + id(x + 533) + id(x * 533);
+      n <- n + id(x + 534) + id(x * 534);
+      n <- n + id(x + 535) + id(x * 535);
+      n <- n + id(x + 536) + id(x * 536);
+      n <- n + id(x + 537) + id(x * 537);
+      n <- n + id(x + 538) + id(x * 538);
+      n <- n + id(x + 539) + id(x * 539);
+      n <- n + id(x + 540) + id(x * 540);
+      n <- n + id(x + 541) + id(x * 541);
+      n <- n + id(x + 542) + id(x * 542);
+      n <- n + id(x + 543) + id(x * 543);
+      n <- n + id(x + 544) + id(x * 544);
+      n <- n + id(x + 545) + id(x * 545);
+      n <- n + id(x + 546) + id(x * 546);
+      n <- n + id(x + 547) + id(x * 547);
+      n <- n + id(x + 548) + id(x * 548);
+      n <- n + id(x + 549) + id(x * 549);
+      n <- n + id(x + 550) + id(x * 550);
+      n <- n + id(x + 551) + id(x * 551);
+      n <- n + id(x + 552) + id(x * 552);
+      n <- n + id(x + 553) + id(x * 553);
+      n <- n + id(x + 554) + id(x * 554);
+      n <- n + id(x + 555) + id(x * 555);
+      n <- n + id(x + 556) + id(x * 556);
+      n <- n + id(x + 557) + id(x * 557);
+      n <- n + id(x + 558) + id(x * 558);
+      n <- n + id(x + 559) + id(x * 559);
+      n <- n + id(x + 560) + id(x * 560);
+      n <- n + id(x + 561) + id(x * 561);
+      n <- n + id(x + 562) + id(x * 562);
+      n <- n + id(x + 563) + id(x * 563);
+      n <- n + id(x + 564) + id(x * 564);
+      n <- n + id(x + 565) + id(x * 565);
+      n <- n + id(x + 566) + id(x * 566);
+      n <- n + id(x + 567) + id(x * 567);
+      n <- n + id(x + 568) + id(x * 568);
+      n <- n + id(x + 569) + id(x * 569);
+      n <- n + id(x + 570) + id(x * 570);
+      n <- n + id(x + 571) + id(x * 571);
+      n <- n + id(x + 572) + id(x * 572);
+      n <- n + id(x + 573) + id(x * 573);
+      n <- n + id(x + 574) + id(x * 574);
+      n <- n + id(x + 575) + id(x * 575);
+      n <- n + id(x + 576) + id(x * 576);
+      n <- n + id(x + 577) + id(x * 577);
+      n <- n + id(x + 578) + id(x * 578);
+      n <- n + id(x + 579) + id(x * 579);
+      n <- n + id(x + 580) + id(x * 580);
+      n <- n + id(x + 581) + id(x * 581);
+      n <- n + id(x + 582) + id(x * 582);
+      n <- n + id(x + 583) + id(x * 583);
+      n <- n + id(x + 584) + id(x * 584);
+      n <- n + id(x + 585) + id(x * 585);
+      n <- n + id(x + 586) + id(x * 586);
+      n <- n + id(x + 587) + id(x * 587);
+      n <- n + id(x + 588) + id(x * 588);
+      n <- n + id(x + 589) + id(x * 589);
+      n <- n + id(x + 590) + id(x * 590);
+      n <- n + id(x + 591) + id(x * 591);
+      n <- n + id(x + 592) + id(x * 592);
+      n <- n + id(x + 593) + id(x * 593);
+      n <- n + id(x + 594) + id(x * 594);
+      n <- n + id(x + 595) + id(x * 595);
+      n <- n + id(x + 596) + id(x * 596);
+      n <- n + id(x + 597) + id(x * 597);
+      n <- n + id(x + 598) + id(x * 598);
+      n <- n + id(x + 599) + id(x * 599);
+      n <- n + id(x + 600) + id(x * 600);
+      n <- n + id(x + 601) + id(x * 601);
+      n <- n + id(x + 602) + id(x * 602);
+      n <- n + id(x + 603) + id(x * 603);
+      n <- n + id(x + 604) + id(x * 604);
+      n <- n + id(x + 605) + id(x * 605);
+      n <- n + id(x + 606) + id(x * 606);
+      n <- n + id(x + 607) + id(x * 607);
+      n <- n + id(x + 608) + id(x * 608);
+      n <- n + id(x + 609) + id(x * 609);
+      n <- n + id(x + 610) + id(x * 610);
+      n <- n + id(x + 611) + id(x * 611);
+      n <- n + id(x + 612) + id(x * 612);
+      n <- n + id(x + 613) + id(x * 613);
+      n <- n + id(x + 614) + id(x * 614);
+      n <- n + id(x + 615) + id(x * 615);
+      n <- n + id(x + 616) + id(x * 616);
+      n <- n + id(x + 617) + id(x * 617);
+      n <- n + id(x + 618) + id(x * 618);
+      n <- n + id(x + 619) + id(x * 619);
+      n <- n + id(x + 620) + id(x * 620);
+      n <- n + id(x + 621) + id(x * 621);
+      n <- n + id(x + 622) + id(x * 622);
+      n <- n + id(x + 623) + id(x * 623);
+      n <- n + id(x + 624) + id(x * 624);
+      n <- n + id(x + 625) + id(x * 625);
+      n <- n + id(x + 626) + id(x * 626);
+      n <- n + id(x + 627) + id(x * 627);
+      n <- n + id(x + 628) + id(x * 628);
+      n <- n + id(x + 629) + id(x * 629);
+      n <- n + id(x + 630) + id(x * 630);
+      n <- n + id(x + 631) + id(x * 631);
+      n <- n + id(x + 632) + id(x * 632);
+      n <- n + id(x + 633) + id(x * 633);
+      n <- n + id(x + 634) + id(x * 634);
+      n <- n + id(x + 635) + id(x * 635);
+      n <- n + id(x + 636) + id(x * 636);
+      n <- n + id(x + 637) + id(x * 637);
+      n <- n + id(x + 638) + id(x * 638);
+      n <- n + id(x + 639) + id(x * 639);
+      n <- n + id(x + 640) + id(x * 640);
+      n <- n + id(x + 641) + id(x * 641);
+      n <- n + id(x + 642) + id(x * 642);
+      n <- n + id(x + 643) + id(x * 643);
+      n <- n + id(x + 644) + id(x * 644);
+      n <- n + id(x + 645) + id(x * 645);
+      n <- n + id(x + 646) + id(x * 646);
+      n <- n + id(x + 647) + id(x * 647);
+      n <- n + id(x + 648) + id(x * 648);
+      n <- n + id(x + 649) + id(x * 649);
+      n <- n + id(x + 650) + id(x * 650);
+      n <- n + id(x + 651) + id(x * 651);
+      n <- n + id(x + 652) + id(x * 652);
+      n <- n + id(x + 653) + id(x * 653);
+      n <- n + id(x + 654) + id(x * 654);
+      n <- n + id(x + 655) + id(x * 655);
+      n <- n + id(x + 656) + id(x * 656);
+      n <- n + id(x + 657) + id(x * 657);
+      n <- n + id(x + 658) + id(x * 658);
+      n <- n + id(x + 659) + id(x * 659);
+      n <- n + id(x + 660) + id(x * 660);
+      n <- n + id(x + 661) + id(x * 661);
+      n <- n + id(x + 662) + id(x * 662);
+      n <- n + id(x + 663) + id(x * 663);
+      n <- n + id(x + 664) + id(x * 664);
+      n <- n + id(x + 665) + id(x * 665);
+      n <- n + id(x + 666) + id(x * 666);
+      n <- n + id(x + 667) + id(x * 667);
+      n <- n + id(x + 668) + id(x * 668);
+      n <- n + id(x + 669) + id(x * 669);
+      n <- n + id(x + 670) + id(x * 670);
+      n <- n + id(x + 671) + id(x * 671);
+      n <- n + id(x + 672) + id(x * 672);
+      n <- n + id(x + 673) + id(x * 673);
+      n <- n + id(x + 674) + id(x * 674);
+      n <- n + id(x + 675) + id(x * 675);
+      n <- n + id(x + 676) + id(x * 676);
+      n <- n + id(x + 677) + id(x * 677);
+      n <- n + id(x + 678) + id(x * 678);
+      n <- n + id(x + 679) + id(x * 679);
+      n <- n + id(x + 680) + id(x * 680);
+      n <- n + id(x + 681) + id(x * 681);
+      n <- n + id(x + 682) + id(x * 682);
+      n <- n + id(x + 683) + id(x * 683);
+      n <- n + id(x + 684) + id(x * 684);
+      n <- n + id(x + 685) + id(x * 685);
+      n <- n + id(x + 686) + id(x * 686);
+      n <- n + id(x + 687) + id(x * 687);
+      n <- n + id(x + 688) + id(x * 688);
+      n <- n + id(x + 689) + id(x * 689);
+      n <- n + id(x + 690) + id(x * 690);
+      n <- n + id(x + 691) + id(x * 691);
+      n <- n + id(x + 692) + id(x * 692);
+      n <- n + id(x + 693) + id(x * 693);
+      n <- n + id(x + 694) + id(x * 694);
+      n <- n + id(x + 695) + id(x * 695);
+      n <- n + id(x + 696) + id(x * 696);
+      n <- n + id(x + 697) + id(x * 697);
+      n <- n + id(x + 698) + id(x * 698);
+      n <- n + id(x + 699) + id(x * 699);
+      n <- n + id(x + 700) + id(x * 700);
+      n <- n + id(x + 701) + id(x * 701);
+      n <- n + id(x + 702) + id(x * 702);
+      n <- n + id(x + 703) + id(x * 703);
+      n <- n + id(x + 704) + id(x * 704);
+      n <- n + id(x + 705) + id(x * 705);
+      n <- n + id(x + 706) + id(x * 706);
+      n <- n + id(x + 707) + id(x * 707);
+      n <- n + id(x + 708) + id(x * 708);
+      n <- n + id(x + 709) + id(x * 709);
+      n <- n + id(x + 710) + id(x * 710);
+      n <- n + id(x + 711) + id(x * 711);
+      n <- n + id(x + 712) + id(x * 712);
+      n <- n + id(x + 713) + id(x * 713);
+      n <- n + id(x + 714) + id(x * 714);
+      n <- n + id(x + 715) + id(x * 715);
+      n <- n + id(x + 716) + id(x * 716);
+      n <- n + id(x + 717) + id(x * 717);
+      n <- n + id(x + 718) + id(x * 718);
+      n <- n + id(x + 719) + id(x * 719);
+      n <- n + id(x + 720) + id(x * 720);
+      n <- n + id(x + 721) + id(x * 721);
+      n <- n + id(x + 722) + id(x * 722);
+      n <- n + id(x + 723) + id(x * 723);
+      n <- n + id(x + 724) + id(x * 724);
+      n <- n + id(x + 725) + id(x * 725);
+      n <- n + id(x + 726) + id(x * 726);
+      n <- n + id(x + 727) + id(x * 727);
+      n <- n + id(x + 728) + id(x * 728);
+      n <- n + id(x + 729) + id(x * 729);
+      n <- n + id(x + 730) + id(x * 730);
+      n <- n + id(x + 731) + id(x * 731);
+      n <- n + id(x + 732) + id(x * 732);
+      n <- n + id(x + 733) + id(x * 733);
+      n <- n + id(x + 734) + id(x * 734);
+      n <- n + id(x + 735) + id(x * 735);
+      n <- n + id(x + 736) + id(x * 736);
+      n <- n + id(x + 737) + id(x * 737);
+      n <- n + id(x + 738) + id(x * 738);
+      n <- n + id(x + 739) + id(x * 739);
+      n <- n + id(x + 740) + id(x * 740);
+      n <- n + id(x + 741) + id(x * 741);
+      n <- n + id(x + 742) + id(x * 742);
+      n <- n + id(x + 743) + id(x * 743);
+      n <- n + id(x + 744) + id(x * 744);
+      n <- n + id(x + 745) + id(x * 745);
+      n <- n + id(x + 746) + id(x * 746);
+      n <- n + id(x + 747) + id(x * 747);
+      n <- n + id(x + 748) + id(x * 748);
+      n <- n + id(x + 749) + id(x * 749);
+      n <- n + id(x + 750) + id(x * 750);
+      n <- n + id(x + 751) + id(x * 751);
+      n <- n + id(x + 752) + id(x * 752);
+      n <- n + id(x + 753) + id(x * 753);
+      n <- n + id(x + 754) + id(x * 754);
+      n <- n + id(x + 755) + id(x * 755);
+      n <- n + id(x + 756) + id(x * 756);
+      n <- n + id(x + 757) + id(x * 757);
+      n <- n + id(x + 758) + id(x * 758);
+      n <- n + id(x + 759) + id(x * 759);
+      n <- n + id(x + 760) + id(x * 760);
+      n <- n + id(x + 761) + id(x * 761);
+      n <- n + id(x + 762) + id(x * 762);
+      n <- n + id(x + 763) + id(x * 763);
+      n <- n + id(x + 764) + id(x * 764);
+      n <- n + id(x + 765) + id(x * 765);
+      n <- n + id(x + 766) + id(x * 766);
+      n <- n + id(x + 767) + id(x * 767);
+      n <- n + id(x + 768) + id(x * 768);
+      n <- n + id(x + 769) + id(x * 769);
+      n <- n + id(x + 770) + id(x * 770);
+      n <- n + id(x + 771) + id(x * 771);
+      n <- n + id(x + 772) + id(x * 772);
+      n <- n + id(x + 773) + id(x * 773);
+      n <- n + id(x + 774) + id(x * 774);
+      n <- n + id(x + 775) + id(x * 775);
+      n <- n + id(x + 776) + id(x * 776);
+      n <- n + id(x + 777) + id(x * 777);
+      n <- n + id(x + 778) + id(x * 778);
+      n <- n + id(x + 779) + id(x * 779);
+      n <- n + id(x + 780) + id(x * 780);
+      n <- n + id(x + 781) + id(x * 781);
+      n <- n + id(x + 782) + id(x * 782);
+      n <- n + id(x + 783) + id(x * 783);
+      n <- n + id(x + 784) + id(x * 784);
+      n <- n + id(x + 785) + id(x * 785);
+      n <- n + id(x + 786) + id(x * 786);
+      n <- n + id(x + 787) + id(x * 787);
+      n <- n + id(x + 788) + id(x * 788);
+      n <- n + id(x + 789) + id(x * 789);
+      n <- n + id(x + 790) + id(x * 790);
+      n <- n + id(x + 791) + id(x * 791);
+      n <- n + id(x + 792) + id(x * 792);
+      n <- n + id(x + 793) + id(x * 793);
+      n <- n + id(x + 794) + id(x * 794);
+      n <- n + id(x + 795) + id(x * 795);
+      n <- n + id(x + 796) + id(x * 796);
+      n <- n + id(x + 797) + id(x * 797);
+      n <- n + id(x + 798) + id(x * 798);
+      n <- n + id(x + 799) + id(x * 799);
+      n <- n + id(x + 800) + id(x * 800);
+      n <- n + id(x + 801) + id(x * 801);
+      n <- n + id(x + 802) + id(x * 802);
+      n <- n + id(x + 803) + id(x * 803);
+      n <- n + id(x + 804) + id(x * 804);
+      n <- n + id(x + 805) + id(x * 805);
+      n <- n + id(x + 806) + id(x * 806);
+      n <- n + id(x + 807) + id(x * 807);
+      n <- n + id(x + 808) + id(x * 808);
+      n <- n + id(x + 809) + id(x * 809);
+      n <- n + id(x + 810) + id(x * 810);
+      n <- n + id(x + 811) + id(x * 811);
+      n <- n + id(x + 812) + id(x * 812);
+      n <- n + id(x + 813) + id(x * 813);
+      n <- n + id(x + 814) + id(x * 814);
+      n <- n + id(x + 815) + id(x * 815);
+      n <- n + id(x + 816) + id(x * 816);
+      n <- n + id(x + 817) + id(x * 817);
+      n <- n + id(x + 818) + id(x * 818);
+      n <- n + id(x + 819) + id(x * 819);
+      n <- n + id(x + 820) + id(x * 820);
+      n <- n + id(x + 821) + id(x * 821);
+      n <- n + id(x + 822) + id(x * 822);
+      n <- n + id(x + 823) + id(x * 823);
+      n <- n + id(x + 824) + id(x * 824);
+      n <- n + id(x + 825) + id(x * 825);
+      n <- n + id(x + 826) + id(x * 826);
+      n <- n + id(x + 827) + id(x * 827);
+      n <- n + id(x + 828) + id(x * 828);
+      n <- n + id(x + 829) + id(x * 829);
+      n <- n + id(x + 830) + id(x * 830);
+      n <- n + id(x + 831) + id(x * 831);
+      n <- n + id(x + 832) + id(x * 832);
+      n <- n + id(x + 833) + id(x * 833);
+      n <- n + id(x + 834) + id(x * 834);
+      n <- n + id(x + 835) + id(x * 835);
+      n <- n + id(x + 836) + id(x * 836);
+      n <- n + id(x + 837) + id(x * 837);
+      n <- n + id(x + 838) + id(x * 838);
+      n <- n + id(x + 839) + id(x * 839);
+      n <- n + id(x + 840) + id(x * 840);
+      n <- n + id(x + 841) + id(x * 841);
+      n <- n + id(x + 842) + id(x * 842);
+      n <- n + id(x + 843) + id(x * 843);
+      n <- n + id(x + 844) + id(x * 844);
+      n <- n + id(x + 845) + id(x * 845);
+      n <- n + id(x + 846) + id(x * 846);
+      n <- n + id(x + 847) + id(x * 847);
+      n <- n + id(x + 848) + id(x * 848);
+      n <- n + id(x + 849) + id(x * 849);
+      n <- n + id(x + 850) + id(x * 850);
+      n <- n + id(x + 851) + id(x * 851);
+      n <- n + id(x + 852) + id(x * 852);
+      n <- n + id(x + 853) + id(x * 853);
+      n <- n + id(x + 854) + id(x * 854);
+      n <- n + id(x + 855) + id(x * 855);
+      n <- n + id(x + 856) + id(x * 856);
+      n <- n + id(x + 857) + id(x * 857);
+      n <- n + id(x + 858) + id(x * 858);
+      n <- n + id(x + 859) + id(x * 859);
+      n <- n + id(x + 860) + id(x * 860);
+      n <- n + id(x + 861) + id(x * 861);
+      n <- n + id(x + 862) + id(x * 862);
+      n <- n + id(x + 863) + id(x * 863);
+      n <- n + id(x + 864) + id(x * 864);
+      n <- n + id(x + 865) + id(x * 865);
+      n <- n + id(x + 866) + id(x * 866);
+      n <- n + id(x + 867) + id(x * 867);
+      n <- n + id(x + 868) + id(x * 868);
+      n <- n + id(x + 869) + id(x * 869);
+      n <- n + id(x + 870) + id(x * 870);
+      n <- n + id(x + 871) + id(x * 871);
+      n <- n + id(x + 872) + id(x * 872);
+      n <- n + id(x + 873) + id(x * 873);
+      n <- n + id(x + 874) + id(x * 874);
+      n <- n + id(x + 875) + id(x * 875);
+      n <- n + id(x + 876) + id(x * 876);
+      n <- n + id(x + 877) + id(x * 877);
+      n <- n + id(x + 878) + id(x * 878);
+      n <- n + id(x + 879) + id(x * 879);
+      n <- n + id(x + 880) + id(x * 880);
+      n <- n + id(x + 881) + id(x * 881);
+      n <- n + id(x + 882) + id(x * 882);
+      n <- n + id(x + 883) + id(x * 883);
+      n <- n + id(x + 884) + id(x * 884);
+      n <- n + id(x + 885) + id(x * 885);
+      n <- n + id(x + 886) + id(x * 886);
+      n <- n + id(x + 887) + id(x * 887);
+      n <- n + id(x + 888) + id(x * 888);
+      n <- n + id(x + 889) + id(x * 889);
+      n <- n + id(x + 890) + id(x * 890);
+      n <- n + id(x + 891) + id(x * 891);
+      n <- n + id(x + 892) + id(x * 892);
+      n <- n + id(x + 893) + id(x * 893);
+      n <- n + id(x + 894) + id(x * 894);
+      n <- n + id(x + 895) + id(x * 895);
+      n <- n + id(x + 896) + id(x * 896);
+      n <- n + id(x + 897) + id(x * 897);
+      n <- n + id(x + 898) + id(x * 898);
+      n <- n + id(x + 899) + id(x * 899);
+      n <- n + id(x + 900) + id(x * 900);
+      n <- n + id(x + 901) + id(x * 901);
+      n <- n + id(x + 902) + id(x * 902);
+      n <- n + id(x + 903) + id(x * 903);
+      n <- n + id(x + 904) + id(x * 904);
+      n <- n + id(x + 905) + id(x * 905);
+      n <- n + id(x + 906) + id(x * 906);
+      n <- n + id(x + 907) + id(x * 907);
+      n <- n + id(x + 908) + id(x * 908);
+      n <- n + id(x + 909) + id(x * 909);
+      n <- n + id(x + 910) + id(x * 910);
+      n <- n + id(x + 911) + id(x * 911);
+      n <- n + id(x + 912) + id(x * 912);
+      n <- n + id(x + 913) + id(x * 913);
+      n <- n + id(x + 914) + id(x * 914);
+      n <- n + id(x + 915) + id(x * 915);
+      n <- n + id(x + 916) + id(x * 916);
+      n <- n + id(x + 917) + id(x * 917);
+      n <- n + id(x + 918) + id(x * 918);
+      n <- n + id(x + 919) + id(x * 919);
+      n <- n + id(x + 920) + id(x * 920);
+      n <- n + id(x + 921) + id(x * 921);
+      n <- n + id(x + 922) + id(x * 922);
+      n <- n + id(x + 923) + id(x * 923);
+      n <- n + id(x + 924) + id(x * 924);
+      n <- n + id(x + 925) + id(x * 925);
+      n <- n + id(x + 926) + id(x * 926);
+      n <- n + id(x + 927) + id(x * 927);
+      n <- n + id(x + 928) + id(x * 928);
+      n <- n + id(x + 929) + id(x * 929);
+      n <- n + id(x + 930) + id(x * 930);
+      n <- n + id(x + 931) + id(x * 931);
+      n <- n + id(x + 932) + id(x * 932);
+      n <- n + id(x + 933) + id(x * 933);
+      n <- n + id(x + 934) + id(x * 934);
+      n <- n + id(x + 935) + id(x * 935);
+      n <- n + id(x + 936) + id(x * 936);
+      n <- n + id(x + 937) + id(x * 937);
+      n <- n + id(x + 938) + id(x * 938);
+      n <- n + id(x + 939) + id(x * 939);
+      n <- n + id(x + 940) + id(x * 940);
+      n <- n + id(x + 941) + id(x * 941);
+      n <- n + id(x + 942) + id(x * 942);
+      n <- n + id(x + 943) + id(x * 943);
+      n <- n + id(x + 944) + id(x * 944);
+      n <- n + id(x + 945) + id(x * 945);
+      n <- n + id(x + 946) + id(x * 946);
+      n <- n + id(x + 947) + id(x * 947);
+      n <- n + id(x + 948) + id(x * 948);
+      n <- n + id(x + 949) + id(x * 949);
+      n <- n + id(x + 950) + id(x * 950);
+      n <- n + id(x + 951) + id(x * 951);
+      n <- n + id(x + 952) + id(x * 952);
+      n <- n + id(x + 953) + id(x * 953);
+      n <- n + id(x + 954) + id(x * 954);
+      n <- n + id(x + 955) + id(x * 955);
+      n <- n + id(x + 956) + id(x * 956);
+      n <- n + id(x + 957) + id(x * 957);
+      n <- n + id(x + 958) + id(x * 958);
+      n <- n + id(x + 959) + id(x * 959);
+      n <- n + id(x + 960) + id(x * 960);
+      n <- n + id(x + 961) + id(x * 961);
+      n <- n + id(x + 962) + id(x * 962);
+      n <- n + id(x + 963) + id(x * 963);
+      n <- n + id(x + 964) + id(x * 964);
+      n <- n + id(x + 965) + id(x * 965);
+      n <- n + id(x + 966) + id(x * 966);
+      n <- n + id(x + 967) + id(x * 967);
+      n <- n + id(x + 968) + id(x * 968);
+      n <- n + id(x + 969) + id(x * 969);
+      n <- n + id(x + 970) + id(x * 970);
+      n <- n + id(x + 971) + id(x * 971);
+      n <- n + id(x + 972) + id(x * 972);
+      n <- n + id(x + 973) + id(x * 973);
+      n <- n + id(x + 974) + id(x * 974);
+      n <- n + id(x + 975) + id(x * 975);
+      n <- n + id(x + 976) + id(x * 976);
+      n <- n + id(x + 977) + id(x * 977);
+      n <- n + id(x + 978) + id(x * 978);
+      n <- n + id(x + 979) + id(x * 979);
+      n <- n + id(x + 980) + id(x * 980);
+      n <- n + id(x + 981) + id(x * 981);
+      n <- n + id(x + 982) + id(x * 982);
+      n <- n + id(x + 983) + id(x * 983);
+      n <- n + id(x + 984) + id(x * 984);
+      n <- n + id(x + 985) + id(x * 985);
+      n <- n + id(x + 986) + id(x * 986);
+      n <- n + id(x + 987) + id(x * 987);
+      n <- n + id(x + 988) + id(x * 988);
+      n <- n + id(x + 989) + id(x * 989);
+      n <- n + id(x + 990) + id(x * 990);
+      n <- n + id(x + 991) + id(x * 991);
+      n <- n + id(x + 992) + id(x * 992);
+      n <- n + id(x + 993) + id(x * 993);
+      n <- n + id(x + 994) + id(x * 994);
+      n <- n + id(x + 995) + id(x * 995);
+      n <- n + id(x + 996) + id(x * 996);
+      n <- n + id(x + 997) + id(x * 997);
+      n <- n + id(x + 998) + id(x * 998);
+      n <- n + id(x + 999) + id(x * 999);
+      n <- n + id(x + 1000) + id(x * 1000);
+      n <- n + id(x + 1001) + id(x * 1001);
+      n <- n + id(x + 1002) + id(x * 1002);
+      n <- n + id(x + 1003) + id(x * 1003);
+      n <- n + id(x + 1004) + id(x * 1004);
+      n <- n + id(x + 1005) + id(x * 1005);
+      n <- n + id(x + 1006) + id(x * 1006);
+      n <- n + id(x + 1007) + id(x * 1007);
+      n <- n + id(x + 1008) + id(x * 1008);
+      n <- n + id(x + 1009) + id(x * 1009);
+      n <- n + id(x + 1010) + id(x * 1010);
+      n <- n + id(x + 1011) + id(x * 1011);
+      n <- n + id(x + 1012) + id(x * 1012);
+      n <- n + id(x + 1013) + id(x * 1013);
+      n <- n + id(x + 1014) + id(x * 1014);
+      n <- n + id(x + 1015) + id(x * 1015);
+      n <- n + id(x + 1016) + id(x * 1016);
+      n <- n + id(x + 1017) + id(x * 1017);
+      n <- n + id(x + 1018) + id(x * 1018);
+      n <- n + id(x + 1019) + id(x * 1019);
+      n <- n + id(x + 1020) + id(x * 1020);
+      n <- n + id(x + 1021) + id(x * 1021);
+      n <- n + id(x + 1022) + id(x * 1022);
+      n <- n + id(x + 1023) + id(x * 1023);
+      n <- n + id(x + 1024) + id(x * 1024);
+      n <- n + id(x + 1025) + id(x * 1025);
+      n <- n + id(x + 1026) + id(x * 1026);
+      n <- n + id(x + 1027) + id(x * 1027);
+      n <- n + id(x + 1028) + id(x * 1028);
+      n <- n + id(x + 1029) + id(x * 1029);
+      n <- n + id(x + 1030) + id(x * 1030);
+      n <- n + id(x + 1031) + id(x * 1031);
+      n <- n + id(x + 1032) + id(x * 1032);
+      n <- n + id(x + 1033) + id(x * 1033);
+      n <- n + id(x + 1034) + id(x * 1034);
+      n <- n + id(x + 1035) + id(x * 1035);
+      n <- n + id(x + 1036) + id(x * 1036);
+      n <- n + id(x + 1037) + id(x * 1037);
+      n <- n + id(x + 1038) + id(x * 1038);
+      n <- n + id(x + 1039) + id(x * 1039);
+      n <- n + id(x + 1040) + id(x * 1040);
+      n <- n + id(x + 1041) + id(x * 1041);
+      n <- n + id(x + 1042) + id(x * 1042);
+      n <- n + id(x + 1043) + id(x * 1043);
+      n <- n + id(x + 1044) + id(x * 1044);
+      n <- n + id(x + 1045) + id(x * 1045);
+      n <- n + id(x + 1046) + id(x * 1046);
+      n <- n + id(x + 1047) + id(x * 1047);
+      n <- n + id(x + 1048) + id(x * 1048);
+      n <- n + id(x + 1049) + id(x * 1049);
+      n <- n + id(x + 1050) + id(x * 1050);
+      n <- n + id(x + 1051) + id(x * 1051);
+      n <- n + id(x + 1052) + id(x * 1052);
+      n <- n + id(x + 1053) + id(x * 1053);
+      n <- n + id(x + 1054) + id(x * 1054);
+      n <- n + id(x + 1055) + id(x * 1055);
+      n <- n + id(x + 1056) + id(x * 1056);
+      n <- n + id(x + 1057) + id(x * 1057);
+      n <- n + id(x + 1058) + id(x * 1058);
+      n <- n + id(x + 1059) + id(x * 1059);
+      n <- n + id(x + 1060) + id(x * 1060);
+      n <- n + id(x + 1061) + id(x * 1061);
+      n <- n + id(x + 1062) + id(x * 1062);
+      n <- n + id(x + 1063) + id(x * 1063);
+      n <- n + id(x + 1064) + id(x * 1064);
+      n <- n + id(x + 1065) + id(x * 1065);
+      n <- n + id(x + 1066) + id(x * 1066);
+      n <- n + id(x + 1067) + id(x * 1067);
+      n <- n + id(x + 1068) + id(x * 1068);
+      n <- n + id(x + 1069) + id(x * 1069);
+      n <- n + id(x + 1070) + id(x * 1070);
+      n <- n + id(x + 1071) + id(x * 1071);
+      n <- n + id(x + 1072) + id(x * 1072);
+      n <- n + id(x + 1073) + id(x * 1073);
+      n <- n + id(x + 1074) + id(x * 1074);
+      n <- n + id(x + 1075) + id(x * 1075);
+      n <- n + id(x + 1076) + id(x * 1076);
+      n <- n + id(x + 1077) + id(x * 1077);
+      n <- n + id(x + 1078) + id(x * 1078);
+      n <- n + id(x + 1079) + id(x * 1079);
+      n <- n + id(x + 1080) + id(x * 1080);
+      n <- n + id(x + 1081) + id(x * 1081);
+      n <- n + id(x + 1082) + id(x * 1082);
+      n <- n + id(x + 1083) + id(x * 1083);
+      n <- n + id(x + 1084) + id(x * 1084);
+      n <- n + id(x + 1085) + id(x * 1085);
+      n <- n + id(x + 1086) + id(x * 1086);
+      n <- n + id(x + 1087) + id(x * 1087);
+      n <- n + id(x + 1088) + id(x * 1088);
+      n <- n + id(x + 1089) + id(x * 1089);
+      n <- n + id(x + 1090) + id(x * 1090);
+      n <- n + id(x + 1091) + id(x * 1091);
+      n <- n + id(x + 1092) + id(x * 1092);
+      n <- n + id(x + 1093) + id(x * 1093);
+      n <- n + id(x + 1094) + id(x * 1094);
+      n <- n + id(x + 1095) + id(x * 1095);
+      n <- n + id(x + 1096) + id(x * 1096);
+      n <- n + id(x + 1097) + id(x * 1097);
+      n <- n + id(x + 1098) + id(x * 1098);
+      n <- n + id(x + 1099) + id(x * 1099);
+      n <- n + id(x + 1100) + id(x * 1100);
+      n <- n + id(x + 1101) + id(x * 1101);
+      n <- n + id(x + 1102) + id(x * 1102);
+      n <- n + id(x + 1103) + id(x * 1103);
+      n <- n + id(x + 1104) + id(x * 1104);
+      n <- n + id(x + 1105) + id(x * 1105);
+      n <- n + id(x + 1106) + id(x * 1106);
+      n <- n + id(x + 1107) + id(x * 1107);
+      n <- n + id(x + 1108) + id(x * 1108);
+      n <- n + id(x + 1109) + id(x * 1109);
+      n <- n + id(x + 1110) + id(x * 1110);
+      n <- n + id(x + 1111) + id(x * 1111);
+      n <- n + id(x + 1112) + id(x * 1112);
+      n <- n + id(x + 1113) + id(x * 1113);
+      n <- n + id(x + 1114) + id(x * 1114);
+      n <- n + id(x + 1115) + id(x * 1115);
+      n <- n + id(x + 1116) + id(x * 1116);
+      n <- n + id(x + 1117) + id(x * 1117);
+      n <- n + id(x + 1118) + id(x * 1118);
+      n <- n + id(x + 1119) + id(x * 1119);
+      n <- n + id(x + 1120) + id(x * 1120);
+      n <- n + id(x + 1121) + id(x * 1121);
+      n <- n + id(x + 1122) + id(x * 1122);
+      n <- n + id(x + 1123) + id(x * 1123);
+      n <- n + id(x + 1124) + id(x * 1124);
+      n <- n + id(x + 1125) + id(x * 1125);
+      n <- n + id(x + 1126) + id(x * 1126);
+      n <- n + id(x + 1127) + id(x * 1127);
+      n <- n + id(x + 1128) + id(x * 1128);
+      n <- n + id(x + 1129) + id(x * 1129);
+      n <- n + id(x + 1130) + id(x * 1130);
+      n <- n + id(x + 1131) + id(x * 1131);
+      n <- n + id(x + 1132) + id(x * 1132);
+      n <- n + id(x + 1133) + id(x * 1133);
+      n <- n + id(x + 1134) + id(x * 1134);
+      n <- n + id(x + 1135) + id(x * 1135);
+      n <- n + id(x + 1136) + id(x * 1136);
+      n <- n + id(x + 1137) + id(x * 1137);
+      n <- n + id(x + 1138) + id(x * 1138);
+      n <- n + id(x + 1139) + id(x * 1139);
+      n <- n + id(x + 1140) + id(x * 1140);
+      n <- n + id(x + 1141) + id(x * 1141);
+      n <- n + id(x + 1142) + id(x * 1142);
+      n <- n + id(x + 1143) + id(x * 1143);
+      n <- n + id(x + 1144) + id(x * 1144);
+      n <- n + id(x + 1145) + id(x * 1145);
+      n <- n + id(x + 1146) + id(x * 1146);
+      n <- n + id(x + 1147) + id(x * 1147);
+      n <- n + id(x + 1148) + id(x * 1148);
+      n <- n + id(x + 1149) + id(x * 1149);
+      n <- n + id(x + 1150) + id(x * 1150);
+      n <- n + id(x + 1151) + id(x * 1151);
+      n <- n + id(x + 1152) + id(x * 1152);
+      n <- n + id(x + 1153) + id(x * 1153);
+      n <- n + id(x + 1154) + id(x * 1154);
+      n <- n + id(x + 1155) + id(x * 1155);
+      n <- n + id(x + 1156) + id(x * 1156);
+      n <- n + id(x + 1157) + id(x * 1157);
+      n <- n + id(x + 1158) + id(x * 1158);
+      n <- n + id(x + 1159) + id(x * 1159);
+      n <- n + id(x + 1160) + id(x * 1160);
+      n <- n + id(x + 1161) + id(x * 1161);
+      n <- n + id(x + 1162) + id(x * 1162);
+      n <- n + id(x + 1163) + id(x * 1163);
+      n <- n + id(x + 1164) + id(x * 1164);
+      n <- n + id(x + 1165) + id(x * 1165);
+      n <- n + id(x + 1166) + id(x * 1166);
+      n <- n + id(x + 1167) + id(x * 1167);
+      n <- n + id(x + 1168) + id(x * 1168);
+      n <- n + id(x + 1169) + id(x * 1169);
+      n <- n + id(x + 1170) + id(x * 1170);
+      n <- n + id(x + 1171) + id(x * 1171);
+      n <- n + id(x + 1172) + id(x * 1172);
+      n <- n + id(x + 1173) + id(x * 1173);
+      n <- n + id(x + 1174) + id(x * 1174);
+      n <- n + id(x + 1175) + id(x * 1175);
+      n <- n + id(x + 1176) + id(x * 1176);
+      n <- n + id(x + 1177) + id(x * 1177);
+      n <- n + id(x + 1178) + id(x * 1178);
+      n <- n + id(x + 1179) + id(x * 1179);
+      n <- n + id(x + 1180) + id(x * 1180);
+      n <- n + id(x + 1181) + id(x * 1181);
+      n <- n + id(x + 1182) + id(x * 1182);
+      n <- n + id(x + 1183) + id(x * 1183);
+      n <- n + id(x + 1184) + id(x * 1184);
+      n <- n + id(x + 1185) + id(x * 1185);
+      n <- n + id(x + 1186) + id(x * 1186);
+      n <- n + id(x + 1187) + id(x * 1187);
+      n <- n + id(x + 1188) + id(x * 1188);
+      n <- n + id(x + 1189) + id(x * 1189);
+      n <- n + id(x + 1190) + id(x * 1190);
+      n <- n + id(x + 1191) + id(x * 1191);
+      n <- n + id(x + 1192) + id(x * 1192);
+      n <- n + id(x + 1193) + id(x * 1193);
+      n <- n + id(x + 1194) + id(x * 1194);
+      n <- n + id(x + 1195) + id(x * 1195);
+      n <- n + id(x + 1196) + id(x * 1196);
+      n <- n + id(x + 1197) + id(x * 1197);
+      n <- n + id(x + 1198) + id(x * 1198);
+      n <- n + id(x + 1199) + id(x * 1199);
+      n <- n + id(x + 1200) + id(x * 1200);
+      n <- n + id(x + 1201) + id(x * 1201);
+      n <- n + id(x + 1202) + id(x * 1202);
+      n <- n + id(x + 1203) + id(x * 1203);
+      n <- n + id(x + 1204) + id(x * 1204);
+      n <- n + id(x + 1205) + id(x * 1205);
+      n <- n + id(x + 1206) + id(x * 1206);
+      n <- n + id(x + 1207) + id(x * 1207);
+      n <- n + id(x + 1208) + id(x * 1208);
+      n <- n + id(x + 1209) + id(x * 1209);
+      n <- n + id(x + 1210) + id(x * 1210);
+      n <- n + id(x + 1211) + id(x * 1211);
+      n <- n + id(x + 1212) + id(x * 1212);
+      n <- n + id(x + 1213) + id(x * 1213);
+      n <- n + id(x + 1214) + id(x * 1214);
+      n <- n + id(x + 1215) + id(x * 1215);
+      n <- n + id(x + 1216) + id(x * 1216);
+      n <- n + id(x + 1217) + id(x * 1217);
+      n <- n + id(x + 1218) + id(x * 1218);
+      n <- n + id(x + 1219) + id(x * 1219);
+      n <- n + id(x + 1220) + id(x * 1220);
+      n <- n + id(x + 1221) + id(x * 1221);
+      n <- n + id(x + 1222) + id(x * 1222);
+      n <- n + id(x + 1223) + id(x * 1223);
+      n <- n + id(x + 1224) + id(x * 1224);
+      n <- n + id(x + 1225) + id(x * 1225);
+      n <- n + id(x + 1226) + id(x * 1226);
+      n <- n + id(x + 1227) + id(x * 1227);
+      n <- n + id(x + 1228) + id(x * 1228);
+      n <- n + id(x + 1229) + id(x * 1229);
+      n <- n + id(x + 1230) + id(x * 1230);
+      n <- n + id(x + 1231) + id(x * 1231);
+      n <- n + id(x + 1232) + id(x * 1232);
+      n <- n + id(x + 1233) + id(x * 1233);
+      n <- n + id(x + 1234) + id(x * 1234);
+      n <- n + id(x + 1235) + id(x * 1235);
+      n <- n + id(x + 1236) + id(x * 1236);
+      n <- n + id(x + 1237) + id(x * 1237);
+      n <- n + id(x + 1238) + id(x * 1238);
+      n <- n + id(x + 1239) + id(x * 1239);
+      n <- n + id(x + 1240) + id(x * 1240);
+      n <- n + id(x + 1241) + id(x * 1241);
+      n <- n + id(x + 1242) + id(x * 1242);
+      n <- n + id(x + 1243) + id(x * 1243);
+      n <- n + id(x + 1244) + id(x * 1244);
+      n <- n + id(x + 1245) + id(x * 1245);
+      n <- n + id(x + 1246) + id(x * 1246);
+      n <- n + id(x + 1247) + id(x * 1247);
+      n <- n + id(x + 1248) + id(x * 1248);
+      n <- n + id(x + 1249) + id(x * 1249);
+      n <- n + id(x + 1250) + id(x * 1250);
+      n <- n + id(x + 1251) + id(x * 1251);
+      n <- n + id(x + 1252) + id(x * 1252);
+      n <- n + id(x + 1253) + id(x * 1253);
+      n <- n + id(x + 1254) + id(x * 1254);
+      n <- n + id(x + 1255) + id(x * 1255);
+      n <- n + id(x + 1256) + id(x * 1256);
+      n <- n + id(x + 1257) + id(x * 1257);
+      n <- n + id(x + 1258) + id(x * 1258);
+      n <- n + id(x + 1259) + id(x * 1259);
+      n <- n + id(x + 1260) + id(x * 1260);
+      n <- n + id(x + 1261) + id(x * 1261);
+      n <- n + id(x + 1262) + id(x * 1262);
+      n <- n + id(x + 1263) + id(x * 1263);
+      n <- n + id(x + 1264) + id(x * 1264);
+      n <- n + id(x + 1265) + id(x * 1265);
+      n <- n + id(x + 1266) + id(x * 1266);
+      n <- n + id(x + 1267) + id(x * 1267);
+      n <- n + id(x + 1268) + id(x * 1268);
+      n <- n + id(x + 1269) + id(x * 1269);
+      n <- n + id(x + 1270) + id(x * 1270);
+      n <- n + id(x + 1271) + id(x * 1271);
+      n <- n + id(x + 1272) + id(x * 1272);
+      n <- n + id(x + 1273) + id(x * 1273);
+      n <- n + id(x + 1274) + id(x * 1274);
+      n <- n + id(x + 1275) + id(x * 1275);
+      n <- n + id(x + 1276) + id(x * 1276);
+      n <- n + id(x + 1277) + id(x * 1277);
+      n <- n + id(x + 1278) + id(x * 1278);
+      n <- n + id(x + 1279) + id(x * 1279);
+      n <- n + id(x + 1280) + id(x * 1280);
+      n <- n + id(x + 1281) + id(x * 1281);
+      n <- n + id(x + 1282) + id(x * 1282);
+      n <- n + id(x + 1283) + id(x * 1283);
+      n <- n + id(x + 1284) + id(x * 1284);
+      n <- n + id(x + 1285) + id(x * 1285);
+      n <- n + id(x + 1286) + id(x * 1286);
+      n <- n + id(x + 1287) + id(x * 1287);
+      n <- n + id(x + 1288) + id(x * 1288);
+      n <- n + id(x + 1289) + id(x * 1289);
+      n <- n + id(x + 1290) + id(x * 1290);
+      n <- n + id(x + 1291) + id(x * 1291);
+      n <- n + id(x + 1292) + id(x * 1292);
+      n <- n + id(x + 1293) + id(x * 1293);
+      n <- n + id(x + 1294) + id(x * 1294);
+      n <- n + id(x + 1295) + id(x * 1295);
+      n <- n + id(x + 1296) + id(x * 1296);
+      n <- n + id(x + 1297) + id(x * 1297);
+      n <- n + id(x + 1298) + id(x * 1298);
+      n <- n + id(x + 1299) + id(x * 1299);
+      n <- n + id(x + 1300) + id(x * 1300);
+      n <- n + id(x + 1301) + id(x * 1301);
+      n <- n + id(x + 1302) + id(x * 1302);
+      n <- n + id(x + 1303) + id(x * 1303);
+      n <- n + id(x + 1304) + id(x * 1304);
+      n <- n + id(x + 1305) + id(x * 1305);
+      n <- n + id(x + 1306) + id(x * 1306);
+      n <- n + id(x + 1307) + id(x * 1307);
+      n <- n + id(x + 1308) + id(x * 1308);
+      n <- n + id(x + 1309) + id(x * 1309);
+      n <- n + id(x + 1310) + id(x * 1310);
+      n <- n + id(x + 1311) + id(x * 1311);
+      n <- n + id(x + 1312) + id(x * 1312);
+      n <- n + id(x + 1313) + id(x * 1313);
+      n <- n + id(x + 1314) + id(x * 1314);
+      n <- n + id(x + 1315) + id(x * 1315);
+      n <- n + id(x + 1316) + id(x * 1316);
+      n <- n + id(x + 1317) + id(x * 1317);
+      n <- n + id(x + 1318) + id(x * 1318);
+      n <- n + id(x + 1319) + id(x * 1319);
+      n <- n + id(x + 1320) + id(x * 1320);
+      n <- n + id(x + 1321) + id(x * 1321);
+      n <- n + id(x + 1322) + id(x * 1322);
+      n <- n + id(x + 1323) + id(x * 1323);
+      n <- n + id(x + 1324) + id(x * 1324);
+      n <- n + id(x + 1325) + id(x * 1325);
+      n <- n + id(x + 1326) + id(x * 1326);
+      n <- n + id(x + 1327) + id(x * 1327);
+      n <- n + id(x + 1328) + id(x * 1328);
+      n <- n + id(x + 1329) + id(x * 1329);
+      n <- n + id(x + 1330) + id(x * 1330);
+      n <- n + id(x + 1331) + id(x * 1331);
+      n <- n + id(x + 1332) + id(x * 1332);
+      n <- n + id(x + 1333) + id(x * 1333);
+      n <- n + id(x + 1334) + id(x * 1334);
+      n <- n + id(x + 1335) + id(x * 1335);
+      n <- n + id(x + 1336) + id(x * 1336);
+      n <- n + id(x + 1337) + id(x * 1337);
+      n <- n + id(x + 1338) + id(x * 1338);
+      n <- n + id(x + 1339) + id(x * 1339);
+      n <- n + id(x + 1340) + id(x * 1340);
+      n <- n + id(x + 1341) + id(x * 1341);
+      n <- n + id(x + 1342) + id(x * 1342);
+      n <- n + id(x + 1343) + id(x * 1343);
+      n <- n + id(x + 1344) + id(x * 1344);
+      n <- n + id(x + 1345) + id(x * 1345);
+      n <- n + id(x + 1346) + id(x * 1346);
+      n <- n + id(x + 1347) + id(x * 1347);
+      n <- n + id(x + 1348) + id(x * 1348);
+      n <- n + id(x + 1349) + id(x * 1349);
+      n <- n + id(x + 1350) + id(x * 1350);
+      n <- n + id(x + 1351) + id(x * 1351);
+      n <- n + id(x + 1352) + id(x * 1352);
+      n <- n + id(x + 1353) + id(x * 1353);
+      n <- n + id(x + 1354) + id(x * 1354);
+      n <- n + id(x + 1355) + id(x * 1355);
+      n <- n + id(x + 1356) + id(x * 1356);
+      n <- n + id(x + 1357) + id(x * 1357);
+      n <- n + id(x + 1358) + id(x * 1358);
+      n <- n + id(x + 1359) + id(x * 1359);
+      n <- n + id(x + 1360) + id(x * 1360);
+      n <- n + id(x + 1361) + id(x * 1361);
+      n <- n + id(x + 1362) + id(x * 1362);
+      n <- n + id(x + 1363) + id(x * 1363);
+      n <- n + id(x + 1364) + id(x * 1364);
+      n <- n + id(x + 1365) + id(x * 1365);
+      n <- n + id(x + 1366) + id(x * 1366);
+      n <- n + id(x + 1367) + id(x * 1367);
+      n <- n + id(x + 1368) + id(x * 1368);
+      n <- n + id(x + 1369) + id(x * 1369);
+      n <- n + id(x + 1370) + id(x * 1370);
+      n <- n + id(x + 1371) + id(x * 1371);
+      n <- n + id(x + 1372) + id(x * 1372);
+      n <- n + id(x + 1373) + id(x * 1373);
+      n <- n + id(x + 1374) + id(x * 1374);
+      n <- n + id(x + 1375) + id(x * 1375);
+      n <- n + id(x + 1376) + id(x * 1376);
+      n <- n + id(x + 1377) + id(x * 1377);
+      n <- n + id(x + 1378) + id(x * 1378);
+      n <- n + id(x + 1379) + id(x * 1379);
+      n <- n + id(x + 1380) + id(x * 1380);
+      n <- n + id(x + 1381) + id(x * 1381);
+      n <- n + id(x + 1382) + id(x * 1382);
+      n <- n + id(x + 1383) + id(x * 1383);
+      n <- n + id(x + 1384) + id(x * 1384);
+      n <- n + id(x + 1385) + id(x * 1385);
+      n <- n + id(x + 1386) + id(x * 1386);
+      n <- n + id(x + 1387) + id(x * 1387);
+      n <- n + id(x + 1388) + id(x * 1388);
+      n <- n + id(x + 1389) + id(x * 1389);
+      n <- n + id(x + 1390) + id(x * 1390);
+      n <- n + id(x + 1391) + id(x * 1391);
+      n <- n + id(x + 1392) + id(x * 1392);
+      n <- n + id(x + 1393) + id(x * 1393);
+      n <- n + id(x + 1394) + id(x * 1394);
+      n <- n + id(x + 1395) + id(x * 1395);
+      n <- n + id(x + 1396) + id(x * 1396);
+      n <- n + id(x + 1397) + id(x * 1397);
+      n <- n + id(x + 1398) + id(x * 1398);
+      n <- n + id(x + 1399) + id(x * 1399);
+      n <- n + id(x + 1400) + id(x * 1400);
+      n <- n + id(x + 1401) + id(x * 1401);
+      n <- n + id(x + 1402) + id(x * 1402);
+      n <- n + id(x + 1403) + id(x * 1403);
+      n <- n + id(x + 1404) + id(x * 1404);
+      n <- n + id(x + 1405) + id(x * 1405);
+      n <- n + id(x + 1406) + id(x * 1406);
+      n <- n + id(x + 1407) + id(x * 1407);
+      n <- n + id(x + 1408) + id(x * 1408);
+      n <- n + id(x + 1409) + id(x * 1409);
+      n <- n + id(x + 1410) + id(x * 1410);
+      n <- n + id(x + 1411) + id(x * 1411);
+      n <- n + id(x + 1412) + id(x * 1412);
+      n <- n + id(x + 1413) + id(x * 1413);
+      n <- n + id(x + 1414) + id(x * 1414);
+      n <- n + id(x + 1415) + id(x * 1415);
+      n <- n + id(x + 1416) + id(x * 1416);
+      n <- n + id(x + 1417) + id(x * 1417);
+      n <- n + id(x + 1418) + id(x * 1418);
+      n <- n + id(x + 1419) + id(x * 1419);
+      n <- n + id(x + 1420) + id(x * 1420);
+      n <- n + id(x + 1421) + id(x * 1421);
+      n <- n + id(x + 1422) + id(x * 1422);
+      n <- n + id(x + 1423) + id(x * 1423);
+      n <- n + id(x + 1424) + id(x * 1424);
+      n <- n + id(x + 1425) + id(x * 1425);
+      n <- n + id(x + 1426) + id(x * 1426);
+      n <- n + id(x + 1427) + id(x * 1427);
+      n <- n + id(x + 1428) + id(x * 1428);
+      n <- n + id(x + 1429) + id(x * 1429);
+      n <- n + id(x + 1430) + id(x * 1430);
+      n <- n + id(x + 1431) + id(x * 1431);
+      n <- n + id(x + 1432) + id(x * 1432);
+      n <- n + id(x + 1433) + id(x * 1433);
+      n <- n + id(x + 1434) + id(x * 1434);
+      n <- n + id(x + 1435) + id(x * 1435);
+      n <- n + id(x + 1436) + id(x * 1436);
+      n <- n + id(x + 1437) + id(x * 1437);
+      n <- n + id(x + 1438) + id(x * 1438);
+      n <- n + id(x + 1439) + id(x * 1439);
+      n <- n + id(x + 1440) + id(x * 1440);
+      n <- n + id(x + 1441) + id(x * 1441);
+      n <- n + id(x + 1442) + id(x * 1442);
+      n <- n + id(x + 1443) + id(x * 1443);
+      n <- n + id(x + 1444) + id(x * 1444);
+      n <- n + id(x + 1445) + id(x * 1445);
+      n <- n + id(x + 1446) + id(x * 1446);
+      n <- n + id(x + 1447) + id(x * 1447);
+      n <- n + id(x + 1448) + id(x * 1448);
+      n <- n + id(x + 1449) + id(x * 1449);
+      n <- n + id(x + 1450) + id(x * 1450);
+      n <- n + id(x + 1451) + id(x * 1451);
+      n <- n + id(x + 1452) + id(x * 1452);
+      n <- n + id(x + 1453) + id(x * 1453);
+      n <- n + id(x + 1454) + id(x * 1454);
+      n <- n + id(x + 1455) + id(x * 1455);
+      n <- n + id(x + 1456) + id(x * 1456);
+      n <- n + id(x + 1457) + id(x * 1457);
+      n <- n + id(x + 1458) + id(x * 1458);
+      n <- n + id(x + 1459) + id(x * 1459);
+      n <- n + id(x + 1460) + id(x * 1460);
+      n <- n + id(x + 1461) + id(x * 1461);
+      n <- n + id(x + 1462) + id(x * 1462);
+      n <- n + id(x + 1463) + id(x * 1463);
+      n <- n + id(x + 1464) + id(x * 1464);
+      n <- n + id(x + 1465) + id(x * 1465);
+      n <- n + id(x + 1466) + id(x * 1466);
+      n <- n + id(x + 1467) + id(x * 1467);
+      n <- n + id(x + 1468) + id(x * 1468);
+      n <- n + id(x + 1469) + id(x * 1469);
+      n <- n + id(x + 1470) + id(x * 1470);
+      n <- n + id(x + 1471) + id(x * 1471);
+      n <- n + id(x + 1472) + id(x * 1472);
+      n <- n + id(x + 1473) + id(x * 1473);
+      n <- n + id(x + 1474) + id(x * 1474);
+      n <- n + id(x + 1475) + id(x * 1475);
+      n <- n + id(x + 1476) + id(x * 1476);
+      n <- n + id(x + 1477) + id(x * 1477);
+      n <- n + id(x + 1478) + id(x * 1478);
+      n <- n + id(x + 1479) + id(x * 1479);
+      n <- n + id(x + 1480) + id(x * 1480);
+      n <- n + id(x + 1481) + id(x * 1481);
+      n <- n + id(x + 1482) + id(x * 1482);
+      n <- n + id(x + 1483) + id(x * 1483);
+      n <- n + id(x + 1484) + id(x * 1484);
+      n <- n + id(x + 1485) + id(x * 1485);
+      n <- n + id(x + 1486) + id(x * 1486);
+      n <- n + id(x + 1487) + id(x * 1487);
+      n <- n + id(x + 1488) + id(x * 1488);
+      n <- n + id(x + 1489) + id(x * 1489);
+      n <- n + id(x + 1490) + id(x * 1490);
+      n <- n + id(x + 1491) + id(x * 1491);
+      n <- n + id(x + 1492) + id(x * 1492);
+      n <- n + id(x + 1493) + id(x * 1493);
+      n <- n + id(x + 1494) + id(x * 1494);
+      n <- n + id(x + 1495) + id(x * 1495);
+      n <- n + id(x + 1496) + id(x * 1496);
+      n <- n + id(x + 1497) + id(x * 1497);
+      n <- n + id(x + 1498) + id(x * 1498);
+      n <- n + id(x + 1499) + id(x * 1499);
+      out_int(n);
+      out_string("\n");
+    }
+  };
+};
@@ -0,0 +1,96 @@
+(*
+ *  Case: a ring of objects of a dozen classes, two and three levels
+ *  below Shape, classified over and over by case expressions whose
+ *  branches are tried from the most specific class up.
+ *)
+
+class Shape { sides() : Int { 0 }; };
+class Polygon inherits Shape { sides() : Int { 3 }; };
+class Curve inherits Shape { };
+class Triangle inherits Polygon { };
+class Quad inherits Polygon { sides() : Int { 4 }; };
+class Square inherits Quad { };
+class Rectangle inherits Quad { };
+class Rhombus inherits Quad { };
+class Pentagon inherits Polygon { sides() : Int { 5 }; };
+class Circle inherits Curve { };
+class Ellipse inherits Curve { };
+class Spiral inherits Curve { };
+
+-- A cycle of shapes.
+class Ring {
+   shape : Shape;
+   next : Ring;
+   init(s : Shape) : Ring { { shape <- s; self; } };
+   link(r : Ring) : Ring { next <- r };
+   get_shape() : Shape { shape };
+   get_next() : Ring { next };
+};
+
+class Main inherits IO {
+
+   -- The k-th of the twelve kinds of shape.
+   make(k : Int) : Shape {
+      if k = 0 then new Shape else
+      if k = 1 then new Polygon else
+      if k = 2 then new Curve else
+      if k = 3 then new Triangle else
+      if k = 4 then new Quad else
+      if k = 5 then new Square else
+      if k = 6 then new Rectangle else
+      if k = 7 then new Rhombus else
+      if k = 8 then new Pentagon else
+      if k = 9 then new Circle else
+      if k = 10 then new Ellipse else
+         new Spiral
+      fi fi fi fi fi fi fi fi fi fi fi
+   };
+
+   -- A weight that depends on the most specific branch that matches.
+   weight(s : Shape) : Int {
+      case s of
+         x : Square => 11;
+         x : Rectangle => 13;
+         x : Rhombus => 17;
+         x : Quad => 19;
+         x : Triangle => 23;
+         x : Pentagon => 29;
+         x : Polygon => 31;
+         x : Circle => 37;
+         x : Ellipse => 41;
+         x : Curve => 43;
+         x : Shape => 47;
+      esac
+   };
+
+   -- 1 for a curve and 2 for a polygon, through a case on Object.
+   family(o : Object) : Int {
+      case o of
+         p : Polygon => 2;
+         c : Curve => 1;
+         o : Object => 0;
+      esac
+   };
+
+   main() : Object {
+      let ring : Ring <- new Ring.init(make(0)), last : Ring <- ring, k : Int <- 1,
+          i : Int <- 0, total : Int <- 0, curves : Int <- 0, s : Shape in {
+         while k < 12 loop {
+            last <- last.link(new Ring.init(make(k)));
+            k <- k + 1;
+         } pool;
+         last.link(ring);
+         while i < 20000 loop {
+            s <- ring.get_shape();
+            total <- total + weight(s) + s.sides();
+            curves <- curves + family(s) + family(i);
+            ring <- ring.get_next();
+            i <- i + 1;
+         } pool;
+         out_int(total);
+         out_string("\n");
+         out_int(curves);
+         out_string("\n");
+      }
+   };
+};
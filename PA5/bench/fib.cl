@@ -0,0 +1,38 @@
+(*
+ *  Deep recursion: the naive Fibonacci, Ackermann and Takeuchi
+ *  functions, where almost every instruction is a call, a return or
+ *  integer arithmetic on boxed Ints.
+ *)
+
+class Main inherits IO {
+
+   fib(n : Int) : Int {
+      if n < 2 then n else fib(n - 1) + fib(n - 2) fi
+   };
+
+   ack(m : Int, n : Int) : Int {
+      if m = 0 then n + 1 else
+      if n = 0 then ack(m - 1, 1) else
+         ack(m - 1, ack(m, n - 1))
+      fi fi
+   };
+
+   tak(x : Int, y : Int, z : Int) : Int {
+      if y < x then tak(tak(x - 1, y, z), tak(y - 1, z, x), tak(z - 1, x, y))
+      else z fi
+   };
+
+   main() : Object {
+      {
+         out_int(fib(21));
+         out_string("\n");
+         out_int(ack(2, 200));
+         out_string("\n");
+         out_int(ack(3, 5));
+         out_string("\n");
+         out_int(tak(18, 12, 6));
+         out_string("\n");
+      }
+   };
+
+};
@@ -0,0 +1,116 @@
+(*
+ *  Allocation: cons lists built, reversed, mapped, filtered and sorted,
+ *  so that most of the run is spent making small objects that soon
+ *  become garbage.
+ *)
+
+class List {
+   is_nil() : Bool { true };
+   head() : Int { { abort(); 0; } };
+   tail() : List { { abort(); self; } };
+   cons(x : Int) : List { new Cons.init(x, self) };
+   length() : Int { 0 };
+   sum() : Int { 0 };
+};
+
+class Cons inherits List {
+   car : Int;
+   cdr : List;
+   init(x : Int, rest : List) : List { { car <- x; cdr <- rest; self; } };
+   is_nil() : Bool { false };
+   head() : Int { car };
+   tail() : List { cdr };
+   length() : Int { 1 + cdr.length() };
+   sum() : Int { car + cdr.sum() };
+};
+
+class Main inherits IO {
+   seed : Int <- 12345;
+
+   -- The next number of a small linear congruential generator, from 0
+   -- to 999.
+   random() : Int {
+      {
+         seed <- seed * 1103 + 12345;
+         seed <- seed - (seed / 65536) * 65536;
+         seed / 66;
+      }
+   };
+
+   range(n : Int) : List {
+      let l : List <- new List in {
+         while 0 < n loop { l <- l.cons(n); n <- n - 1; } pool;
+         l;
+      }
+   };
+
+   reverse(l : List) : List {
+      let r : List <- new List in {
+         while not l.is_nil() loop { r <- r.cons(l.head()); l <- l.tail(); } pool;
+         r;
+      }
+   };
+
+   -- 3x + 1 of every element, in order.
+   map(l : List) : List {
+      if l.is_nil() then l else map(l.tail()).cons(3 * l.head() + 1) fi
+   };
+
+   -- The even elements, in order.
+   evens(l : List) : List {
+      if l.is_nil() then l else
+         let rest : List <- evens(l.tail()), x : Int <- l.head() in
+            if x - (x / 2) * 2 = 0 then rest.cons(x) else rest fi
+      fi
+   };
+
+   insert(x : Int, l : List) : List {
+      if l.is_nil() then l.cons(x) else
+      if x <= l.head() then l.cons(x) else
+         insert(x, l.tail()).cons(l.head())
+      fi fi
+   };
+
+   sort(l : List) : List {
+      let sorted : List <- new List in {
+         while not l.is_nil() loop {
+            sorted <- insert(l.head(), sorted);
+            l <- l.tail();
+         } pool;
+         sorted;
+      }
+   };
+
+   print(l : List, n : Int) : Object {
+      {
+         while (if l.is_nil() then false else 0 < n fi) loop {
+            out_int(l.head());
+            out_string(" ");
+            l <- l.tail();
+            n <- n - 1;
+         } pool;
+         out_string("\n");
+      }
+   };
+
+   main() : Object {
+      let i : Int <- 0, total : Int <- 0, l : List, random : List <- new List in {
+         while i < 50 loop {
+            l <- range(400);
+            total <- total + evens(map(reverse(l))).sum();
+            i <- i + 1;
+         } pool;
+         out_int(total);
+         out_string("\n");
+         i <- 0;
+         while i < 500 loop { random <- random.cons(random()); i <- i + 1; } pool;
+         l <- sort(random);
+         print(l, 10);
+         print(reverse(l), 10);
+         out_int(l.length());
+         out_string(" ");
+         out_int(l.sum());
+         out_string("\n");
+      }
+   };
+};
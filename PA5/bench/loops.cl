@@ -0,0 +1,66 @@
+(*
+ *  Integer loops: a doubly nested loop, trial division and the Collatz
+ *  sequence, with no dispatch inside the loops.
+ *)
+
+class Main inherits IO {
+
+   main() : Object {
+      {
+         out_int(grid(300));
+         out_string("\n");
+         out_int(primes(4000));
+         out_string("\n");
+         out_int(collatz(2000));
+         out_string("\n");
+      }
+   };
+
+   -- The sum of (i * j) mod 7 over 0 <= i, j < n.
+   grid(n : Int) : Int {
+      let sum : Int <- 0, i : Int <- 0, j : Int, k : Int in {
+         while i < n loop {
+            j <- 0;
+            while j < n loop {
+               k <- i * j;
+               sum <- sum + (k - (k / 7) * 7);
+               j <- j + 1;
+            } pool;
+            i <- i + 1;
+         } pool;
+         sum;
+      }
+   };
+
+   -- The number of primes below n.
+   primes(n : Int) : Int {
+      let count : Int <- 0, p : Int <- 2, d : Int, prime : Bool in {
+         while p < n loop {
+            d <- 2;
+            prime <- true;
+            while (if prime then d * d <= p else false fi) loop {
+               if p - (p / d) * d = 0 then prime <- false else d <- d + 1 fi;
+            } pool;
+            if prime then count <- count + 1 else 0 fi;
+            p <- p + 1;
+         } pool;
+         count;
+      }
+   };
+
+   -- The total number of Collatz steps from 1, 2, ..., n down to 1.
+   collatz(n : Int) : Int {
+      let steps : Int <- 0, i : Int <- 1, x : Int in {
+         while i <= n loop {
+            x <- i;
+            while not x = 1 loop {
+               if x - (x / 2) * 2 = 0 then x <- x / 2 else x <- 3 * x + 1 fi;
+               steps <- steps + 1;
+            } pool;
+            i <- i + 1;
+         } pool;
+         steps;
+      }
+   };
+
+};
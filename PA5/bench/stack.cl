@@ -0,0 +1,115 @@
+(*
+ *  The stack machine of PA1, with multiplication added: reads one
+ *  command a line from standard input and prints the prompt ">" before
+ *  each.  The commands are
+ *
+ *      int   push the integer
+ *      +     push +
+ *      *     push *
+ *      s     push s
+ *      e     evaluate the top: + or * pops itself and the two integers
+ *            below it and pushes their sum or product; s pops itself
+ *            and swaps the two below it; an integer does nothing
+ *      d     display the stack, one element a line, top first
+ *      x     stop
+ *
+ *  Needs atoi.cl for the conversions between integers and strings.
+ *)
+
+class StackCommand {
+   -- What is printed for the command by d.
+   show() : String { "?" };
+   -- The stack after evaluating this command on top of `rest'.
+   eval(rest : Stack) : Stack { rest.push(self) };
+};
+
+class IntCommand inherits StackCommand {
+   value : Int;
+   init(n : Int) : IntCommand { { value <- n; self; } };
+   get_value() : Int { value };
+   show() : String { new A2I.i2a(value) };
+};
+
+class PlusCommand inherits StackCommand {
+   show() : String { "+" };
+   eval(rest : Stack) : Stack {
+      let a : IntCommand <- rest.top_int(), b : IntCommand <- rest.pop().top_int() in
+         rest.pop().pop().push(new IntCommand.init(a.get_value() + b.get_value()))
+   };
+};
+
+class TimesCommand inherits StackCommand {
+   show() : String { "*" };
+   eval(rest : Stack) : Stack {
+      let a : IntCommand <- rest.top_int(), b : IntCommand <- rest.pop().top_int() in
+         rest.pop().pop().push(new IntCommand.init(a.get_value() * b.get_value()))
+   };
+};
+
+class SwapCommand inherits StackCommand {
+   show() : String { "s" };
+   eval(rest : Stack) : Stack {
+      let a : StackCommand <- rest.top(), b : StackCommand <- rest.pop().top() in
+         rest.pop().pop().push(a).push(b)
+   };
+};
+
+class Stack {
+   is_empty() : Bool { true };
+   top() : StackCommand { { abort(); new StackCommand; } };
+   pop() : Stack { { abort(); self; } };
+   push(c : StackCommand) : Stack { new StackNode.init(c, self) };
+
+   top_int() : IntCommand {
+      case top() of
+         n : IntCommand => n;
+         c : StackCommand => { abort(); new IntCommand; };
+      esac
+   };
+
+   display(io : IO) : Object {
+      let s : Stack <- self in
+         while not s.is_empty() loop {
+            io.out_string(s.top().show().concat("\n"));
+            s <- s.pop();
+         } pool
+   };
+};
+
+class StackNode inherits Stack {
+   command : StackCommand;
+   next : Stack;
+   init(c : StackCommand, s : Stack) : Stack { { command <- c; next <- s; self; } };
+   is_empty() : Bool { false };
+   top() : StackCommand { command };
+   pop() : Stack { next };
+};
+
+class Main inherits IO {
+   stack : Stack <- new Stack;
+
+   execute(line : String) : Bool {
+      if line = "x" then false else {
+         if line = "e" then
+            if not stack.is_empty() then
+               stack <- stack.top().eval(stack.pop())
+            else 0 fi
+         else
+         if line = "d" then stack.display(self) else
+         if line = "+" then stack <- stack.push(new PlusCommand) else
+         if line = "*" then stack <- stack.push(new TimesCommand) else
+         if line = "s" then stack <- stack.push(new SwapCommand) else
+            stack <- stack.push(new IntCommand.init(new A2I.a2i(line)))
+         fi fi fi fi fi;
+         true;
+      } fi
+   };
+
+   main() : Object {
+      let running : Bool <- true in
+         while running loop {
+            out_string(">");
+            running <- execute(in_string());
+         } pool
+   };
+};
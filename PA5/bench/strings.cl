@@ -0,0 +1,67 @@
+(*
+ *  Strings: concatenation, substr and length on strings of a few
+ *  thousand characters, and the conversion of integers to strings.
+ *)
+
+class Main inherits IO {
+
+   -- s written backwards, one character at a time.
+   reverse(s : String) : String {
+      let r : String <- "", i : Int <- s.length() in {
+         while 0 < i loop {
+            i <- i - 1;
+            r <- r.concat(s.substr(i, 1));
+         } pool;
+         r;
+      }
+   };
+
+   vowels(s : String) : Int {
+      let n : Int <- 0, i : Int <- 0, c : String in {
+         while i < s.length() loop {
+            c <- s.substr(i, 1);
+            if c = "a" then n <- n + 1 else
+            if c = "e" then n <- n + 1 else
+            if c = "i" then n <- n + 1 else
+            if c = "o" then n <- n + 1 else
+            if c = "u" then n <- n + 1 else 0
+            fi fi fi fi fi;
+            i <- i + 1;
+         } pool;
+         n;
+      }
+   };
+
+   -- The decimal digits of a non-negative n.
+   i2a(n : Int) : String {
+      if n < 10 then "0123456789".substr(n, 1)
+      else i2a(n / 10).concat("0123456789".substr(n - (n / 10) * 10, 1)) fi
+   };
+
+   main() : Object {
+      let s : String <- "", i : Int <- 0, numbers : String <- "" in {
+         while i < 200 loop {
+            s <- s.concat("the quick brown fox ");
+            i <- i + 1;
+         } pool;
+         out_int(s.length());
+         out_string("\n");
+         out_int(vowels(s));
+         out_string("\n");
+         out_string(reverse(s).substr(0, 40));
+         out_string("\n");
+         i <- 0;
+         while i < 2000 loop {
+            numbers <- numbers.concat(i2a(i * 37));
+            i <- i + 1;
+         } pool;
+         out_int(numbers.length());
+         out_string("\n");
+         out_string(numbers.substr(numbers.length() - 20, 20));
+         out_string("\n");
+         out_int(vowels(reverse(numbers.concat(s))));
+         out_string("\n");
+      }
+   };
+
+};
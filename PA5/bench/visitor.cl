@@ -0,0 +1,130 @@
+(*
+ *  Dispatch: an expression tree walked by visitors with double dispatch,
+ *  so that nearly every node visit is two dynamic calls.  Values are
+ *  kept below 1000 so that the sums and products never overflow.
+ *)
+
+class Visitor {
+   visit_num(n : Num) : Int { 0 };
+   visit_add(a : Add) : Int { 0 };
+   visit_mul(m : Mul) : Int { 0 };
+   visit_neg(n : Neg) : Int { 0 };
+};
+
+class Node {
+   accept(v : Visitor) : Int { 0 };
+};
+
+class Num inherits Node {
+   value : Int;
+   init(x : Int) : Num { { value <- x; self; } };
+   get_value() : Int { value };
+   accept(v : Visitor) : Int { v.visit_num(self) };
+};
+
+class Binary inherits Node {
+   left : Node;
+   right : Node;
+   init(l : Node, r : Node) : Binary { { left <- l; right <- r; self; } };
+   get_left() : Node { left };
+   get_right() : Node { right };
+};
+
+class Add inherits Binary {
+   accept(v : Visitor) : Int { v.visit_add(self) };
+};
+
+class Mul inherits Binary {
+   accept(v : Visitor) : Int { v.visit_mul(self) };
+};
+
+class Neg inherits Node {
+   operand : Node;
+   init(x : Node) : Neg { { operand <- x; self; } };
+   get_operand() : Node { operand };
+   accept(v : Visitor) : Int { v.visit_neg(self) };
+};
+
+-- The value of the expression, modulo 1000.
+class Evaluator inherits Visitor {
+   mod(x : Int) : Int {
+      let r : Int <- x - (x / 1000) * 1000 in
+         if r < 0 then r + 1000 else r fi
+   };
+   visit_num(n : Num) : Int { n.get_value() };
+   visit_add(a : Add) : Int {
+      mod(a.get_left().accept(self) + a.get_right().accept(self))
+   };
+   visit_mul(m : Mul) : Int {
+      mod(m.get_left().accept(self) * m.get_right().accept(self))
+   };
+   visit_neg(n : Neg) : Int { mod(~n.get_operand().accept(self)) };
+};
+
+-- The number of nodes.
+class Counter inherits Visitor {
+   visit_num(n : Num) : Int { 1 };
+   visit_add(a : Add) : Int {
+      1 + a.get_left().accept(self) + a.get_right().accept(self)
+   };
+   visit_mul(m : Mul) : Int {
+      1 + m.get_left().accept(self) + m.get_right().accept(self)
+   };
+   visit_neg(n : Neg) : Int { 1 + n.get_operand().accept(self) };
+};
+
+-- The depth of the deepest leaf.
+class Depth inherits Visitor {
+   max(a : Int, b : Int) : Int { if a < b then b else a fi };
+   visit_num(n : Num) : Int { 1 };
+   visit_add(a : Add) : Int {
+      1 + max(a.get_left().accept(self), a.get_right().accept(self))
+   };
+   visit_mul(m : Mul) : Int {
+      1 + max(m.get_left().accept(self), m.get_right().accept(self))
+   };
+   visit_neg(n : Neg) : Int { 1 + n.get_operand().accept(self) };
+};
+
+class Main inherits IO {
+   seed : Int <- 7;
+
+   -- A step of a small linear congruential generator, modulo 4096.
+   next() : Int {
+      {
+         seed <- seed * 109 + 89;
+         seed <- seed - (seed / 4096) * 4096;
+         seed;
+      }
+   };
+
+   -- A number from 0 to m - 1.
+   random(m : Int) : Int {
+      let x : Int <- next() / 16 in x - (x / m) * m
+   };
+
+   build(depth : Int) : Node {
+      if depth = 0 then new Num.init(random(10)) else
+         let k : Int <- random(3) in
+            if k = 0 then new Add.init(build(depth - 1), build(depth - 1)) else
+            if k = 1 then new Mul.init(build(depth - 1), build(depth - 1)) else
+               new Neg.init(build(depth - 1))
+            fi fi
+      fi
+   };
+
+   main() : Object {
+      let tree : Node <- build(17), i : Int <- 0, sum : Int <- 0 in {
+         while i < 20 loop {
+            sum <- sum + tree.accept(new Evaluator);
+            i <- i + 1;
+         } pool;
+         out_int(sum);
+         out_string("\n");
+         out_int(tree.accept(new Counter));
+         out_string("\n");
+         out_int(tree.accept(new Depth));
+         out_string("\n");
+      }
+   };
+};
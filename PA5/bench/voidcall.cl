@@ -0,0 +1,20 @@
+(*
+ *  Void call: static dispatches to methods of classes that are never
+ *  instantiated.  The object dispatched on can only be void, but the
+ *  methods named must still be coded.
+ *)
+
+class P { g() : Int { 2 }; };
+class A inherits P { f() : Int { 1 }; };
+
+class Main inherits IO {
+  a : A;
+
+  main() : Object {
+    {
+      if isvoid a then out_string("void\n") else out_int(a@A.f()) fi;
+      if isvoid a then out_string("void\n") else out_int(a@A.g()) fi;
+      if isvoid a then out_string("void\n") else out_int(a@P.g()) fi;
+    }
+  };
+};
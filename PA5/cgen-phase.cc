@@ -4,12 +4,16 @@
 #include "cool-io.h"  //includes iostream
 #include "cool-tree.h"
 #include "cgen_gc.h"
+#include "ast-stream.h"
+#include "stats.h"
 
 extern int optind;            // for option processing
 extern char *out_filename;    // name of output assembly
 extern Program ast_root;             // root of the abstract syntax tree
 FILE *ast_file = stdin;       // we read the AST from standard input
 extern int ast_yyparse(void); // entry point to the AST parser
+AstStreamReader *ast_class_bodies = NULL;  // binary AST: decodes the
+                                           // features of one class at a time
 
 int cool_yydebug;     // not used, but needed to link with handle_flags
 char *curr_filename;
@@ -32,9 +36,22 @@ int main(int argc, char *argv[]) {
 
   // 
   // Don't touch the output file until we know that earlier phases of the
-  // compiler have succeeded.
+  // compiler have succeeded.  The AST may be text or binary; the first
+  // byte tells.  A binary AST is mapped and only the class headers are
+  // decoded here; cgen decodes each class body as it codes the class.
   //
-  ast_yyparse();
+  StatsPass *pass = new StatsPass("read AST");
+  if (ast_stream_is_binary(ast_file)) {
+      size_t len;
+      const char *buf = ast_stream_map(ast_file, &len);
+      ast_class_bodies = new AstStreamReader;
+      ast_class_bodies->open(buf, len);
+      ast_root = ast_class_bodies->read_classes();
+  } else
+      ast_yyparse();
+  delete pass;
+
+  pass = new StatsPass("cgen");
 
   if (out_filename) {
       ofstream s(out_filename);
@@ -46,5 +63,8 @@ int main(int argc, char *argv[]) {
   } else {
       ast_root->cgen(cout);
   }
+  delete pass;
+  stats_report("cgen");
+  trace_write();
 }
 
@@ -1,32 +1,63 @@
 
 //**************************************************************
 //
-// Code generator SKELETON
-//
-// Read the comments carefully. Make sure to
-//    initialize the base class tags in
-//       `CgenClassTable::CgenClassTable'
-//
-//    Add the label for the dispatch tables to
-//       `IntEntry::code_def'
-//       `StringEntry::code_def'
-//       `BoolConst::code_def'
-//
-//    Add code to emit everyting else that is needed
-//       in `CgenClassTable::code'
-//
-//
-// The files as provided will produce code to begin the code
-// segments, declare globals, and emit constants.  You must
-// fill in the rest.
+// Code generator
+//
+// Emits MIPS assembly for spim and the Cool runtime (trap.handler):
+//
+//    - the tables indexed by class tag (class_nameTab and
+//      class_objTab), then the dispatch table and prototype object of
+//      every class that has objects, after the constants;
+//    - an init method for every class that has objects or whose
+//      descendants do, which runs the parent's init and then the
+//      initializers of the class's own attributes;
+//    - the code of every method of the classes of the program that can
+//      be called from Main.main (rapid type analysis).
+//
+// An object is laid out as
+//
+//      -1                 eye catcher, at offset -4
+//      class tag          offset 0
+//      size in words      offset 4
+//      dispatch table     offset 8
+//      attributes         offset 12, inherited attributes first
+//
+// and expressions are coded for a stack machine: the value of an
+// expression is left in ACC, and the left operand of a binary operator
+// is kept in a temporary while the right one is computed, which is a
+// register or a frame slot (method-code.h).  Ints and Bools are
+// computed as raw words where their values do not escape (code_raw),
+// and boxed where they do.  A method is called with self in ACC and its
+// arguments pushed left to right, and pops them before it returns.  Its
+// frame, which the prologue makes at once, is
+//
+//      arguments          12($fp) and up, the last one lowest
+//      saved $fp          8($fp)
+//      saved self         4($fp)
+//      saved $ra          0($fp)
+//      let and case       -4($fp) and down, a word for each at the
+//      variables          depth of its let or case; with -r the
+//                         temporaries too
+//      saved $s1-$s7      the ones the temporaries use
+//      temporaries        the slots of those not in registers
 //
 //**************************************************************
 
+#include <limits.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <sstream>
 #include "cgen.h"
 #include "cgen_gc.h"
+#include "ast-stream.h"
+#include "method-code.h"
+#include "stats.h"
 
 extern void emit_string_constant(ostream& str, char *s);
 extern int cgen_debug;
+extern int cgen_optimize;
+extern int cgen_inline_cache;
+extern bool disable_reg_alloc;
 
 //
 // Three symbols from the semantic analyzer (semant.cc) are used.
@@ -42,8 +73,16 @@ extern int cgen_debug;
 // These symbols include the primitive type and method names, as well
 // as fixed names used by the runtime system.
 //
+// coolc links semant.cc, which defines the same symbols, so there they
+// are only declared here.  Both phases enter the same names, so it does
+// not matter which initialize_constants runs first.
+//
 //////////////////////////////////////////////////////////////////////
+#ifdef COOLC
+extern Symbol
+#else
 Symbol 
+#endif
        arg,
        arg2,
        Bool,
@@ -116,6 +155,42 @@ static char *gc_collect_names[] =
 BoolConst falsebool(FALSE);
 BoolConst truebool(TRUE);
 
+//
+// Where a name in scope is kept: `offset' words from the address in
+// register `base', which is SELF for an attribute and FP for a formal
+// or a let or case variable; or, for a let variable of type Int or Bool
+// that is kept unboxed, as a raw word in the temporary `raw'.
+// `is_attribute' says the word is in the heap, so a store to it needs
+// the GC write barrier.
+//
+struct Location {
+  char *base;
+  int offset;
+  bool is_attribute;
+  char *raw;
+  Symbol type;                  // of a raw one, Int or Bool
+  Location(char *b, int o, bool attr = false)
+    : base(b), offset(o), is_attribute(attr), raw(NULL), type(NULL) { }
+  Location(char *t, Symbol ty)
+    : base(NULL), offset(0), is_attribute(false), raw(t), type(ty) { }
+};
+
+//
+// The code methods of the expressions share what they need to know
+// about the method being coded: its class, where each name in scope is
+// kept, how many of its variable words are in use and the most that
+// ever are, and its code so far with the temporaries in use.
+//
+static CgenClassTableP class_table;
+static CgenNodeP current_class;
+static SymbolTable<Symbol,Location> *scope;
+static int locals;
+static int max_locals;
+static MethodCode *method_code;
+static std::vector<char *> temps;
+static int label_count;
+static int inline_caches;       // call sites with an inline cache
+
 //*********************************************************
 //
 // Define method for code generation
@@ -224,6 +299,9 @@ static void emit_sub(char *dest, char *src1, char *src2, ostream& s)
 static void emit_sll(char *dest, char *src1, int num, ostream& s)
 { s << SLL << dest << " " << src1 << " " << num << endl; }
 
+static void emit_xori(char *dest, char *src1, int imm, ostream& s)
+{ s << XORI << dest << " " << src1 << " " << imm << endl; }
+
 static void emit_jalr(char *dest, ostream& s)
 { s << JALR << "\t" << dest << endl; }
 
@@ -292,6 +370,13 @@ static void emit_blt(char *src1, char *src2, int label, ostream &s)
   s << endl;
 }
 
+static void emit_beqi(char *src1, int imm, int label, ostream &s)
+{
+  s << BEQ << src1 << " " << imm << " ";
+  emit_label_ref(label,s);
+  s << endl;
+}
+
 static void emit_blti(char *src1, int imm, int label, ostream &s)
 {
   s << BLT << src1 << " " << imm << " ";
@@ -306,6 +391,13 @@ static void emit_bgti(char *src1, int imm, int label, ostream &s)
   s << endl;
 }
 
+static void emit_bleqi(char *src1, int imm, int label, ostream &s)
+{
+  s << BLEQ << src1 << " " << imm << " ";
+  emit_label_ref(label,s);
+  s << endl;
+}
+
 static void emit_branch(int l, ostream& s)
 {
   s << BRANCH;
@@ -322,6 +414,15 @@ static void emit_push(char *reg, ostream& str)
   emit_addiu(SP,SP,-4,str);
 }
 
+//
+// Pop the top of the stack into a register.
+//
+static void emit_pop(char *reg, ostream& str)
+{
+  emit_load(reg,1,SP,str);
+  emit_addiu(SP,SP,4,str);
+}
+
 //
 // Fetch the integer value in an Int object.
 // Emits code to fetch the integer value of the Integer object pointed
@@ -386,7 +487,6 @@ void StringEntry::code_ref(ostream& s)
 
 //
 // Emit code for a constant String.
-// You should fill in the code naming the dispatch table.
 //
 
 void StringEntry::code_def(ostream& s, int stringclasstag)
@@ -400,11 +500,7 @@ void StringEntry::code_def(ostream& s, int stringclasstag)
       << WORD << stringclasstag << endl                                 // tag
       << WORD << (DEFAULT_OBJFIELDS + STRING_SLOTS + (len+4)/4) << endl // size
       << WORD;
-
-
- /***** Add dispatch information for class String ******/
-
-      s << endl;                                              // dispatch table
+      emit_disptable_ref(Str,s);  s << endl;                  // dispatch table
       s << WORD;  lensym->code_ref(s);  s << endl;            // string length
   emit_string_constant(s,str);                                // ascii string
   s << ALIGN;                                                 // align to word
@@ -431,7 +527,6 @@ void IntEntry::code_ref(ostream &s)
 
 //
 // Emit code for a constant Integer.
-// You should fill in the code naming the dispatch table.
 //
 
 void IntEntry::code_def(ostream &s, int intclasstag)
@@ -442,11 +537,8 @@ void IntEntry::code_def(ostream &s, int intclasstag)
   code_ref(s);  s << LABEL                                // label
       << WORD << intclasstag << endl                      // class tag
       << WORD << (DEFAULT_OBJFIELDS + INT_SLOTS) << endl  // object size
-      << WORD; 
-
- /***** Add dispatch information for class Int ******/
-
-      s << endl;                                          // dispatch table
+      << WORD;
+      emit_disptable_ref(Int,s);  s << endl;              // dispatch table
       s << WORD << str << endl;                           // integer value
 }
 
@@ -475,7 +567,6 @@ void BoolConst::code_ref(ostream& s) const
   
 //
 // Emit code for a constant Bool.
-// You should fill in the code naming the dispatch table.
 //
 
 void BoolConst::code_def(ostream& s, int boolclasstag)
@@ -487,10 +578,7 @@ void BoolConst::code_def(ostream& s, int boolclasstag)
       << WORD << boolclasstag << endl                       // class tag
       << WORD << (DEFAULT_OBJFIELDS + BOOL_SLOTS) << endl   // object size
       << WORD;
-
- /***** Add dispatch information for class Bool ******/
-
-      s << endl;                                            // dispatch table
+      emit_disptable_ref(Bool,s);  s << endl;               // dispatch table
       s << WORD << val << endl;                             // value (0 or 1)
 }
 
@@ -619,16 +707,25 @@ void CgenClassTable::code_constants()
 
 CgenClassTable::CgenClassTable(Classes classes, ostream& s) : nds(NULL) , str(s)
 {
-   stringclasstag = 0 /* Change to your String class tag here */;
-   intclasstag =    0 /* Change to your Int class tag here */;
-   boolclasstag =   0 /* Change to your Bool class tag here */;
-
    enterscope();
    if (cgen_debug) cout << "Building CgenClassTable" << endl;
+   StatsPass *pass = new StatsPass("class table");
    install_basic_classes();
    install_classes(classes);
    build_inheritance_tree();
+   assign_tags(root());
+   build_layouts(root());
+   delete pass;
+
+   pass = new StatsPass("rapid type analysis");
+   find_live_code();
+   delete pass;
 
+   stringclasstag = probe(Str)->get_tag();
+   intclasstag =    probe(Int)->get_tag();
+   boolclasstag =   probe(Bool)->get_tag();
+
+   class_table = this;
    code();
    exitscope();
 }
@@ -777,8 +874,12 @@ void CgenClassTable::install_class(CgenNodeP nd)
 
 void CgenClassTable::install_classes(Classes cs)
 {
-  for(int i = cs->first(); cs->more(i); i = cs->next(i))
-    install_class(new CgenNode(cs->nth(i),NotBasic,this));
+  for(int i = cs->first(); cs->more(i); i = cs->next(i)) {
+    CgenNodeP nd = new CgenNode(cs->nth(i),NotBasic,this);
+    if (ast_class_bodies)
+      nd->set_body(i);
+    install_class(nd);
+  }
 }
 
 //
@@ -798,7 +899,7 @@ void CgenClassTable::build_inheritance_tree()
 //
 void CgenClassTable::set_relations(CgenNodeP nd)
 {
-  CgenNode *parent_node = probe(nd->get_parent());
+  CgenNode *parent_node = probe(nd->get_parent_name());
   nd->set_parentnd(parent_node);
   parent_node->add_child(nd);
 }
@@ -815,33 +916,860 @@ void CgenNode::set_parentnd(CgenNodeP p)
   parentnd = p;
 }
 
+//
+// CgenClassTable::assign_tags
+//
+// Numbers the class `nd' and then its descendants in pre-order, so that
+// the tags of a class and of all its descendants are the interval from
+// its tag to its max_tag.  Children are numbered in the order they were
+// installed.
+//
+void CgenClassTable::assign_tags(CgenNodeP nd)
+{
+  nd->set_tag(classes.size());
+  classes.push_back(nd);
+  std::vector<CgenNodeP> children;
+  for(List<CgenNode> *l = nd->get_children(); l; l = l->tl())
+    children.insert(children.begin(), l->hd());
+  for(size_t i = 0; i < children.size(); i++)
+    assign_tags(children[i]);
+  nd->set_max_tag(classes.size() - 1);
+}
+
+//
+// CgenClassTable::build_layouts
+//
+// Lays out the class `nd' and then its descendants, each from its
+// parent's layout.
+//
+void CgenClassTable::build_layouts(CgenNodeP nd)
+{
+  nd->build_layout();
+  for(List<CgenNode> *l = nd->get_children(); l; l = l->tl())
+    build_layouts(l->hd());
+}
+
+void CgenNode::build_layout()
+{
+  CgenNodeP p = parentnd;
+  if (p && p->get_name() != No_class) {
+    attr_names = p->attr_names;
+    attr_types = p->attr_types;
+    method_names = p->method_names;
+    method_classes = p->method_classes;
+    method_slots = p->method_slots;
+  }
+
+  load_features();
+  for(int i = features->first(); features->more(i); i = features->next(i)) {
+    Feature f = features->nth(i);
+    if (f->get_type() == 'a') {
+      attr_names.push_back(f->get_name());
+      attr_types.push_back(f->get_type_decl());
+      continue;
+    }
+    std::map<Symbol,int>::iterator slot = method_slots.find(f->get_name());
+    if (slot != method_slots.end()) {
+      method_classes[slot->second] = name;
+      continue;
+    }
+    method_slots[f->get_name()] = method_names.size();
+    method_names.push_back(f->get_name());
+    method_classes.push_back(name);
+  }
+  release_features();
+}
+
+//
+// The slot of method `name' in the dispatch table of the class, or -1
+// if the class has no such method.
+//
+int CgenNode::method_slot(Symbol name)
+{
+  std::map<Symbol,int>::iterator slot = method_slots.find(name);
+  return slot == method_slots.end() ? -1 : slot->second;
+}
+
+//
+// The class whose method `name' is run for every object of this class
+// and of its descendants, or NULL if they do not all run the same one
+// or there are no such objects.  Only the classes that are instantiated
+// count (find_live_code).  A dispatch on an expression of this static
+// class can then call the method directly: the whole program is known.
+// Found from the children and remembered.
+//
+Symbol CgenNode::single_implementation(Symbol name)
+{
+  std::map<Symbol,Symbol>::iterator m = implementations.find(name);
+  if (m != implementations.end())
+    return m->second;
+  Symbol impl = instantiated ? method_classes[method_slot(name)] : NULL;
+  bool same = true;
+  for(List<CgenNode> *l = children; l && same; l = l->tl())
+    if (l->hd()->is_live()) {
+      Symbol child_impl = l->hd()->single_implementation(name);
+      same = child_impl != NULL && (impl == NULL || child_impl == impl);
+      impl = child_impl;
+    }
+  if (!same)
+    impl = NULL;
+  implementations[name] = impl;
+  return impl;
+}
+
+//////////////////////////////////////////////////////////////////////
+//
+// Constant folding (-O)
+//
+// An arithmetic operation, comparison or `not' whose operands are
+// constants becomes a constant, and a conditional whose predicate is
+// constant the branch it takes.  A let variable that starts as a
+// constant and is never assigned is replaced by the constant where it is
+// used, and its binding dropped.  The rapid type analysis folds each
+// feature before it scans it, so the new Int constants are in inttable
+// when the constants are coded; code_class_bodies folds them again, as
+// a binary AST is read anew there.
+//
+// Cool's Int is 32 bits and its arithmetic overflows at run time: add,
+// sub and neg trap and mul wraps.  An operation that would overflow, or
+// divide by zero, is left for the program to do.
+//
+//////////////////////////////////////////////////////////////////////
+
+class ConstantFolder {
+private:
+  typedef std::map<Symbol,Expression> Constants;  // let variable -> value
+  std::set<Symbol> assigned;                     // in the feature
+  int constants, conditionals, propagated;
+
+  Expression fold(Expression e, const Constants& env);
+  Expression fold_let(let_class *l, const Constants& env);
+  void fold_list(Expressions& l, const Constants& env);
+  void find_assigned(Expression e);
+  Expression int_result(Expression e, long long v);
+  Expression bool_result(Expression e, bool v);
+public:
+  ConstantFolder() : constants(0), conditionals(0), propagated(0) { }
+  void fold_feature(Feature f);
+  void report();
+};
+
+static bool int_value(Expression e, long long& v)
+{
+  if (e->get_expr_type() != expr_type::EXP_INT_CONST)
+    return false;
+  v = strtoll(((int_const_class *) e)->get_token()->get_string(), NULL, 10);
+  return true;
+}
+
+static bool bool_value(Expression e, bool& v)
+{
+  if (e->get_expr_type() != expr_type::EXP_BOOL_CONST)
+    return false;
+  v = ((bool_const_class *) e)->get_val();
+  return true;
+}
+
+static bool is_constant(Expression e)
+{
+  return e->get_expr_type() == expr_type::EXP_INT_CONST ||
+         e->get_expr_type() == expr_type::EXP_BOOL_CONST ||
+         e->get_expr_type() == expr_type::EXP_STRING_CONST;
+}
+
+static bool fits_int(long long v)
+{
+  return v >= INT_MIN && v <= INT_MAX;
+}
+
+//
+// The value of a let variable with no initializer, if it is a constant.
+//
+static Expression default_constant(Symbol type)
+{
+  if (type == Int)
+    return int_const(inttable.add_int(0))->set_type(Int);
+  if (type == Bool)
+    return bool_const(false)->set_type(Bool);
+  return NULL;
+}
+
+Expression ConstantFolder::int_result(Expression e, long long v)
+{
+  constants++;
+  Expression c = int_const(inttable.add_int((int) v));
+  c->set_line_number(e->get_line_number());
+  return c->set_type(Int);
+}
+
+Expression ConstantFolder::bool_result(Expression e, bool v)
+{
+  constants++;
+  Expression c = bool_const(v);
+  c->set_line_number(e->get_line_number());
+  return c->set_type(Bool);
+}
+
+void ConstantFolder::fold_feature(Feature f)
+{
+  Expression& e = f->get_type() == 'a' ? ((attr_class *) f)->get_init_expr()
+                                       : ((method_class *) f)->get_expr();
+  assigned.clear();
+  find_assigned(e);
+  e = fold(e, Constants());
+}
+
+void ConstantFolder::report()
+{
+  stats_count("folded constants", constants);
+  stats_count("folded conditionals", conditionals);
+  stats_count("propagated constants", propagated);
+}
+
+//
+// Folds the operands of `e', and then `e' if they are constants.
+//
+Expression ConstantFolder::fold(Expression e, const Constants& env)
+{
+  long long a, b;
+  bool p, q;
+  switch (e->get_expr_type()) {
+    case expr_type::EXP_OBJECT: {
+      Constants::const_iterator c = env.find(((object_class *) e)->get_name());
+      if (c == env.end())
+        return e;
+      propagated++;
+      Expression copy = c->second->copy_Expression();
+      copy->set_line_number(e->get_line_number());
+      return copy->set_type(c->second->get_type());
+    }
+    case expr_type::EXP_ASSIGN: {
+      Expression& value = ((assign_class *) e)->get_expr();
+      value = fold(value, env);
+      return e;
+    }
+    case expr_type::EXP_STATIC_DISPATCH: {
+      static_dispatch_class *d = (static_dispatch_class *) e;
+      fold_list(d->get_args(), env);
+      d->get_expr() = fold(d->get_expr(), env);
+      return e;
+    }
+    case expr_type::EXP_DISPATCH: {
+      dispatch_class *d = (dispatch_class *) e;
+      fold_list(d->get_args(), env);
+      d->get_expr() = fold(d->get_expr(), env);
+      return e;
+    }
+    case expr_type::EXP_COND: {
+      cond_class *c = (cond_class *) e;
+      c->get_pred() = fold(c->get_pred(), env);
+      c->get_then_exp() = fold(c->get_then_exp(), env);
+      c->get_else_exp() = fold(c->get_else_exp(), env);
+      if (!bool_value(c->get_pred(), p))
+        return e;
+      conditionals++;
+      return p ? c->get_then_exp() : c->get_else_exp();
+    }
+    case expr_type::EXP_LOOP: {
+      loop_class *l = (loop_class *) e;
+      l->get_pred() = fold(l->get_pred(), env);
+      l->get_body() = fold(l->get_body(), env);
+      return e;
+    }
+    case expr_type::EXP_TYPCASE: {
+      typcase_class *c = (typcase_class *) e;
+      Cases cases = c->get_cases();
+      c->get_expr() = fold(c->get_expr(), env);
+      for(int i = cases->first(); cases->more(i); i = cases->next(i)) {
+        branch_class *b = (branch_class *) cases->nth(i);
+        Constants inner = env;
+        inner.erase(b->get_name());
+        b->get_expr() = fold(b->get_expr(), inner);
+      }
+      return e;
+    }
+    case expr_type::EXP_BLOCK:
+      fold_list(((block_class *) e)->get_expressions(), env);
+      return e;
+    case expr_type::EXP_LET:
+      return fold_let((let_class *) e, env);
+    case expr_type::EXP_PLUS:
+    case expr_type::EXP_SUB:
+    case expr_type::EXP_MUL:
+    case expr_type::EXP_DIVIDE:
+    case expr_type::EXP_LT:
+    case expr_type::EXP_LEQ: {
+      // These all keep their operands in the same places as plus.
+      Expression& e1 = ((plus_class *) e)->get_first_expression();
+      Expression& e2 = ((plus_class *) e)->get_second_expression();
+      e1 = fold(e1, env);
+      e2 = fold(e2, env);
+      if (!int_value(e1, a) || !int_value(e2, b))
+        return e;
+      switch (e->get_expr_type()) {
+        case expr_type::EXP_PLUS:
+          return fits_int(a + b) ? int_result(e, a + b) : e;
+        case expr_type::EXP_SUB:
+          return fits_int(a - b) ? int_result(e, a - b) : e;
+        case expr_type::EXP_MUL:
+          return fits_int(a * b) ? int_result(e, a * b) : e;
+        case expr_type::EXP_DIVIDE:
+          return b != 0 && fits_int(a / b) ? int_result(e, a / b) : e;
+        case expr_type::EXP_LT:
+          return bool_result(e, a < b);
+        default:
+          return bool_result(e, a <= b);
+      }
+    }
+    case expr_type::EXP_EQ: {
+      Expression& e1 = ((eq_class *) e)->get_first_expression();
+      Expression& e2 = ((eq_class *) e)->get_second_expression();
+      e1 = fold(e1, env);
+      e2 = fold(e2, env);
+      if (int_value(e1, a) && int_value(e2, b))
+        return bool_result(e, a == b);
+      if (bool_value(e1, p) && bool_value(e2, q))
+        return bool_result(e, p == q);
+      if (e1->get_expr_type() == expr_type::EXP_STRING_CONST &&
+          e2->get_expr_type() == expr_type::EXP_STRING_CONST)
+        return bool_result(e, ((string_const_class *) e1)->get_token() ==
+                              ((string_const_class *) e2)->get_token());
+      return e;
+    }
+    case expr_type::EXP_NEG: {
+      Expression& e1 = ((neg_class *) e)->get_expr();
+      e1 = fold(e1, env);
+      return int_value(e1, a) && fits_int(-a) ? int_result(e, -a) : e;
+    }
+    case expr_type::EXP_COMP: {
+      Expression& e1 = ((comp_class *) e)->get_expression();
+      e1 = fold(e1, env);
+      return bool_value(e1, p) ? bool_result(e, !p) : e;
+    }
+    case expr_type::EXP_ISVOID: {
+      Expression& e1 = ((isvoid_class *) e)->get_expr();
+      e1 = fold(e1, env);
+      return e;
+    }
+    default:
+      return e;
+  }
+}
+
+//
+// A list is rebuilt, flat, only once one of its elements is replaced;
+// the elements before that one are taken over as they are.
+//
+void ConstantFolder::fold_list(Expressions& l, const Constants& env)
+{
+  list_buffer<Expression> *folded = NULL;
+  for(int i = l->first(); l->more(i); i = l->next(i)) {
+    Expression e = l->nth(i);
+    Expression f = fold(e, env);
+    if (f != e && !folded) {
+      folded = new list_buffer<Expression>;
+      for(int j = l->first(); j < i; j = l->next(j))
+        folded->add(l->nth(j));
+    }
+    if (folded)
+      folded->add(f);
+  }
+  if (folded)
+    l = finish_list(folded);
+}
+
+//
+// The bindings are taken in order, each in the scope of those before it.
+// Those that are dropped leave a let with the rest, or just the body.
+//
+Expression ConstantFolder::fold_let(let_class *l, const Constants& env)
+{
+  Constants inner = env;
+  Bindings bindings = l->get_bindings();
+  list_buffer<Binding> *kept = NULL;      // once one is dropped
+  for(int i = bindings->first(); bindings->more(i); i = bindings->next(i)) {
+    binding_class *b = (binding_class *) bindings->nth(i);
+    Expression& init = b->get_init_expr();
+    init = fold(init, inner);
+    Symbol x = b->get_identifier();
+    inner.erase(x);
+    Expression value = init->get_expr_type() == expr_type::EXP_NO_EXPR
+                         ? default_constant(b->get_type_decl()) : init;
+    if (value && is_constant(value) && !assigned.count(x)) {
+      inner[x] = value;
+      if (!kept) {
+        kept = new list_buffer<Binding>;
+        for(int j = bindings->first(); j < i; j = bindings->next(j))
+          kept->add(bindings->nth(j));
+      }
+      continue;
+    }
+    if (kept)
+      kept->add(b);
+  }
+  l->get_body() = fold(l->get_body(), inner);
+  if (!kept)
+    return l;
+  Bindings rest = finish_list(kept);
+  if (rest->len() == 0)
+    return l->get_body();
+  Expression folded = let(rest, l->get_body());
+  folded->set_line_number(l->get_line_number());
+  return folded->set_type(l->get_type());
+}
+
+//
+// Records the variables that `e' assigns.
+//
+void ConstantFolder::find_assigned(Expression e)
+{
+  switch (e->get_expr_type()) {
+    case expr_type::EXP_ASSIGN:
+      assigned.insert(((assign_class *) e)->get_name());
+      find_assigned(((assign_class *) e)->get_expr());
+      break;
+    case expr_type::EXP_STATIC_DISPATCH: {
+      static_dispatch_class *d = (static_dispatch_class *) e;
+      Expressions args = d->get_args();
+      for(int i = args->first(); args->more(i); i = args->next(i))
+        find_assigned(args->nth(i));
+      find_assigned(d->get_expr());
+      break;
+    }
+    case expr_type::EXP_DISPATCH: {
+      dispatch_class *d = (dispatch_class *) e;
+      Expressions args = d->get_args();
+      for(int i = args->first(); args->more(i); i = args->next(i))
+        find_assigned(args->nth(i));
+      find_assigned(d->get_expr());
+      break;
+    }
+    case expr_type::EXP_COND:
+      find_assigned(((cond_class *) e)->get_pred());
+      find_assigned(((cond_class *) e)->get_then_exp());
+      find_assigned(((cond_class *) e)->get_else_exp());
+      break;
+    case expr_type::EXP_LOOP:
+      find_assigned(((loop_class *) e)->get_pred());
+      find_assigned(((loop_class *) e)->get_body());
+      break;
+    case expr_type::EXP_TYPCASE: {
+      Cases cases = ((typcase_class *) e)->get_cases();
+      find_assigned(((typcase_class *) e)->get_expr());
+      for(int i = cases->first(); cases->more(i); i = cases->next(i))
+        find_assigned(((branch_class *) cases->nth(i))->get_expr());
+      break;
+    }
+    case expr_type::EXP_BLOCK: {
+      Expressions body = ((block_class *) e)->get_expressions();
+      for(int i = body->first(); body->more(i); i = body->next(i))
+        find_assigned(body->nth(i));
+      break;
+    }
+    case expr_type::EXP_LET: {
+      let_class *l = (let_class *) e;
+      Bindings bindings = l->get_bindings();
+      for(int i = bindings->first(); bindings->more(i); i = bindings->next(i))
+        find_assigned(((binding_class *) bindings->nth(i))->get_init_expr());
+      find_assigned(l->get_body());
+      break;
+    }
+    case expr_type::EXP_PLUS:
+    case expr_type::EXP_SUB:
+    case expr_type::EXP_MUL:
+    case expr_type::EXP_DIVIDE:
+    case expr_type::EXP_LT:
+    case expr_type::EXP_LEQ:
+      find_assigned(((plus_class *) e)->get_first_expression());
+      find_assigned(((plus_class *) e)->get_second_expression());
+      break;
+    case expr_type::EXP_EQ:
+      find_assigned(((eq_class *) e)->get_first_expression());
+      find_assigned(((eq_class *) e)->get_second_expression());
+      break;
+    case expr_type::EXP_NEG:
+      find_assigned(((neg_class *) e)->get_expr());
+      break;
+    case expr_type::EXP_COMP:
+      find_assigned(((comp_class *) e)->get_expression());
+      break;
+    case expr_type::EXP_ISVOID:
+      find_assigned(((isvoid_class *) e)->get_expr());
+      break;
+    default:
+      break;
+  }
+}
+
+//////////////////////////////////////////////////////////////////////
+//
+// Rapid type analysis
+//
+// Starting from Main.main, the bodies of the methods that can be called
+// are scanned for `new' and for dispatches.  A `new' instantiates its
+// class, which makes the attribute initializers of the class and its
+// ancestors live; a dispatch on static class T makes the method live in
+// every instantiated class in T's subtree, including the ones
+// instantiated later; a static dispatch makes the one method it calls
+// live.  Int, Bool and String are instantiated by the constants and the
+// runtime.
+//
+// Only the live code is emitted: prototypes and dispatch tables for the
+// instantiated classes, init methods for the live ones, and the live
+// methods.  A slot of a dispatch table whose method is never called
+// holds 0.  The basic classes are always emitted whole.
+//
+//////////////////////////////////////////////////////////////////////
+
+static bool earlier_class(const std::pair<CgenNodeP,Symbol>& a,
+                          const std::pair<CgenNodeP,Symbol>& b)
+{
+  return a.first->get_tag() < b.first->get_tag();
+}
+
+void CgenClassTable::find_live_code()
+{
+  instantiate(probe(Int));
+  instantiate(probe(Bool));
+  instantiate(probe(Str));
+  instantiate(probe(Main));
+  add_live_method(probe(Main), main_meth);
+
+  // Scan what was found to be live, a round at a time; the work of a
+  // round is taken in tag order, so that each class has its features
+  // read once a round.
+  ConstantFolder folder;
+  while (!pending.empty()) {
+    std::vector<std::pair<CgenNodeP,Symbol> > work;
+    work.swap(pending);
+    std::stable_sort(work.begin(), work.end(), earlier_class);
+    for(size_t i = 0; i < work.size(); ) {
+      CgenNodeP nd = work[i].first;
+      nd->load_features();
+      Features features = nd->get_features();
+      for( ; i < work.size() && work[i].first == nd; i++)
+        for(int j = features->first(); features->more(j); j = features->next(j)) {
+          Feature f = features->nth(j);
+          if (work[i].second == NULL && f->get_type() == 'a') {
+            if (cgen_optimize)
+              folder.fold_feature(f);
+            find_uses(((attr_class *) f)->get_init_expr(), nd);
+          } else if (f->get_type() == 'm' && f->get_name() == work[i].second) {
+            if (cgen_optimize)
+              folder.fold_feature(f);
+            find_uses(((method_class *) f)->get_expr(), nd);
+          }
+        }
+      nd->release_features();
+    }
+  }
+
+  int pruned = 0, dead = 0;
+  for(size_t i = 0; i < classes.size(); i++) {
+    CgenNodeP nd = classes[i];
+    if (nd->basic())
+      continue;
+    if (!nd->is_live())
+      pruned++;
+    for(int j = 0; j < nd->method_count(); j++)
+      if (nd->get_method_class(j) == nd->get_name() &&
+          !nd->method_live(nd->get_method_name(j)))
+        dead++;
+  }
+  stats_count("pruned classes", pruned);
+  stats_count("dead methods", dead);
+  if (cgen_optimize)
+    folder.report();
+}
+
+void CgenClassTable::instantiate(CgenNodeP nd)
+{
+  if (nd->is_instantiated())
+    return;
+  nd->set_instantiated();
+  for(CgenNodeP p = nd; p->get_name() != No_class && !p->is_live();
+      p = p->get_parentnd()) {
+    p->set_live();
+    if (!p->basic())
+      pending.push_back(std::make_pair(p, (Symbol) NULL));
+  }
+  std::set<std::pair<CgenNodeP,Symbol> >::iterator site;
+  for(site = call_sites.begin(); site != call_sites.end(); ++site)
+    if (site->first->get_tag() <= nd->get_tag() &&
+        nd->get_tag() <= site->first->get_max_tag())
+      add_live_method(lookup(nd->get_method_class(nd->method_slot(site->second))),
+                      site->second);
+}
+
+void CgenClassTable::add_call_site(CgenNodeP nd, Symbol method)
+{
+  if (!call_sites.insert(std::make_pair(nd, method)).second)
+    return;
+  int slot = nd->method_slot(method);
+  for(int t = nd->get_tag(); t <= nd->get_max_tag(); t++)
+    if (classes[t]->is_instantiated())
+      add_live_method(lookup(classes[t]->get_method_class(slot)), method);
+}
+
+void CgenClassTable::add_live_method(CgenNodeP nd, Symbol method)
+{
+  if (nd->add_live_method(method) && !nd->basic())
+    pending.push_back(std::make_pair(nd, method));
+}
+
+//
+// Records the classes that `e', in a feature of `in_class', instantiates
+// and the methods it calls.
+//
+void CgenClassTable::find_uses(Expression e, CgenNodeP in_class)
+{
+  switch (e->get_expr_type()) {
+    case expr_type::EXP_ASSIGN:
+      find_uses(((assign_class *) e)->get_expr(), in_class);
+      break;
+    case expr_type::EXP_STATIC_DISPATCH: {
+      static_dispatch_class *d = (static_dispatch_class *) e;
+      Expressions args = d->get_args();
+      for(int i = args->first(); args->more(i); i = args->next(i))
+        find_uses(args->nth(i), in_class);
+      find_uses(d->get_expr(), in_class);
+      CgenNodeP nd = lookup(d->get_type_name());
+      add_live_method(lookup(nd->get_method_class(nd->method_slot(d->get_name()))),
+                      d->get_name());
+      break;
+    }
+    case expr_type::EXP_DISPATCH: {
+      dispatch_class *d = (dispatch_class *) e;
+      Expressions args = d->get_args();
+      for(int i = args->first(); args->more(i); i = args->next(i))
+        find_uses(args->nth(i), in_class);
+      find_uses(d->get_expr(), in_class);
+      Symbol type = d->get_expr()->get_type();
+      add_call_site(type == SELF_TYPE ? in_class : lookup(type), d->get_name());
+      break;
+    }
+    case expr_type::EXP_COND: {
+      cond_class *c = (cond_class *) e;
+      find_uses(c->get_pred(), in_class);
+      find_uses(c->get_then_exp(), in_class);
+      find_uses(c->get_else_exp(), in_class);
+      break;
+    }
+    case expr_type::EXP_LOOP:
+      find_uses(((loop_class *) e)->get_pred(), in_class);
+      find_uses(((loop_class *) e)->get_body(), in_class);
+      break;
+    case expr_type::EXP_TYPCASE: {
+      typcase_class *c = (typcase_class *) e;
+      Cases cases = c->get_cases();
+      find_uses(c->get_expr(), in_class);
+      for(int i = cases->first(); cases->more(i); i = cases->next(i))
+        find_uses(((branch_class *) cases->nth(i))->get_expr(), in_class);
+      break;
+    }
+    case expr_type::EXP_BLOCK: {
+      Expressions body = ((block_class *) e)->get_expressions();
+      for(int i = body->first(); body->more(i); i = body->next(i))
+        find_uses(body->nth(i), in_class);
+      break;
+    }
+    case expr_type::EXP_LET: {
+      let_class *l = (let_class *) e;
+      Bindings bindings = l->get_bindings();
+      for(int i = bindings->first(); bindings->more(i); i = bindings->next(i))
+        find_uses(((binding_class *) bindings->nth(i))->get_init_expr(), in_class);
+      find_uses(l->get_body(), in_class);
+      break;
+    }
+    case expr_type::EXP_PLUS:
+      find_uses(((plus_class *) e)->get_first_expression(), in_class);
+      find_uses(((plus_class *) e)->get_second_expression(), in_class);
+      break;
+    case expr_type::EXP_SUB:
+      find_uses(((sub_class *) e)->get_first_expression(), in_class);
+      find_uses(((sub_class *) e)->get_second_expression(), in_class);
+      break;
+    case expr_type::EXP_MUL:
+      find_uses(((mul_class *) e)->get_first_expression(), in_class);
+      find_uses(((mul_class *) e)->get_second_expression(), in_class);
+      break;
+    case expr_type::EXP_DIVIDE:
+      find_uses(((divide_class *) e)->get_first_expression(), in_class);
+      find_uses(((divide_class *) e)->get_second_expression(), in_class);
+      break;
+    case expr_type::EXP_LT:
+      find_uses(((lt_class *) e)->get_first_expression(), in_class);
+      find_uses(((lt_class *) e)->get_second_expression(), in_class);
+      break;
+    case expr_type::EXP_EQ:
+      find_uses(((eq_class *) e)->get_first_expression(), in_class);
+      find_uses(((eq_class *) e)->get_second_expression(), in_class);
+      break;
+    case expr_type::EXP_LEQ:
+      find_uses(((leq_class *) e)->get_first_expression(), in_class);
+      find_uses(((leq_class *) e)->get_second_expression(), in_class);
+      break;
+    case expr_type::EXP_NEG:
+      find_uses(((neg_class *) e)->get_expr(), in_class);
+      break;
+    case expr_type::EXP_COMP:
+      find_uses(((comp_class *) e)->get_expression(), in_class);
+      break;
+    case expr_type::EXP_ISVOID:
+      find_uses(((isvoid_class *) e)->get_expr(), in_class);
+      break;
+    case expr_type::EXP_NEW_: {
+      // new SELF_TYPE makes another object of the class of self, which
+      // is instantiated already.
+      Symbol type = ((new__class *) e)->get_type_name();
+      if (type != SELF_TYPE)
+        instantiate(lookup(type));
+      break;
+    }
+    default:
+      break;
+  }
+}
+
 
 
+//
+// The inline caches of the call sites (emit_inline_cache_dispatch)
+// follow the code in the data segment.  Each starts with tag -1, which
+// no class has.
+//
+static void code_inline_caches(ostream& s)
+{
+  stats_count("inline caches", inline_caches);
+  if (inline_caches == 0)
+    return;
+  s << "\t.data\n" << ALIGN;
+  for (int n = 0; n < inline_caches; n++) {
+    s << INLINECACHE_PREFIX << n << LABEL;
+    s << WORD << -1 << endl;
+    s << WORD << 0 << endl;
+  }
+}
+
 void CgenClassTable::code()
 {
   if (cgen_debug) cout << "coding global data" << endl;
+  StatsPass *pass = new StatsPass("global data");
   code_global_data();
 
   if (cgen_debug) cout << "choosing gc" << endl;
   code_select_gc();
+  delete pass;
 
   if (cgen_debug) cout << "coding constants" << endl;
+  pass = new StatsPass("constants");
   code_constants();
+  delete pass;
 
-//                 Add your code to emit
-//                   - prototype objects
-//                   - class_nameTab
-//                   - dispatch tables
-//
+  if (cgen_debug) cout << "coding class tables" << endl;
+  pass = new StatsPass("class tables");
+  code_class_tables();
+  code_dispatch_tables();
+  code_prototypes();
+  delete pass;
 
   if (cgen_debug) cout << "coding global text" << endl;
+  pass = new StatsPass("global text");
   code_global_text();
+  delete pass;
 
-//                 Add your code to emit
-//                   - object initializer
-//                   - the class methods
-//                   - etc...
+  if (cgen_debug) cout << "coding class bodies" << endl;
+  pass = new StatsPass("code");
+  code_class_bodies();
+  code_inline_caches(str);
+  delete pass;
+}
 
+//
+// Only the classes with objects have a prototype object and a dispatch
+// table (find_live_code).
+//
+static bool has_prototype(CgenNodeP nd)
+{
+  return nd->basic() || nd->is_instantiated();
+}
+
+//
+// class_nameTab holds the name of each class, as a String constant;
+// and class_objTab its prototype object and init method, for new
+// SELF_TYPE, or 0 and 0 for a class with no objects.  Both are indexed
+// by class tag.
+//
+void CgenClassTable::code_class_tables()
+{
+  str << CLASSNAMETAB << LABEL;
+  for(size_t i = 0; i < classes.size(); i++) {
+    str << WORD;
+    stringtable.lookup_string(classes[i]->get_name()->get_string())->code_ref(str);
+    str << endl;
+  }
+
+  str << CLASSOBJTAB << LABEL;
+  for(size_t i = 0; i < classes.size(); i++) {
+    if (!has_prototype(classes[i])) {
+      str << WORD << 0 << endl << WORD << 0 << endl;
+      continue;
+    }
+    str << WORD;  emit_protobj_ref(classes[i]->get_name(),str);  str << endl;
+    str << WORD;  emit_init_ref(classes[i]->get_name(),str);  str << endl;
+  }
+}
+
+void CgenClassTable::code_dispatch_tables()
+{
+  for(size_t i = 0; i < classes.size(); i++)
+    if (has_prototype(classes[i]))
+      classes[i]->code_disptab(str);
+}
+
+void CgenClassTable::code_prototypes()
+{
+  for(size_t i = 0; i < classes.size(); i++)
+    if (has_prototype(classes[i]))
+      classes[i]->code_prototype(str);
+}
+
+//
+// Folds the features of a class decoded afresh from a binary AST; those
+// find_live_code folded were released after it scanned them.
+//
+static void fold_constants(Features features)
+{
+  ConstantFolder folder;
+  for(int i = features->first(); features->more(i); i = features->next(i))
+    folder.fold_feature(features->nth(i));
+}
+
+//
+// Codes the init method of every live class, and the live methods of
+// the classes of the program, one class at a time.  A class that is not
+// live can still have live methods, named by a static dispatch on an
+// object that can then only be void.  When the AST came in binary, only
+// the class being coded has its features in memory; the others have
+// just their name, parent and file name.
+//
+void CgenClassTable::code_class_bodies()
+{
+  for(size_t i = 0; i < classes.size(); i++) {
+    CgenNodeP nd = classes[i];
+    bool live = nd->basic() || nd->is_live();
+    if (!live && !nd->has_live_methods())
+      continue;
+    TRACE_SCOPE("code", nd->get_name()->get_string());
+    nd->load_features();
+    if (cgen_optimize && nd->features_decoded())
+      fold_constants(nd->get_features());
+    if (live)
+      nd->code_init(str);
+    if (!nd->basic())
+      nd->code_methods(str);
+    nd->release_features();
+  }
 }
 
 
@@ -861,71 +1789,1117 @@ CgenNode::CgenNode(Class_ nd, Basicness bstatus, CgenClassTableP ct) :
    class__class((const class__class &) *nd),
    parentnd(NULL),
    children(NULL),
-   basic_status(bstatus)
+   basic_status(bstatus),
+   body(-1),
+   tag(-1),
+   max_tag(-1),
+   instantiated(false),
+   live(false)
 { 
+   no_features = features;
    stringtable.add_string(name->get_string());          // Add class name to string table
+   stringtable.add_string(filename->get_string());      // and file name, for aborts
+}
+
+//
+// With a binary AST the features of a class are decoded only while the
+// class is coded; see cgen-phase.cc.
+//
+void CgenNode::load_features()
+{
+  if (body >= 0)
+    features = ast_class_bodies->read_features(body);
+}
+
+void CgenNode::release_features()
+{
+  if (body >= 0) {
+    ast_class_bodies->release();
+    features = no_features;
+  }
+}
+
+void CgenNode::code_disptab(ostream& s)
+{
+  emit_disptable_ref(name,s);  s << LABEL;
+  for(size_t i = 0; i < method_names.size(); i++) {
+    CgenNodeP impl = class_table->lookup(method_classes[i]);
+    if (!impl->basic() && !impl->method_live(method_names[i])) {
+      s << WORD << 0 << endl;
+      continue;
+    }
+    s << WORD;  emit_method_ref(method_classes[i],method_names[i],s);  s << endl;
+  }
+}
+
+//
+// An attribute of type Int, String or Bool starts as the constant 0,
+// "" or false; any other starts void.
+//
+static void emit_default_value(Symbol type, ostream& s)
+{
+  if (type == Int)
+    inttable.lookup_string("0")->code_ref(s);
+  else if (type == Str)
+    stringtable.lookup_string("")->code_ref(s);
+  else if (type == Bool)
+    falsebool.code_ref(s);
+  else
+    s << EMPTYSLOT;
+}
+
+void CgenNode::code_prototype(ostream& s)
+{
+  s << WORD << "-1" << endl;                                  // eye catcher
+  emit_protobj_ref(name,s);  s << LABEL
+    << WORD << tag << endl                                    // class tag
+    << WORD << (DEFAULT_OBJFIELDS + attr_names.size()) << endl  // size
+    << WORD;  emit_disptable_ref(name,s);  s << endl;         // dispatch table
+  for(size_t i = 0; i < attr_types.size(); i++) {
+    s << WORD;  emit_default_value(attr_types[i],s);  s << endl;
+  }
+}
+
+//
+// The prologue of a method saves the caller's frame pointer, self and
+// return address, makes room for the `frame' words its temporaries need
+// (MethodCode::frame_words), points FP at the saved return address and
+// puts self in SELF.  The epilogue undoes this and pops the `nargs'
+// arguments.
+//
+static void emit_prologue(int frame, ostream& s)
+{
+  emit_addiu(SP,SP,-(FRAME_SAVED + frame) * WORD_SIZE,s);
+  emit_store(FP,frame + 3,SP,s);
+  emit_store(SELF,frame + 2,SP,s);
+  emit_store(RA,frame + 1,SP,s);
+  emit_addiu(FP,SP,(frame + 1) * WORD_SIZE,s);
+  emit_move(SELF,ACC,s);
+}
+
+static void emit_epilogue(int nargs, ostream& s)
+{
+  emit_load(RA,0,FP,s);
+  emit_load(SELF,1,FP,s);
+  emit_addiu(SP,FP,(FRAME_SAVED - 1 + nargs) * WORD_SIZE,s);
+  emit_load(FP,2,FP,s);
+  emit_return(s);
+}
+
+//
+// A method is coded to a string first, which MethodCode reads back, so
+// that the size of its frame is known before the prologue is written:
+// its let and case variables, and its temporaries with their registers
+// and slots.
+//
+static void begin_method()
+{
+  method_code = new MethodCode();
+  locals = max_locals = 0;
+}
+
+static void end_method(const std::string& body, int nargs, ostream& s)
+{
+  method_code->read(body);
+  method_code->set_locals(max_locals);
+  if (!disable_reg_alloc)
+    method_code->allocate_registers();
+  if (cgen_optimize)
+    method_code->peephole();
+  emit_prologue(method_code->frame_words(),s);
+  method_code->emit_save_registers(s);
+  method_code->write(s);
+  method_code->emit_restore_registers(s);
+  emit_epilogue(nargs,s);
+  delete method_code;
+  method_code = NULL;
+}
+
+//
+// The frame offset of a new variable word, at the present depth.
+//
+static int new_local()
+{
+  locals++;
+  if (locals > max_locals)
+    max_locals = locals;
+  return -locals;
+}
+
+//
+// A value kept while another is computed goes to a new temporary, or
+// with -r to a variable word.  `raw' is for one that is not a pointer.
+//
+static void push_temp(char *reg, ostream& s, bool raw = false)
+{
+  if (disable_reg_alloc) {
+    emit_store(reg,new_local(),FP,s);
+    return;
+  }
+  char *t = method_code->new_temp(raw);
+  emit_move(t,reg,s);
+  temps.push_back(t);
+}
+
+static void pop_temp(char *reg, ostream& s)
+{
+  if (disable_reg_alloc) {
+    emit_load(reg,-locals,FP,s);
+    locals--;
+    return;
+  }
+  emit_move(reg,temps.back(),s);
+  temps.pop_back();
+}
+
+//
+// Stores ACC in a new variable word and binds `name' to it.
+//
+static void push_local(Symbol name, ostream& s)
+{
+  int offset = new_local();
+  scope->addid(name, new Location(FP, offset));
+  emit_store(ACC,offset,FP,s);
+}
+
+//
+// Enters the attributes of the class in scope, for its init method and
+// methods.
+//
+static void enter_attributes(CgenNodeP nd)
+{
+  scope = new SymbolTable<Symbol,Location>();
+  scope->enterscope();
+  for(int i = 0; i < nd->attr_count(); i++)
+    scope->addid(nd->get_attr_name(i),
+                 new Location(SELF, DEFAULT_OBJFIELDS + i, true));
+}
+
+//
+// The init method of a class runs its parent's and then the
+// initializers of the attributes the class defines, in order, and
+// returns self.
+//
+void CgenNode::code_init(ostream& s)
+{
+  current_class = this;
+  enter_attributes(this);
+  emit_init_ref(name,s);  s << LABEL;
+  begin_method();
+  std::ostringstream body;
+  if (parentnd->get_name() != No_class) {
+    body << JAL;  emit_init_ref(parentnd->get_name(),body);  body << endl;
+  }
+  for(int i = features->first(); features->more(i); i = features->next(i))
+    if (features->nth(i)->get_type() == 'a')
+      features->nth(i)->code(body);
+  emit_move(ACC,SELF,body);
+  end_method(body.str(),0,s);
+  delete scope;
+}
+
+void CgenNode::code_methods(ostream& s)
+{
+  current_class = this;
+  enter_attributes(this);
+  for(int i = features->first(); features->more(i); i = features->next(i))
+    if (features->nth(i)->get_type() == 'm' &&
+        method_live(features->nth(i)->get_name()))
+      features->nth(i)->code(s);
+  delete scope;
 }
 
 
 //******************************************************************
 //
-//   Fill in the following methods to produce code for the
-//   appropriate expression.  You may add or remove parameters
-//   as you wish, but if you do, remember to change the parameters
-//   of the declarations in `cool-tree.h'  Sample code for
-//   constant integers, strings, and booleans are provided.
+//   Code for the features and expressions.  The value of every
+//   expression is left in ACC.
 //
 //*****************************************************************
 
-void assign_class::code(ostream &s) {
+void method_class::code(ostream &s)
+{
+  emit_method_ref(current_class->get_name(),name,s);  s << LABEL;
+  begin_method();
+
+  int nformals = formals->len();
+  scope->enterscope();
+  for(int i = formals->first(); formals->more(i); i = formals->next(i))
+    scope->addid(formals->nth(i)->get_name(),
+                 new Location(FP, FRAME_SAVED + nformals - 1 - i));
+  std::ostringstream body;
+  expr->code(body);
+  scope->exitscope();
+
+  end_method(body.str(),nformals,s);
 }
 
-void static_dispatch_class::code(ostream &s) {
+//
+// Stores the value of the initializer, if there is one, in the
+// attribute; the prototype object holds its default value.
+//
+void attr_class::code(ostream &s)
+{
+  if (init->get_expr_type() == expr_type::EXP_NO_EXPR)
+    return;
+  init->code(s);
+  Location *loc = scope->lookup(name);
+  emit_store(ACC,loc->offset,loc->base,s);
+  if (cgen_Memmgr != GC_NOGC) {
+    emit_addiu(A1,loc->base,loc->offset * WORD_SIZE,s);
+    emit_gc_assign(s);
+  }
+}
+
+//
+// Unboxed Ints and Bools
+//
+// An Int or Bool is computed as a raw word, 0 or 1 for a Bool, wherever
+// it does not escape: the operands of the arithmetic and comparisons,
+// the predicates of conditionals and loops, and the let variables of
+// type Int or Bool that keep_unboxed picks, which are kept in raw
+// temporaries.  A value is boxed only where it escapes, into an
+// attribute, an argument, a return value or a case: a new Int takes a
+// copy of Int's prototype, a Bool is one of the two constants
+// (emit_box).
+//
+// Each expression is coded for the use of its value: code() leaves the
+// object in ACC, code_raw the raw word, and code_effect whatever, for
+// an expression whose value is not used.
+//
+enum Use { BOXED, RAW, EFFECT };
+
+static void code_raw(Expression e, ostream& s);
+static void code_effect(Expression e, ostream& s);
+static void code_cond(cond_class *c, Use use, ostream& s);
+static void code_block(block_class *b, Use use, ostream& s);
+static void code_let(let_class *l, Use use, ostream& s);
+
+static void code_in(Expression e, Use use, ostream& s)
+{
+  switch (use) {
+    case BOXED:   e->code(s);           break;
+    case RAW:     code_raw(e,s);        break;
+    case EFFECT:  code_effect(e,s);     break;
+  }
 }
 
-void dispatch_class::code(ostream &s) {
+static bool has_raw_value(Expression e)
+{
+  return e->get_type() == Int || e->get_type() == Bool;
 }
 
-void cond_class::code(ostream &s) {
+//
+// Replaces the raw Int or Bool in ACC by an object.
+//
+static void emit_box(Symbol type, ostream& s)
+{
+  if (type == Bool) {
+    int label = label_count++;
+    emit_move(T1,ACC,s);
+    emit_load_bool(ACC,falsebool,s);
+    emit_beqz(T1,label,s);
+    emit_load_bool(ACC,truebool,s);
+    emit_label_def(label,s);
+    return;
+  }
+  push_temp(ACC,s,true);
+  emit_partial_load_address(ACC,s);  emit_protobj_ref(Int,s);  s << endl;
+  emit_jal("Object.copy",s);
+  pop_temp(T1,s);
+  emit_store_int(T1,ACC,s);
+}
+
+//
+// The raw temporary that holds variable `e', if it is one.
+//
+static Location *raw_variable(Expression e)
+{
+  if (e->get_expr_type() != expr_type::EXP_OBJECT)
+    return NULL;
+  Symbol name = ((object_class *) e)->get_name();
+  if (name == self)
+    return NULL;
+  Location *loc = scope->lookup(name);
+  return loc->raw ? loc : NULL;
 }
 
-void loop_class::code(ostream &s) {
+//
+// Puts the raw value of `e' in `reg' if that takes one instruction: a
+// constant or an unboxed variable.
+//
+static bool load_raw_operand(Expression e, char *reg, ostream& s)
+{
+  Location *loc;
+  switch (e->get_expr_type()) {
+    case expr_type::EXP_INT_CONST:
+      emit_load_imm(reg,atoi(((int_const_class *) e)->get_token()->get_string()),s);
+      return true;
+    case expr_type::EXP_BOOL_CONST:
+      emit_load_imm(reg,((bool_const_class *) e)->get_val(),s);
+      return true;
+    case expr_type::EXP_OBJECT:
+      if (!(loc = raw_variable(e)))
+        return false;
+      emit_move(reg,loc->raw,s);
+      return true;
+    default:
+      return false;
+  }
+}
+
+//
+// Computes the raw values of `e1' and `e2', and names the registers
+// they are left in.  The left one is kept in a temporary while the right
+// one is computed, unless the right one takes one instruction.  Returns
+// true if the left one is left in ACC (and the right in T1), false if
+// the right one is (and the left in T1).
+//
+static bool code_raw_operands(Expression e1, Expression e2,
+                              char *&a, char *&b, ostream& s)
+{
+  code_raw(e1,s);
+  if (load_raw_operand(e2,T1,s)) {
+    a = ACC;
+    b = T1;
+    return true;
+  }
+  push_temp(ACC,s,true);
+  code_raw(e2,s);
+  pop_temp(T1,s);
+  a = T1;
+  b = ACC;
+  return false;
+}
+
+static void code_raw_binary(Expression e1, Expression e2, char *op, ostream& s)
+{
+  char *a, *b;
+  code_raw_operands(e1,e2,a,b,s);
+  s << op << ACC << " " << a << " " << b << endl;
 }
 
-void typcase_class::code(ostream &s) {
+//
+// Leaves the raw value of the Int or Bool expression `e' in ACC: the
+// arithmetic, comparisons and `not' compute it, an unboxed variable
+// holds it; any other expression is coded as usual and its object
+// unboxed.
+//
+static void code_raw(Expression e, ostream& s)
+{
+  if (load_raw_operand(e,ACC,s))
+    return;
+  switch (e->get_expr_type()) {
+    case expr_type::EXP_ASSIGN: {
+      assign_class *a = (assign_class *) e;
+      Location *loc = scope->lookup(a->get_name());
+      if (!loc->raw)
+        break;
+      code_raw(a->get_expr(),s);
+      emit_move(loc->raw,ACC,s);
+      return;
+    }
+    case expr_type::EXP_COND:
+      code_cond((cond_class *) e,RAW,s);
+      return;
+    case expr_type::EXP_BLOCK:
+      code_block((block_class *) e,RAW,s);
+      return;
+    case expr_type::EXP_LET:
+      code_let((let_class *) e,RAW,s);
+      return;
+    case expr_type::EXP_PLUS:
+      code_raw_binary(((plus_class *) e)->get_first_expression(),
+                      ((plus_class *) e)->get_second_expression(),ADD,s);
+      return;
+    case expr_type::EXP_SUB:
+      code_raw_binary(((sub_class *) e)->get_first_expression(),
+                      ((sub_class *) e)->get_second_expression(),SUB,s);
+      return;
+    case expr_type::EXP_MUL:
+      code_raw_binary(((mul_class *) e)->get_first_expression(),
+                      ((mul_class *) e)->get_second_expression(),MUL,s);
+      return;
+    case expr_type::EXP_DIVIDE:
+      code_raw_binary(((divide_class *) e)->get_first_expression(),
+                      ((divide_class *) e)->get_second_expression(),DIV,s);
+      return;
+    case expr_type::EXP_LT:
+      code_raw_binary(((lt_class *) e)->get_first_expression(),
+                      ((lt_class *) e)->get_second_expression(),SLT,s);
+      return;
+    case expr_type::EXP_LEQ:
+      code_raw_binary(((leq_class *) e)->get_first_expression(),
+                      ((leq_class *) e)->get_second_expression(),SLE,s);
+      return;
+    case expr_type::EXP_EQ:
+      if (!has_raw_value(((eq_class *) e)->get_first_expression()))
+        break;
+      code_raw_binary(((eq_class *) e)->get_first_expression(),
+                      ((eq_class *) e)->get_second_expression(),SEQ,s);
+      return;
+    case expr_type::EXP_NEG:
+      code_raw(((neg_class *) e)->get_expr(),s);
+      emit_neg(ACC,ACC,s);
+      return;
+    case expr_type::EXP_COMP:
+      code_raw(((comp_class *) e)->get_expression(),s);
+      emit_xori(ACC,ACC,1,s);
+      return;
+    default:
+      break;
+  }
+  e->code(s);
+  emit_fetch_int(ACC,ACC,s);
 }
 
-void block_class::code(ostream &s) {
+//
+// Codes `e' for its effect only.  A variable or a constant has none.
+//
+static void code_effect(Expression e, ostream& s)
+{
+  switch (e->get_expr_type()) {
+    case expr_type::EXP_OBJECT:
+    case expr_type::EXP_INT_CONST:
+    case expr_type::EXP_BOOL_CONST:
+    case expr_type::EXP_STRING_CONST:
+      return;
+    case expr_type::EXP_ASSIGN:
+      if (!scope->lookup(((assign_class *) e)->get_name())->raw)
+        break;
+      code_raw(e,s);
+      return;
+    case expr_type::EXP_COND:
+      code_cond((cond_class *) e,EFFECT,s);
+      return;
+    case expr_type::EXP_BLOCK:
+      code_block((block_class *) e,EFFECT,s);
+      return;
+    case expr_type::EXP_LET:
+      code_let((let_class *) e,EFFECT,s);
+      return;
+    default:
+      break;
+  }
+  e->code(s);
 }
 
-void let_class::code(ostream &s) {
+//
+// keep_unboxed decides whether a let variable of type Int or Bool is
+// kept raw, by counting the places in its scope that code it would
+// change: where its value escapes, which then boxes it, and where it is
+// given a value computed raw, which otherwise would be boxed.  Each
+// counts 8 times for every loop around it.  The variable is kept raw
+// unless it escapes more than that.
+//
+struct VariableUses {
+  long escapes;
+  long raw_values;
+};
+
+static bool computes_raw(Expression e)
+{
+  switch (e->get_expr_type()) {
+    case expr_type::EXP_PLUS:
+    case expr_type::EXP_SUB:
+    case expr_type::EXP_MUL:
+    case expr_type::EXP_DIVIDE:
+    case expr_type::EXP_NEG:
+    case expr_type::EXP_LT:
+    case expr_type::EXP_LEQ:
+    case expr_type::EXP_EQ:
+    case expr_type::EXP_COMP:
+    case expr_type::EXP_OBJECT:
+      return true;
+    default:
+      return false;
+  }
+}
+
+//
+// Counts the uses of `x' in `e', which is coded for `use', `weight'
+// times each.  This follows code(), code_raw and code_effect.
+//
+static void count_uses(Expression e, Symbol x, Use use, long weight,
+                       VariableUses& n)
+{
+  const long LOOP = 8, MAX_WEIGHT = 1L << 40;
+  switch (e->get_expr_type()) {
+    case expr_type::EXP_OBJECT:
+      if (((object_class *) e)->get_name() == x && use == BOXED)
+        n.escapes += weight;
+      break;
+    case expr_type::EXP_ASSIGN: {
+      assign_class *a = (assign_class *) e;
+      bool to_x = a->get_name() == x;
+      if (to_x && computes_raw(a->get_expr()))
+        n.raw_values += weight;
+      if (to_x && use == BOXED)
+        n.escapes += weight;
+      count_uses(a->get_expr(),x,to_x ? RAW : BOXED,weight,n);
+      break;
+    }
+    case expr_type::EXP_STATIC_DISPATCH:
+    case expr_type::EXP_DISPATCH: {
+      Expressions args = e->get_expr_type() == expr_type::EXP_DISPATCH
+                           ? ((dispatch_class *) e)->get_args()
+                           : ((static_dispatch_class *) e)->get_args();
+      for(int i = args->first(); args->more(i); i = args->next(i))
+        count_uses(args->nth(i),x,BOXED,weight,n);
+      count_uses(e->get_expr_type() == expr_type::EXP_DISPATCH
+                   ? ((dispatch_class *) e)->get_expr()
+                   : ((static_dispatch_class *) e)->get_expr(),
+                 x,BOXED,weight,n);
+      break;
+    }
+    case expr_type::EXP_COND:
+      count_uses(((cond_class *) e)->get_pred(),x,RAW,weight,n);
+      count_uses(((cond_class *) e)->get_then_exp(),x,use,weight,n);
+      count_uses(((cond_class *) e)->get_else_exp(),x,use,weight,n);
+      break;
+    case expr_type::EXP_LOOP:
+      weight = std::min(weight * LOOP, MAX_WEIGHT);
+      count_uses(((loop_class *) e)->get_pred(),x,RAW,weight,n);
+      count_uses(((loop_class *) e)->get_body(),x,EFFECT,weight,n);
+      break;
+    case expr_type::EXP_TYPCASE: {
+      Cases cases = ((typcase_class *) e)->get_cases();
+      count_uses(((typcase_class *) e)->get_expr(),x,BOXED,weight,n);
+      for(int i = cases->first(); cases->more(i); i = cases->next(i))
+        count_uses(((branch_class *) cases->nth(i))->get_expr(),x,BOXED,weight,n);
+      break;
+    }
+    case expr_type::EXP_BLOCK: {
+      Expressions body = ((block_class *) e)->get_expressions();
+      for(int i = body->first(); body->more(i); i = body->next(i))
+        count_uses(body->nth(i),x,body->more(i + 1) ? EFFECT : use,weight,n);
+      break;
+    }
+    case expr_type::EXP_LET: {
+      let_class *l = (let_class *) e;
+      Bindings bindings = l->get_bindings();
+      for(int i = bindings->first(); bindings->more(i); i = bindings->next(i)) {
+        binding_class *b = (binding_class *) bindings->nth(i);
+        Symbol type = b->get_type_decl();
+        count_uses(b->get_init_expr(),x,
+                   type == Int || type == Bool ? RAW : BOXED,weight,n);
+      }
+      count_uses(l->get_body(),x,use,weight,n);
+      break;
+    }
+    case expr_type::EXP_PLUS:
+    case expr_type::EXP_SUB:
+    case expr_type::EXP_MUL:
+    case expr_type::EXP_DIVIDE:
+    case expr_type::EXP_LT:
+    case expr_type::EXP_LEQ:
+      count_uses(((plus_class *) e)->get_first_expression(),x,RAW,weight,n);
+      count_uses(((plus_class *) e)->get_second_expression(),x,RAW,weight,n);
+      break;
+    case expr_type::EXP_EQ: {
+      Expression e1 = ((eq_class *) e)->get_first_expression();
+      Use operands = has_raw_value(e1) ? RAW : BOXED;
+      count_uses(e1,x,operands,weight,n);
+      count_uses(((eq_class *) e)->get_second_expression(),x,operands,weight,n);
+      break;
+    }
+    case expr_type::EXP_NEG:
+      count_uses(((neg_class *) e)->get_expr(),x,RAW,weight,n);
+      break;
+    case expr_type::EXP_COMP:
+      count_uses(((comp_class *) e)->get_expression(),x,RAW,weight,n);
+      break;
+    case expr_type::EXP_ISVOID:
+      count_uses(((isvoid_class *) e)->get_expr(),x,BOXED,weight,n);
+      break;
+    default:
+      break;
+  }
 }
 
-void plus_class::code(ostream &s) {
+//
+// Whether binding `k' of `l', a let coded for `use', is kept raw.  That
+// takes a temporary, so not with -r.
+//
+static bool keep_unboxed(let_class *l, int k, Use use)
+{
+  Bindings bindings = l->get_bindings();
+  binding_class *b = (binding_class *) bindings->nth(k);
+  Symbol type = b->get_type_decl();
+  if (disable_reg_alloc || !(type == Int || type == Bool))
+    return false;
+  Symbol x = b->get_identifier();
+  VariableUses n = { 0, 0 };
+  if (computes_raw(b->get_init_expr()))
+    n.raw_values++;
+  for(int i = bindings->next(k); bindings->more(i); i = bindings->next(i)) {
+    binding_class *later = (binding_class *) bindings->nth(i);
+    Symbol t = later->get_type_decl();
+    count_uses(later->get_init_expr(),x,t == Int || t == Bool ? RAW : BOXED,1,n);
+    if (later->get_identifier() == x)
+      return n.escapes <= n.raw_values;
+  }
+  count_uses(l->get_body(),x,use,1,n);
+  return n.escapes <= n.raw_values;
+}
+
+//
+// A raw variable takes the value, and is boxed again if the value is
+// used.
+//
+void assign_class::code(ostream &s)
+{
+  Location *loc = scope->lookup(name);
+  if (loc->raw) {
+    code_raw(this,s);
+    emit_box(loc->type,s);
+    return;
+  }
+  expr->code(s);
+  emit_store(ACC,loc->offset,loc->base,s);
+  if (loc->is_attribute && cgen_Memmgr != GC_NOGC) {
+    emit_addiu(A1,SELF,loc->offset * WORD_SIZE,s);
+    emit_gc_assign(s);
+  }
 }
 
-void sub_class::code(ostream &s) {
+//
+// The arguments of a call are pushed left to right; the method pops
+// them.
+//
+static void code_arguments(Expressions actual, ostream& s)
+{
+  for(int i = actual->first(); actual->more(i); i = actual->next(i)) {
+    actual->nth(i)->code(s);
+    emit_push(ACC,s);
+  }
 }
 
-void mul_class::code(ostream &s) {
+//
+// Calls the runtime's `abort', with the file name and line of `e', if
+// ACC is void: _dispatch_abort for a dispatch, _case_abort2 for a case.
+//
+static void emit_void_check(char *abort, tree_node *e, ostream& s)
+{
+  int ok = label_count++;
+  emit_bne(ACC,ZERO,ok,s);
+  emit_load_string(ACC,
+                   stringtable.lookup_string(current_class->get_filename()->get_string()),
+                   s);
+  emit_load_imm(T1,e->get_line_number(),s);
+  emit_jal(abort,s);
+  emit_label_def(ok,s);
 }
 
-void divide_class::code(ostream &s) {
+//
+// A call through an inline cache (--inline-cache): _ic<n> holds the tag
+// of the last receiver at this call site and the method it called.  If
+// the receiver in ACC has that tag the cached method is called; if not,
+// the one in slot `slot' of its dispatch table is, and both words are
+// replaced.  The labels _ic_lookup<n> and _ic_miss<n> let mipsrun count
+// the lookups and the misses.
+//
+static void emit_inline_cache_dispatch(int slot, ostream& s)
+{
+  int n = inline_caches++;
+  int hit = label_count++;
+  s << ICLOOKUP_PREFIX << n << LABEL;
+  emit_load(T2,TAG_OFFSET,ACC,s);
+  s << LA << T1 << " " << INLINECACHE_PREFIX << n << endl;
+  emit_load(T3,0,T1,s);
+  emit_beq(T2,T3,hit,s);
+  s << ICMISS_PREFIX << n << LABEL;
+  emit_store(T2,0,T1,s);
+  emit_load(T3,DISPTABLE_OFFSET,ACC,s);
+  emit_load(T3,slot,T3,s);
+  emit_store(T3,1,T1,s);
+  emit_label_def(hit,s);
+  emit_load(T1,1,T1,s);
+  emit_jalr(T1,s);
+}
+
+//
+// The class whose dispatch table a call through an expression of static
+// type `type' uses.
+//
+static CgenNodeP static_class(Symbol type)
+{
+  return class_table->lookup(type == SELF_TYPE ? current_class->get_name() : type);
 }
 
-void neg_class::code(ostream &s) {
+//
+// A static dispatch calls the method of class `type_name' directly.
+//
+void static_dispatch_class::code(ostream &s)
+{
+  code_arguments(actual,s);
+  expr->code(s);
+  emit_void_check("_dispatch_abort",this,s);
+
+  CgenNodeP c = class_table->lookup(type_name);
+  s << JAL;  emit_method_ref(c->get_method_class(c->method_slot(name)),name,s);
+  s << endl;
 }
 
-void lt_class::code(ostream &s) {
+//
+// A dispatch is a direct call when every class the object can have runs
+// the same method, and goes through the dispatch table otherwise.
+//
+void dispatch_class::code(ostream &s)
+{
+  code_arguments(actual,s);
+  expr->code(s);
+  emit_void_check("_dispatch_abort",this,s);
+
+  CgenNodeP c = static_class(expr->get_type());
+  Symbol impl = c->single_implementation(name);
+  stats_count("dispatches", 1);
+  stats_count("devirtualized dispatches", impl ? 1 : 0);
+  if (impl) {
+    s << JAL;  emit_method_ref(impl,name,s);  s << endl;
+  } else if (cgen_inline_cache) {
+    emit_inline_cache_dispatch(c->method_slot(name),s);
+  } else {
+    emit_load(T1,DISPTABLE_OFFSET,ACC,s);
+    emit_load(T1,c->method_slot(name),T1,s);
+    emit_jalr(T1,s);
+  }
+}
+
+//
+// Branches to `label' if the Bool `e' is `when', and falls through if
+// not, without making the Bool: a comparison of Ints or Bools branches
+// on the raw operands, `not' on its operand the other way, isvoid on
+// the object, and a conditional on its predicate and then on the branch
+// taken.  Any other Bool is computed raw and tested.
+//
+static void code_branch(Expression e, bool when, int label, ostream& s)
+{
+  const char *op = NULL;
+  Expression e1 = NULL, e2 = NULL;
+  switch (e->get_expr_type()) {
+    case expr_type::EXP_BOOL_CONST:
+      if ((bool) ((bool_const_class *) e)->get_val() == when)
+        emit_branch(label,s);
+      return;
+    case expr_type::EXP_LT:
+      op = when ? BLT : BGE;
+      e1 = ((lt_class *) e)->get_first_expression();
+      e2 = ((lt_class *) e)->get_second_expression();
+      break;
+    case expr_type::EXP_LEQ:
+      op = when ? BLEQ : BGT;
+      e1 = ((leq_class *) e)->get_first_expression();
+      e2 = ((leq_class *) e)->get_second_expression();
+      break;
+    case expr_type::EXP_EQ:
+      e1 = ((eq_class *) e)->get_first_expression();
+      e2 = ((eq_class *) e)->get_second_expression();
+      if (has_raw_value(e1))
+        op = when ? BEQ : BNE;
+      break;
+    case expr_type::EXP_COMP:
+      code_branch(((comp_class *) e)->get_expression(),!when,label,s);
+      return;
+    case expr_type::EXP_ISVOID:
+      ((isvoid_class *) e)->get_expr()->code(s);
+      if (when)
+        emit_beqz(ACC,label,s);
+      else
+        emit_bne(ACC,ZERO,label,s);
+      return;
+    case expr_type::EXP_COND: {
+      cond_class *c = (cond_class *) e;
+      int else_label = label_count++;
+      int end_label = label_count++;
+      code_branch(c->get_pred(),false,else_label,s);
+      code_branch(c->get_then_exp(),when,label,s);
+      emit_branch(end_label,s);
+      emit_label_def(else_label,s);
+      code_branch(c->get_else_exp(),when,label,s);
+      emit_label_def(end_label,s);
+      return;
+    }
+    default:
+      break;
+  }
+  if (op) {
+    char *a, *b;
+    code_raw_operands(e1,e2,a,b,s);
+    s << op << a << " " << b << " ";  emit_label_ref(label,s);  s << endl;
+    return;
+  }
+  code_raw(e,s);
+  if (when)
+    emit_bne(ACC,ZERO,label,s);
+  else
+    emit_beqz(ACC,label,s);
+}
+
+//
+// The predicate branches to the else branch (code_branch), and the
+// branches are coded for the use of the value of the conditional.
+//
+static void code_cond(cond_class *c, Use use, ostream& s)
+{
+  int else_label = label_count++;
+  int end_label = label_count++;
+
+  code_branch(c->get_pred(),false,else_label,s);
+  code_in(c->get_then_exp(),use,s);
+  emit_branch(end_label,s);
+  emit_label_def(else_label,s);
+  code_in(c->get_else_exp(),use,s);
+  emit_label_def(end_label,s);
+}
+
+void cond_class::code(ostream &s)
+{
+  code_cond(this,BOXED,s);
+}
+
+void loop_class::code(ostream &s)
+{
+  int loop_label = label_count++;
+  int end_label = label_count++;
+
+  emit_label_def(loop_label,s);
+  code_branch(pred,false,end_label,s);
+  code_effect(body,s);
+  emit_branch(loop_label,s);
+  emit_label_def(end_label,s);
+  emit_move(ACC,ZERO,s);
+}
+
+//
+// The object cased on is kept in a variable word, and bound by the
+// branch taken.  The tags of a class and of its descendants are an
+// interval (assign_tags), so a branch matches if the tag of the object
+// is in the interval of its class, which takes two comparisons, or one
+// for a class with no descendants.  The branches are tried most
+// specific first, by decreasing tag: a class comes after all of its
+// descendants, and the intervals of unrelated classes do not overlap,
+// so the first branch that matches is the one for the closest
+// ancestor.  If none does, _case_abort is called.
+//
+static CgenNodeP branch_class_node(Case c)
+{
+  return class_table->lookup(((branch_class *) c)->get_type_decl());
 }
 
-void eq_class::code(ostream &s) {
+void typcase_class::code(ostream &s)
+{
+  int end_label = label_count++;
+  int first_branch = label_count;
+  label_count += cases->len();
+
+  std::vector<int> order;
+  for(int i = cases->first(); cases->more(i); i = cases->next(i))
+    order.push_back(i);
+  std::sort(order.begin(), order.end(), [this](int a, int b) {
+    return branch_class_node(cases->nth(a))->get_tag() >
+           branch_class_node(cases->nth(b))->get_tag();
+  });
+
+  expr->code(s);
+  emit_void_check("_case_abort2",this,s);
+
+  int slot = new_local();
+  emit_store(ACC,slot,FP,s);
+  emit_load(T2,TAG_OFFSET,ACC,s);
+  for(size_t k = 0; k < order.size(); k++) {
+    int i = order[k];
+    CgenNodeP c = branch_class_node(cases->nth(i));
+    if (c->get_tag() == c->get_max_tag()) {
+      emit_beqi(T2,c->get_tag(),first_branch + i,s);
+      continue;
+    }
+    int next_label = label_count++;
+    emit_blti(T2,c->get_tag(),next_label,s);
+    emit_bleqi(T2,c->get_max_tag(),first_branch + i,s);
+    emit_label_def(next_label,s);
+  }
+  emit_load(ACC,slot,FP,s);
+  emit_jal("_case_abort",s);
+
+  for(int i = cases->first(); cases->more(i); i = cases->next(i)) {
+    branch_class *b = (branch_class *) cases->nth(i);
+    emit_label_def(first_branch + i,s);
+    scope->enterscope();
+    scope->addid(b->get_name(), new Location(FP, slot));
+    b->get_expr()->code(s);
+    scope->exitscope();
+    emit_branch(end_label,s);
+  }
+
+  emit_label_def(end_label,s);
+  locals--;
 }
 
-void leq_class::code(ostream &s) {
+//
+// All but the last expression are coded for their effect.
+//
+static void code_block(block_class *b, Use use, ostream& s)
+{
+  Expressions body = b->get_expressions();
+  for(int i = body->first(); body->more(i); i = body->next(i))
+    code_in(body->nth(i),body->more(i + 1) ? EFFECT : use,s);
 }
 
-void comp_class::code(ostream &s) {
+void block_class::code(ostream &s)
+{
+  code_block(this,BOXED,s);
+}
+
+//
+// Each variable is stored in a word of its own in turn, its initializer
+// seeing the ones before it; the words are free again after the body.
+// One kept unboxed (keep_unboxed) gets a raw temporary instead.
+//
+static void code_let(let_class *l, Use use, ostream& s)
+{
+  Bindings bindings = l->get_bindings();
+  scope->enterscope();
+  int n = 0;
+  for(int i = bindings->first(); bindings->more(i); i = bindings->next(i)) {
+    binding_class *b = (binding_class *) bindings->nth(i);
+    Expression init = b->get_init_expr();
+    Symbol type = b->get_type_decl();
+    if (keep_unboxed(l,i,use)) {
+      if (init->get_expr_type() != expr_type::EXP_NO_EXPR)
+        code_raw(init,s);
+      else
+        emit_move(ACC,ZERO,s);
+      char *t = method_code->new_temp(true);
+      emit_move(t,ACC,s);
+      scope->addid(b->get_identifier(), new Location(t,type));
+      stats_count("unboxed variables", 1);
+      continue;
+    }
+    if (init->get_expr_type() != expr_type::EXP_NO_EXPR)
+      init->code(s);
+    else if (type == Int || type == Str || type == Bool) {
+      emit_partial_load_address(ACC,s);
+      emit_default_value(type,s);
+      s << endl;
+    } else
+      emit_move(ACC,ZERO,s);
+    push_local(b->get_identifier(),s);
+    n++;
+  }
+  code_in(l->get_body(),use,s);
+  scope->exitscope();
+  locals -= n;
+}
+
+void let_class::code(ostream &s)
+{
+  code_let(this,BOXED,s);
+}
+
+//
+// The result of the arithmetic is computed raw and then boxed in a new
+// Int, so the Int constants and the operands are never changed.
+//
+void plus_class::code(ostream &s)
+{
+  code_raw(this,s);
+  emit_box(Int,s);
+}
+
+void sub_class::code(ostream &s)
+{
+  code_raw(this,s);
+  emit_box(Int,s);
+}
+
+void mul_class::code(ostream &s)
+{
+  code_raw(this,s);
+  emit_box(Int,s);
+}
+
+void divide_class::code(ostream &s)
+{
+  code_raw(this,s);
+  emit_box(Int,s);
+}
+
+void neg_class::code(ostream &s)
+{
+  code_raw(this,s);
+  emit_box(Int,s);
+}
+
+//
+// Leaves true in ACC, and branches to `label' past the load of false,
+// if `reg' is zero; see isvoid and not.
+//
+static void emit_bool_if_zero(char *reg, ostream& s)
+{
+  int label = label_count++;
+  emit_load_bool(ACC,truebool,s);
+  emit_beqz(reg,label,s);
+  emit_load_bool(ACC,falsebool,s);
+  emit_label_def(label,s);
+}
+
+//
+// Compares the raw values of the operands with the branch `op'.
+//
+static void code_compare(Expression e1, Expression e2, char *op, ostream& s)
+{
+  int label = label_count++;
+  char *a, *b;
+  if (code_raw_operands(e1,e2,a,b,s))
+    emit_move(a = T2,ACC,s);
+  else
+    emit_move(b = T2,ACC,s);
+  emit_load_bool(ACC,truebool,s);
+  s << op << a << " " << b << " ";  emit_label_ref(label,s);  s << endl;
+  emit_load_bool(ACC,falsebool,s);
+  emit_label_def(label,s);
+}
+
+void lt_class::code(ostream &s)
+{
+  code_compare(e1,e2,BLT,s);
+}
+
+//
+// Two Ints or Bools are compared raw.  Otherwise equal pointers are
+// equal, and equality_test compares the values of two Strings,
+// returning ACC if they are equal and A1 if not.
+//
+void eq_class::code(ostream &s)
+{
+  if (has_raw_value(e1)) {
+    code_compare(e1,e2,BEQ,s);
+    return;
+  }
+  int label = label_count++;
+  e1->code(s);
+  push_temp(ACC,s);
+  e2->code(s);
+  pop_temp(T1,s);
+  emit_move(T2,ACC,s);
+  emit_load_bool(ACC,truebool,s);
+  emit_beq(T1,T2,label,s);
+  emit_load_bool(A1,falsebool,s);
+  emit_jal("equality_test",s);
+  emit_label_def(label,s);
+}
+
+void leq_class::code(ostream &s)
+{
+  code_compare(e1,e2,BLEQ,s);
+}
+
+void comp_class::code(ostream &s)
+{
+  code_raw(e1,s);
+  emit_move(T1,ACC,s);
+  emit_bool_if_zero(T1,s);
 }
 
 void int_const_class::code(ostream& s)  
@@ -946,16 +2920,53 @@ void bool_const_class::code(ostream& s)
   emit_load_bool(ACC, BoolConst(val), s);
 }
 
-void new__class::code(ostream &s) {
-}
-
-void isvoid_class::code(ostream &s) {
+//
+// new SELF_TYPE finds the prototype object and init method of the class
+// of self in class_objTab.
+//
+void new__class::code(ostream &s)
+{
+  if (type_name != SELF_TYPE) {
+    emit_partial_load_address(ACC,s);  emit_protobj_ref(type_name,s);  s << endl;
+    emit_jal("Object.copy",s);
+    s << JAL;  emit_init_ref(type_name,s);  s << endl;
+    return;
+  }
+  emit_load_address(T1,CLASSOBJTAB,s);
+  emit_load(T2,TAG_OFFSET,SELF,s);
+  emit_sll(T2,T2,LOG_WORD_SIZE + 1,s);
+  emit_addu(T1,T1,T2,s);
+  push_temp(T1,s,true);
+  emit_load(ACC,0,T1,s);
+  emit_jal("Object.copy",s);
+  pop_temp(T1,s);
+  emit_load(T1,1,T1,s);
+  emit_jalr(T1,s);
+}
+
+void isvoid_class::code(ostream &s)
+{
+  e1->code(s);
+  emit_move(T1,ACC,s);
+  emit_bool_if_zero(T1,s);
 }
 
-void no_expr_class::code(ostream &s) {
+void no_expr_class::code(ostream &s)
+{
+  emit_move(ACC,ZERO,s);
 }
 
-void object_class::code(ostream &s) {
+void object_class::code(ostream &s)
+{
+  if (name == self) {
+    emit_move(ACC,SELF,s);
+    return;
+  }
+  Location *loc = scope->lookup(name);
+  if (loc->raw) {
+    emit_move(ACC,loc->raw,s);
+    emit_box(loc->type,s);
+    return;
+  }
+  emit_load(ACC,loc->offset,loc->base,s);
 }
-
-
@@ -1,5 +1,9 @@
 #include <assert.h>
 #include <stdio.h>
+#include <map>
+#include <set>
+#include <utility>
+#include <vector>
 #include "emit.h"
 #include "cool-tree.h"
 #include "symtab.h"
@@ -11,12 +15,16 @@ enum Basicness     {Basic, NotBasic};
 class CgenClassTable;
 typedef CgenClassTable *CgenClassTableP;
 
+class AstStreamReader;
+extern AstStreamReader *ast_class_bodies;
+
 class CgenNode;
 typedef CgenNode *CgenNodeP;
 
 class CgenClassTable : public SymbolTable<Symbol,CgenNode> {
 private:
    List<CgenNode> *nds;
+   std::vector<CgenNodeP> classes;            // indexed by class tag
    ostream& str;
    int stringclasstag;
    int intclasstag;
@@ -42,6 +50,36 @@ private:
    void install_classes(Classes cs);
    void build_inheritance_tree();
    void set_relations(CgenNodeP nd);
+
+// The following assigns the class tags and lays out the attributes and
+// dispatch table of every class.
+
+   void assign_tags(CgenNodeP nd);
+   void build_layouts(CgenNodeP nd);
+
+// The following finds, by rapid type analysis from Main.main, the classes
+// that are instantiated and the methods that can be called.  A pending
+// entry is a method whose body is still to be scanned, or a NULL method
+// for the attribute initializers of the class.
+
+   std::vector<std::pair<CgenNodeP,Symbol> > pending;
+   std::set<std::pair<CgenNodeP,Symbol> > call_sites;  // static class, method
+   void find_live_code();
+   void instantiate(CgenNodeP nd);
+   void add_call_site(CgenNodeP nd, Symbol method);
+   void add_live_method(CgenNodeP nd, Symbol method);
+   void find_uses(Expression e, CgenNodeP in_class);
+
+// The following emits the tables indexed by class tag, and the
+// dispatch table and prototype object of each class.
+
+   void code_class_tables();
+   void code_dispatch_tables();
+   void code_prototypes();
+
+// The following codes the features of each class.
+
+   void code_class_bodies();
 public:
    CgenClassTable(Classes, ostream& str);
    void code();
@@ -55,6 +93,28 @@ private:
    List<CgenNode> *children;                  // Children of class
    Basicness basic_status;                    // `Basic' if class is basic
                                               // `NotBasic' otherwise
+   int body;                                  // index of the features in
+                                              // ast_class_bodies, or -1
+   Features no_features;                      // while they are not loaded
+   int tag;                                   // class tag
+   int max_tag;                               // highest tag of a descendant
+
+// The layout of an object, inherited attributes first, and of the
+// dispatch table, where an overriding method keeps the slot of the
+// method it overrides.  Built by build_layout from the parent's.
+
+   std::vector<Symbol> attr_names;
+   std::vector<Symbol> attr_types;
+   std::vector<Symbol> method_names;
+   std::vector<Symbol> method_classes;        // class whose code is used
+   std::map<Symbol,int> method_slots;         // name -> dispatch table slot
+   std::map<Symbol,Symbol> implementations;   // of single_implementation
+
+// Set by the rapid type analysis of CgenClassTable.
+
+   bool instantiated;                         // some `new' makes one
+   bool live;                                 // it or a descendant is
+   std::set<Symbol> live_methods;             // defined here and called
 
 public:
    CgenNode(Class_ c,
@@ -66,6 +126,36 @@ public:
    void set_parentnd(CgenNodeP p);
    CgenNodeP get_parentnd() { return parentnd; }
    int basic() { return (basic_status == Basic); }
+   void set_body(int i) { body = i; }
+   void load_features();
+   void release_features();
+   bool features_decoded() { return body >= 0; }  // by load_features
+
+   void set_tag(int t) { tag = t; }
+   int get_tag() { return tag; }
+   void set_max_tag(int t) { max_tag = t; }
+   int get_max_tag() { return max_tag; }
+   void build_layout();
+   int attr_count() { return attr_names.size(); }
+   Symbol get_attr_name(int i) { return attr_names[i]; }
+   Symbol get_attr_type(int i) { return attr_types[i]; }
+   int method_count() { return method_names.size(); }
+   Symbol get_method_name(int i) { return method_names[i]; }
+   Symbol get_method_class(int i) { return method_classes[i]; }
+   int method_slot(Symbol name);
+   Symbol single_implementation(Symbol name);
+   bool is_instantiated() { return instantiated; }
+   void set_instantiated() { instantiated = true; }
+   bool is_live() { return live; }
+   void set_live() { live = true; }
+   bool add_live_method(Symbol name) { return live_methods.insert(name).second; }
+   bool method_live(Symbol name) { return live_methods.count(name) > 0; }
+   bool has_live_methods() { return !live_methods.empty(); }
+
+   void code_disptab(ostream& s);
+   void code_prototype(ostream& s);
+   void code_init(ostream& s);
+   void code_methods(ostream& s);
 };
 
 class BoolConst 
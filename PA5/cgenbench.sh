@@ -0,0 +1,82 @@
+#!/bin/sh
+#
+#  cgenbench.sh [-o name] [-c "cgen options"] [benchmark ...]
+#
+#  Measures the code cgen writes.  The programs of bench/benchmarks (or
+#  the ones named) are compiled by the lexer, parser, semant and cgen,
+#  the last run with the given options (default -g, so that the programs
+#  collect their garbage), and run by mipsrun with --stats=json, with
+#  standard input from bench/name.in if there is one.  The output of each
+#  is compared with bench/name.out, and its counts written, one line per
+#  program, to name.dat (default cgenbench.dat):
+#
+#      name  status  instructions  runtime_calls  objects  allocated_bytes
+#            gc_cycles  code_size
+#
+#  where status is ok, or wrong if the output differs from the expected
+#  one (it is kept in name-benchmark.got).  The exit status is 1 if any was wrong.
+#
+#  The phases are ../PA2/lexer, ../PA3/parser, ../PA4/semant, ./cgen and
+#  ./mipsrun, as built by the Makefiles of the assignments; set LEXER,
+#  PARSER, SEMANT, CGEN and MIPSRUN to run others.
+#
+
+LEXER=${LEXER-../PA2/lexer}
+PARSER=${PARSER-../PA3/parser}
+SEMANT=${SEMANT-../PA4/semant}
+CGEN=${CGEN-./cgen}
+MIPSRUN=${MIPSRUN-./mipsrun}
+BENCH=${BENCH-bench}
+
+name=cgenbench
+cgenopts=-g
+while getopts o:c: flag; do
+  case $flag in
+  o) name=$OPTARG ;;
+  c) cgenopts=$OPTARG ;;
+  *) echo "usage: $0 [-o name] [-c \"cgen options\"] [benchmark ...]" >&2
+     exit 1 ;;
+  esac
+done
+shift `expr $OPTIND - 1`
+[ $# -eq 0 ] && set -- `awk '!/^#/ && NF { print $1 }' $BENCH/benchmarks`
+
+# The value of the count $2 in the --stats=json report in file $1.
+count() {
+  sed -n 's/.*"'$2'": \([0-9]*\).*/\1/p' "$1"
+}
+
+failed=0
+echo "# name status instructions runtime_calls objects allocated_bytes gc_cycles code_size" > $name.dat
+for prog in "$@"; do
+  srcs=`awk '$1 == "'$prog'" { for (i = 2; i <= NF; i++) print "'$BENCH'/" $i }' $BENCH/benchmarks`
+  if [ -z "$srcs" ]; then
+    echo "$0: no benchmark $prog in $BENCH/benchmarks" >&2
+    exit 1
+  fi
+  input=/dev/null
+  [ -f $BENCH/$prog.in ] && input=$BENCH/$prog.in
+  $LEXER $srcs > $name-$prog.tok &&
+  $PARSER < $name-$prog.tok > $name-$prog.ast &&
+  $SEMANT < $name-$prog.ast > $name-$prog.sem &&
+  $CGEN $cgenopts < $name-$prog.sem > $name-$prog.s || {
+    echo "$0: the compiler failed on $prog" >&2
+    exit 1
+  }
+  rm -f $name-$prog.tok $name-$prog.ast $name-$prog.sem
+  $MIPSRUN --stats=json $name-$prog.s < $input > $name-$prog.got 2> $name-$prog.json
+  if cmp -s $name-$prog.got $BENCH/$prog.out; then
+    status=ok
+    rm -f $name-$prog.got
+  else
+    status=wrong
+    failed=1
+  fi
+  json=$name-$prog.json
+  echo "$prog $status `count $json instructions` `count $json runtime_calls`" \
+       "`count $json objects` `count $json allocated_bytes`" \
+       "`count $json gc_cycles` `count $json code_size`" >> $name.dat
+  rm -f $name-$prog.s $json
+done
+cat $name.dat
+exit $failed
@@ -102,6 +102,21 @@ void branch_class::dump(ostream& stream, int n)
 }
 
 
+Binding binding_class::copy_Binding()
+{
+   return new binding_class(copy_Symbol(identifier), copy_Symbol(type_decl), init->copy_Expression());
+}
+
+
+void binding_class::dump(ostream& stream, int n)
+{
+   stream << pad(n) << "binding\n";
+   dump_Symbol(stream, n+2, identifier);
+   dump_Symbol(stream, n+2, type_decl);
+   init->dump(stream, n+2);
+}
+
+
 Expression assign_class::copy_Expression()
 {
    return new assign_class(copy_Symbol(name), expr->copy_Expression());
@@ -205,16 +220,14 @@ void block_class::dump(ostream& stream, int n)
 
 Expression let_class::copy_Expression()
 {
-   return new let_class(copy_Symbol(identifier), copy_Symbol(type_decl), init->copy_Expression(), body->copy_Expression());
+   return new let_class(bindings->copy_list(), body->copy_Expression());
 }
 
 
 void let_class::dump(ostream& stream, int n)
 {
    stream << pad(n) << "let\n";
-   dump_Symbol(stream, n+2, identifier);
-   dump_Symbol(stream, n+2, type_decl);
-   init->dump(stream, n+2);
+   bindings->dump(stream, n+2);
    body->dump(stream, n+2);
 }
 
@@ -509,6 +522,21 @@ Cases append_Cases(Cases p1, Cases p2)
    return new append_node<Case>(p1, p2);
 }
 
+Bindings nil_Bindings()
+{
+   return new nil_node<Binding>();
+}
+
+Bindings single_Bindings(Binding e)
+{
+   return new single_list_node<Binding>(e);
+}
+
+Bindings append_Bindings(Bindings p1, Bindings p2)
+{
+   return new append_node<Binding>(p1, p2);
+}
+
 Program program(Classes classes)
 {
   return new program_class(classes);
@@ -539,6 +567,11 @@ Case branch(Symbol name, Symbol type_decl, Expression expr)
   return new branch_class(name, type_decl, expr);
 }
 
+Binding binding(Symbol identifier, Symbol type_decl, Expression init)
+{
+  return new binding_class(identifier, type_decl, init);
+}
+
 Expression assign(Symbol name, Expression expr)
 {
   return new assign_class(name, expr);
@@ -574,9 +607,15 @@ Expression block(Expressions body)
   return new block_class(body);
 }
 
+Expression let(Bindings bindings, Expression body)
+{
+  return new let_class(bindings, body);
+}
+
+// a let of one binding
 Expression let(Symbol identifier, Symbol type_decl, Expression init, Expression body)
 {
-  return new let_class(identifier, type_decl, init, body);
+  return new let_class(single_Bindings(binding(identifier, type_decl, init)), body);
 }
 
 Expression plus(Expression e1, Expression e2)
@@ -12,6 +12,7 @@
 #include "tree.h"
 #include "cool-tree.handcode.h"
 
+#include "mycode/expression_classes.h"
 
 // define the class for phylum
 // define simple phylum - Program
@@ -35,6 +36,8 @@ class Class__class : public tree_node {
 public:
    tree_node *copy()		 { return copy_Class_(); }
    virtual Class_ copy_Class_() = 0;
+   virtual Symbol get_name() const = 0;
+   virtual Symbol get_parent_name() const = 0;
 
 #ifdef Class__EXTRAS
    Class__EXTRAS
@@ -50,6 +53,11 @@ public:
    tree_node *copy()		 { return copy_Feature(); }
    virtual Feature copy_Feature() = 0;
 
+   virtual char get_type() const = 0;
+   virtual Symbol get_type_decl() const = 0;
+   virtual Symbol get_return_type() const = 0;
+   virtual Symbol get_name() const = 0;
+
 #ifdef Feature_EXTRAS
    Feature_EXTRAS
 #endif
@@ -63,6 +71,8 @@ class Formal_class : public tree_node {
 public:
    tree_node *copy()		 { return copy_Formal(); }
    virtual Formal copy_Formal() = 0;
+   virtual Symbol get_type() const = 0;
+   virtual Symbol get_name() const = 0;
 
 #ifdef Formal_EXTRAS
    Formal_EXTRAS
@@ -77,6 +87,7 @@ class Expression_class : public tree_node {
 public:
    tree_node *copy()		 { return copy_Expression(); }
    virtual Expression copy_Expression() = 0;
+   virtual expr_type get_expr_type() = 0;
 
 #ifdef Expression_EXTRAS
    Expression_EXTRAS
@@ -98,6 +109,20 @@ public:
 };
 
 
+// define simple phylum - Binding
+typedef class Binding_class *Binding;
+
+class Binding_class : public tree_node {
+public:
+   tree_node *copy()		 { return copy_Binding(); }
+   virtual Binding copy_Binding() = 0;
+
+#ifdef Binding_EXTRAS
+   Binding_EXTRAS
+#endif
+};
+
+
 // define the class for phylum - LIST
 // define list phlyum - Classes
 typedef list_node<Class_> Classes_class;
@@ -124,10 +149,15 @@ typedef list_node<Case> Cases_class;
 typedef Cases_class *Cases;
 
 
+// define list phlyum - Bindings
+typedef list_node<Binding> Bindings_class;
+typedef Bindings_class *Bindings;
+
+
 // define the class for constructors
 // define constructor - program
 class program_class : public Program_class {
-public:
+protected:
    Classes classes;
 public:
    program_class(Classes a1) {
@@ -147,7 +177,7 @@ public:
 
 // define constructor - class_
 class class__class : public Class__class {
-public:
+protected:
    Symbol name;
    Symbol parent;
    Features features;
@@ -162,6 +192,10 @@ public:
    Class_ copy_Class_();
    void dump(ostream& stream, int n);
 
+   Symbol get_name() const { return copy_Symbol(name); }
+   Symbol get_parent_name() const { return copy_Symbol(parent); }
+   Features& get_features() { return features; }
+
 #ifdef Class__SHARED_EXTRAS
    Class__SHARED_EXTRAS
 #endif
@@ -173,7 +207,7 @@ public:
 
 // define constructor - method
 class method_class : public Feature_class {
-public:
+protected:
    Symbol name;
    Formals formals;
    Symbol return_type;
@@ -187,6 +221,12 @@ public:
    }
    Feature copy_Feature();
    void dump(ostream& stream, int n);
+   Symbol get_name() const { return copy_Symbol(name); }
+   Symbol get_type_decl() const { return NULL;}
+   Symbol get_return_type() const { return copy_Symbol(return_type);}
+   Formals get_formals() const { return formals->copy_list();}
+   Expression& get_expr() { return expr; }
+   virtual char get_type() const override { return 'm'; }
 
 #ifdef Feature_SHARED_EXTRAS
    Feature_SHARED_EXTRAS
@@ -199,7 +239,7 @@ public:
 
 // define constructor - attr
 class attr_class : public Feature_class {
-public:
+protected:
    Symbol name;
    Symbol type_decl;
    Expression init;
@@ -211,6 +251,11 @@ public:
    }
    Feature copy_Feature();
    void dump(ostream& stream, int n);
+   Symbol get_return_type() const { return NULL; };
+   Symbol get_name() const { return copy_Symbol(name); }
+   Symbol get_type_decl() const { return copy_Symbol(type_decl);}
+   Expression& get_init_expr() { return init;}
+   virtual char get_type() const override { return 'a'; }
 
 #ifdef Feature_SHARED_EXTRAS
    Feature_SHARED_EXTRAS
@@ -223,7 +268,7 @@ public:
 
 // define constructor - formal
 class formal_class : public Formal_class {
-public:
+protected:
    Symbol name;
    Symbol type_decl;
 public:
@@ -233,6 +278,8 @@ public:
    }
    Formal copy_Formal();
    void dump(ostream& stream, int n);
+   Symbol get_type() const { return copy_Symbol(type_decl); }
+   Symbol get_name() const { return copy_Symbol(name); }
 
 #ifdef Formal_SHARED_EXTRAS
    Formal_SHARED_EXTRAS
@@ -245,7 +292,7 @@ public:
 
 // define constructor - branch
 class branch_class : public Case_class {
-public:
+protected:
    Symbol name;
    Symbol type_decl;
    Expression expr;
@@ -257,6 +304,9 @@ public:
    }
    Case copy_Case();
    void dump(ostream& stream, int n);
+   Symbol get_name() const { return copy_Symbol(name); }
+   Symbol get_type_decl() const { return copy_Symbol(type_decl); }
+   Expression& get_expr() { return expr; }
 
 #ifdef Case_SHARED_EXTRAS
    Case_SHARED_EXTRAS
@@ -267,9 +317,36 @@ public:
 };
 
 
+// define constructor - binding
+class binding_class : public Binding_class {
+protected:
+   Symbol identifier;
+   Symbol type_decl;
+   Expression init;
+public:
+   binding_class(Symbol a1, Symbol a2, Expression a3) {
+      identifier = a1;
+      type_decl = a2;
+      init = a3;
+   }
+   Binding copy_Binding();
+   void dump(ostream& stream, int n);
+   Symbol get_identifier() const { return copy_Symbol(identifier); }
+   Symbol get_type_decl() const { return copy_Symbol(type_decl); }
+   Expression& get_init_expr() { return init; }
+
+#ifdef Binding_SHARED_EXTRAS
+   Binding_SHARED_EXTRAS
+#endif
+#ifdef binding_EXTRAS
+   binding_EXTRAS
+#endif
+};
+
+
 // define constructor - assign
 class assign_class : public Expression_class {
-public:
+protected:
    Symbol name;
    Expression expr;
 public:
@@ -279,6 +356,9 @@ public:
    }
    Expression copy_Expression();
    void dump(ostream& stream, int n);
+   expr_type get_expr_type() { return expr_type::EXP_ASSIGN; }
+   Expression& get_expr() { return expr; }
+   Symbol get_name() const { return copy_Symbol(name); }
 
 #ifdef Expression_SHARED_EXTRAS
    Expression_SHARED_EXTRAS
@@ -291,7 +371,7 @@ public:
 
 // define constructor - static_dispatch
 class static_dispatch_class : public Expression_class {
-public:
+protected:
    Expression expr;
    Symbol type_name;
    Symbol name;
@@ -305,6 +385,12 @@ public:
    }
    Expression copy_Expression();
    void dump(ostream& stream, int n);
+   expr_type get_expr_type() { return expr_type::EXP_STATIC_DISPATCH; }
+   Expression& get_expr() { return expr; }
+   Symbol get_type_name() const { return copy_Symbol(type_name); }
+   Symbol get_name() const { return copy_Symbol(name); }
+   Expressions& get_args() { return actual; }
+
 
 #ifdef Expression_SHARED_EXTRAS
    Expression_SHARED_EXTRAS
@@ -317,7 +403,7 @@ public:
 
 // define constructor - dispatch
 class dispatch_class : public Expression_class {
-public:
+protected:
    Expression expr;
    Symbol name;
    Expressions actual;
@@ -329,6 +415,11 @@ public:
    }
    Expression copy_Expression();
    void dump(ostream& stream, int n);
+   expr_type get_expr_type() { return expr_type::EXP_DISPATCH; }
+   Expression& get_expr() { return expr; }
+   Symbol get_name() const { return copy_Symbol(name); }
+   Expressions& get_args() { return actual; }
+
 
 #ifdef Expression_SHARED_EXTRAS
    Expression_SHARED_EXTRAS
@@ -341,7 +432,7 @@ public:
 
 // define constructor - cond
 class cond_class : public Expression_class {
-public:
+protected:
    Expression pred;
    Expression then_exp;
    Expression else_exp;
@@ -353,6 +444,10 @@ public:
    }
    Expression copy_Expression();
    void dump(ostream& stream, int n);
+   expr_type get_expr_type() { return expr_type::EXP_COND; }
+   Expression& get_pred() { return pred; }
+   Expression& get_then_exp() { return then_exp; }
+   Expression& get_else_exp() { return else_exp; }
 
 #ifdef Expression_SHARED_EXTRAS
    Expression_SHARED_EXTRAS
@@ -365,7 +460,7 @@ public:
 
 // define constructor - loop
 class loop_class : public Expression_class {
-public:
+protected:
    Expression pred;
    Expression body;
 public:
@@ -375,6 +470,9 @@ public:
    }
    Expression copy_Expression();
    void dump(ostream& stream, int n);
+   expr_type get_expr_type() { return expr_type::EXP_LOOP; }
+   Expression& get_pred() { return pred; }
+   Expression& get_body() { return body; }
 
 #ifdef Expression_SHARED_EXTRAS
    Expression_SHARED_EXTRAS
@@ -387,7 +485,7 @@ public:
 
 // define constructor - typcase
 class typcase_class : public Expression_class {
-public:
+protected:
    Expression expr;
    Cases cases;
 public:
@@ -397,6 +495,10 @@ public:
    }
    Expression copy_Expression();
    void dump(ostream& stream, int n);
+   expr_type get_expr_type() { return expr_type::EXP_TYPCASE; }
+   Expression& get_expr() { return expr; }
+   Cases& get_cases() { return cases; }
+
 
 #ifdef Expression_SHARED_EXTRAS
    Expression_SHARED_EXTRAS
@@ -409,7 +511,7 @@ public:
 
 // define constructor - block
 class block_class : public Expression_class {
-public:
+protected:
    Expressions body;
 public:
    block_class(Expressions a1) {
@@ -417,6 +519,8 @@ public:
    }
    Expression copy_Expression();
    void dump(ostream& stream, int n);
+   expr_type get_expr_type() { return expr_type::EXP_BLOCK; }
+   Expressions& get_expressions() { return body; }
 
 #ifdef Expression_SHARED_EXTRAS
    Expression_SHARED_EXTRAS
@@ -429,20 +533,19 @@ public:
 
 // define constructor - let
 class let_class : public Expression_class {
-public:
-   Symbol identifier;
-   Symbol type_decl;
-   Expression init;
+protected:
+   Bindings bindings;
    Expression body;
 public:
-   let_class(Symbol a1, Symbol a2, Expression a3, Expression a4) {
-      identifier = a1;
-      type_decl = a2;
-      init = a3;
-      body = a4;
+   let_class(Bindings a1, Expression a2) {
+      bindings = a1;
+      body = a2;
    }
    Expression copy_Expression();
    void dump(ostream& stream, int n);
+   expr_type get_expr_type() { return expr_type::EXP_LET; }
+   Bindings get_bindings() { return bindings; }
+   Expression& get_body() { return body; }
 
 #ifdef Expression_SHARED_EXTRAS
    Expression_SHARED_EXTRAS
@@ -455,7 +558,7 @@ public:
 
 // define constructor - plus
 class plus_class : public Expression_class {
-public:
+protected:
    Expression e1;
    Expression e2;
 public:
@@ -465,6 +568,9 @@ public:
    }
    Expression copy_Expression();
    void dump(ostream& stream, int n);
+   expr_type get_expr_type() { return expr_type::EXP_PLUS; }
+   Expression& get_first_expression() { return e1; }
+   Expression& get_second_expression() { return e2; }
 
 #ifdef Expression_SHARED_EXTRAS
    Expression_SHARED_EXTRAS
@@ -477,7 +583,7 @@ public:
 
 // define constructor - sub
 class sub_class : public Expression_class {
-public:
+protected:
    Expression e1;
    Expression e2;
 public:
@@ -487,6 +593,9 @@ public:
    }
    Expression copy_Expression();
    void dump(ostream& stream, int n);
+   expr_type get_expr_type() { return expr_type::EXP_SUB; }
+   Expression& get_first_expression() { return e1; }
+   Expression& get_second_expression() { return e2; }
 
 #ifdef Expression_SHARED_EXTRAS
    Expression_SHARED_EXTRAS
@@ -499,7 +608,7 @@ public:
 
 // define constructor - mul
 class mul_class : public Expression_class {
-public:
+protected:
    Expression e1;
    Expression e2;
 public:
@@ -509,6 +618,9 @@ public:
    }
    Expression copy_Expression();
    void dump(ostream& stream, int n);
+   expr_type get_expr_type() { return expr_type::EXP_MUL; }
+   Expression& get_first_expression() { return e1; }
+   Expression& get_second_expression() { return e2; }
 
 #ifdef Expression_SHARED_EXTRAS
    Expression_SHARED_EXTRAS
@@ -521,7 +633,7 @@ public:
 
 // define constructor - divide
 class divide_class : public Expression_class {
-public:
+protected:
    Expression e1;
    Expression e2;
 public:
@@ -531,6 +643,9 @@ public:
    }
    Expression copy_Expression();
    void dump(ostream& stream, int n);
+   expr_type get_expr_type() { return expr_type::EXP_DIVIDE; }
+   Expression& get_first_expression() { return e1; }
+   Expression& get_second_expression() { return e2; }
 
 #ifdef Expression_SHARED_EXTRAS
    Expression_SHARED_EXTRAS
@@ -543,7 +658,7 @@ public:
 
 // define constructor - neg
 class neg_class : public Expression_class {
-public:
+protected:
    Expression e1;
 public:
    neg_class(Expression a1) {
@@ -551,6 +666,8 @@ public:
    }
    Expression copy_Expression();
    void dump(ostream& stream, int n);
+   expr_type get_expr_type() { return expr_type::EXP_NEG; }
+   Expression& get_expr() { return e1; }
 
 #ifdef Expression_SHARED_EXTRAS
    Expression_SHARED_EXTRAS
@@ -563,7 +680,7 @@ public:
 
 // define constructor - lt
 class lt_class : public Expression_class {
-public:
+protected:
    Expression e1;
    Expression e2;
 public:
@@ -573,6 +690,9 @@ public:
    }
    Expression copy_Expression();
    void dump(ostream& stream, int n);
+   expr_type get_expr_type() { return expr_type::EXP_LT; }
+   Expression& get_first_expression() { return e1; }
+   Expression& get_second_expression() { return e2; }
 
 #ifdef Expression_SHARED_EXTRAS
    Expression_SHARED_EXTRAS
@@ -585,7 +705,7 @@ public:
 
 // define constructor - eq
 class eq_class : public Expression_class {
-public:
+protected:
    Expression e1;
    Expression e2;
 public:
@@ -595,6 +715,9 @@ public:
    }
    Expression copy_Expression();
    void dump(ostream& stream, int n);
+   expr_type get_expr_type() { return expr_type::EXP_EQ; }
+   Expression& get_first_expression() { return e1; }
+   Expression& get_second_expression() { return e2; }
 
 #ifdef Expression_SHARED_EXTRAS
    Expression_SHARED_EXTRAS
@@ -607,7 +730,7 @@ public:
 
 // define constructor - leq
 class leq_class : public Expression_class {
-public:
+protected:
    Expression e1;
    Expression e2;
 public:
@@ -617,6 +740,9 @@ public:
    }
    Expression copy_Expression();
    void dump(ostream& stream, int n);
+   expr_type get_expr_type() { return expr_type::EXP_LEQ; }
+   Expression& get_first_expression() { return e1; }
+   Expression& get_second_expression() { return e2; }
 
 #ifdef Expression_SHARED_EXTRAS
    Expression_SHARED_EXTRAS
@@ -629,7 +755,7 @@ public:
 
 // define constructor - comp
 class comp_class : public Expression_class {
-public:
+protected:
    Expression e1;
 public:
    comp_class(Expression a1) {
@@ -637,6 +763,8 @@ public:
    }
    Expression copy_Expression();
    void dump(ostream& stream, int n);
+   expr_type get_expr_type() { return expr_type::EXP_COMP; }
+   Expression& get_expression() { return e1; }
 
 #ifdef Expression_SHARED_EXTRAS
    Expression_SHARED_EXTRAS
@@ -649,7 +777,7 @@ public:
 
 // define constructor - int_const
 class int_const_class : public Expression_class {
-public:
+protected:
    Symbol token;
 public:
    int_const_class(Symbol a1) {
@@ -657,6 +785,8 @@ public:
    }
    Expression copy_Expression();
    void dump(ostream& stream, int n);
+   expr_type get_expr_type() { return expr_type::EXP_INT_CONST; }
+   Symbol get_token() const { return copy_Symbol(token); }
 
 #ifdef Expression_SHARED_EXTRAS
    Expression_SHARED_EXTRAS
@@ -669,7 +799,7 @@ public:
 
 // define constructor - bool_const
 class bool_const_class : public Expression_class {
-public:
+protected:
    Boolean val;
 public:
    bool_const_class(Boolean a1) {
@@ -677,6 +807,8 @@ public:
    }
    Expression copy_Expression();
    void dump(ostream& stream, int n);
+   expr_type get_expr_type() { return expr_type::EXP_BOOL_CONST; }
+   Boolean get_val() const { return copy_Boolean(val); }
 
 #ifdef Expression_SHARED_EXTRAS
    Expression_SHARED_EXTRAS
@@ -689,7 +821,7 @@ public:
 
 // define constructor - string_const
 class string_const_class : public Expression_class {
-public:
+protected:
    Symbol token;
 public:
    string_const_class(Symbol a1) {
@@ -697,6 +829,8 @@ public:
    }
    Expression copy_Expression();
    void dump(ostream& stream, int n);
+   expr_type get_expr_type() { return expr_type::EXP_STRING_CONST; }
+   Symbol get_token() const { return copy_Symbol(token); }
 
 #ifdef Expression_SHARED_EXTRAS
    Expression_SHARED_EXTRAS
@@ -709,7 +843,7 @@ public:
 
 // define constructor - new_
 class new__class : public Expression_class {
-public:
+protected:
    Symbol type_name;
 public:
    new__class(Symbol a1) {
@@ -717,6 +851,8 @@ public:
    }
    Expression copy_Expression();
    void dump(ostream& stream, int n);
+   expr_type get_expr_type() { return expr_type::EXP_NEW_; }
+   Symbol get_type_name() const { return copy_Symbol(type_name); }
 
 #ifdef Expression_SHARED_EXTRAS
    Expression_SHARED_EXTRAS
@@ -729,7 +865,7 @@ public:
 
 // define constructor - isvoid
 class isvoid_class : public Expression_class {
-public:
+protected:
    Expression e1;
 public:
    isvoid_class(Expression a1) {
@@ -737,6 +873,8 @@ public:
    }
    Expression copy_Expression();
    void dump(ostream& stream, int n);
+   expr_type get_expr_type() { return expr_type::EXP_ISVOID; }
+   Expression& get_expr() { return e1; }
 
 #ifdef Expression_SHARED_EXTRAS
    Expression_SHARED_EXTRAS
@@ -749,12 +887,13 @@ public:
 
 // define constructor - no_expr
 class no_expr_class : public Expression_class {
-public:
+protected:
 public:
    no_expr_class() {
    }
    Expression copy_Expression();
    void dump(ostream& stream, int n);
+   expr_type get_expr_type() { return expr_type::EXP_NO_EXPR; }
 
 #ifdef Expression_SHARED_EXTRAS
    Expression_SHARED_EXTRAS
@@ -767,7 +906,7 @@ public:
 
 // define constructor - object
 class object_class : public Expression_class {
-public:
+protected:
    Symbol name;
 public:
    object_class(Symbol a1) {
@@ -775,6 +914,8 @@ public:
    }
    Expression copy_Expression();
    void dump(ostream& stream, int n);
+   expr_type get_expr_type() { return expr_type::EXP_OBJECT; }
+   Symbol get_name() { return copy_Symbol(name); }
 
 #ifdef Expression_SHARED_EXTRAS
    Expression_SHARED_EXTRAS
@@ -784,7 +925,6 @@ public:
 #endif
 };
 
-
 // define the prototypes of the interface
 Classes nil_Classes();
 Classes single_Classes(Class_);
@@ -801,12 +941,16 @@ Expressions append_Expressions(Expressions, Expressions);
 Cases nil_Cases();
 Cases single_Cases(Case);
 Cases append_Cases(Cases, Cases);
+Bindings nil_Bindings();
+Bindings single_Bindings(Binding);
+Bindings append_Bindings(Bindings, Bindings);
 Program program(Classes);
 Class_ class_(Symbol, Symbol, Features, Symbol);
 Feature method(Symbol, Formals, Symbol, Expression);
 Feature attr(Symbol, Symbol, Expression);
 Formal formal(Symbol, Symbol);
 Case branch(Symbol, Symbol, Expression);
+Binding binding(Symbol, Symbol, Expression);
 Expression assign(Symbol, Expression);
 Expression static_dispatch(Expression, Symbol, Symbol, Expressions);
 Expression dispatch(Expression, Symbol, Expressions);
@@ -814,6 +958,7 @@ Expression cond(Expression, Expression, Expression);
 Expression loop(Expression, Expression);
 Expression typcase(Expression, Cases);
 Expression block(Expressions);
+Expression let(Bindings, Expression);
 Expression let(Symbol, Symbol, Expression, Expression);
 Expression plus(Expression, Expression);
 Expression sub(Expression, Expression);
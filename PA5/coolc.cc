@@ -0,0 +1,145 @@
+//
+// See copyright.h for copyright notice and limitation of liability
+// and disclaimer of warranty provisions.
+//
+#include "copyright.h"
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  coolc.cc
+//
+//  Runs all four phases of the compiler in one process:
+//
+//      coolc [flags] a.cl b.cl ...
+//
+//  The lexer (PA2) is the token source of the parser (PA3), the Program
+//  it builds is checked by program_class::semant (PA4) and the same tree
+//  is handed to program_class::cgen.  Nothing is written between the
+//  phases.  The flags are those of the separate phases: -F scans with
+//  fast-lex.cc, -P and -j parse as parser-phase.cc does, and -o names
+//  the output, which is otherwise the first file with its extension
+//  replaced by .s.  With --stats the scanner is timed as a sub-pass of
+//  the parse it feeds (stats.h).
+//
+//  coolc is built from the sources of all the assignments with -DCOOLC,
+//  which gives the tree the members of both semant and cgen (see
+//  cool-tree.handcode.h).  The lexer, parser, semant and cgen programs
+//  are unchanged and still useful for looking at one phase.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <unistd.h>
+#include <string>
+#include "cool-io.h"  //includes iostream
+#include "cool-tree.h"
+#include "cool-parse.h"
+#include "parser-context.h"
+#include "cgen_gc.h"
+#include "ast-stream.h"
+#include "stats.h"
+
+extern int optind;            // for option processing
+extern char *out_filename;    // name of output assembly
+extern int fast_lexer;
+extern int pipeline_parse;
+extern int parse_jobs;
+
+FILE *fin;                    // the file the lexer reads from
+char *curr_filename = "<stdin>";
+extern int curr_lineno;       // the line of the token last scanned
+AstStreamReader *ast_class_bodies = NULL;  // the tree is all in memory
+
+extern int cool_yylex();
+extern int cool_yylex_fast();
+extern int (*cool_token_source)();
+
+void handle_flags(int argc, char *argv[]);
+
+static char **files;          // the files still to be scanned
+static int (*scan)();         // the lexer
+
+//
+// The token source of the parser: the tokens of all the files in turn,
+// as the lexer writes them for the separate parser.
+//
+static int next_token()
+{
+  for (;;) {
+    if (fin != NULL) {
+      int token;
+      if (compiler_stats != STATS_OFF) {
+        static StatsTally lex("lex");
+        unsigned long allocations = stats_allocations();
+        double start = stats_clock();
+        token = (*scan)();
+        lex.add(stats_clock() - start, stats_allocations() - allocations);
+      } else
+        token = (*scan)();
+      if (token != 0)
+        return token;
+      fclose(fin);
+      fin = NULL;
+    }
+    if (*files == NULL)
+      return 0;
+    fin = fopen(*files, "r");
+    if (fin == NULL) {
+      cerr << "Could not open input file " << *files << endl;
+      exit(1);
+    }
+    curr_filename = *files++;
+    curr_lineno = 1;
+  }
+}
+
+int main(int argc, char *argv[]) {
+  handle_flags(argc,argv);
+  if (optind == argc) {
+    cerr << "usage: " << argv[0] << " [flags] file.cl ...\n";
+    exit(1);
+  }
+  files = argv + optind;
+  scan = fast_lexer ? cool_yylex_fast : cool_yylex;
+  cool_token_source = next_token;
+
+  ParserContext ctx;
+  StatsPass *pass = new StatsPass("parse");
+  if (parse_jobs > 1)
+    cool_yyparse_files(&ctx, parse_jobs);
+  else if (pipeline_parse)
+    cool_yyparse_pipelined(&ctx);
+  else
+    cool_yyparse(&ctx);
+  delete pass;
+  if (ctx.errors != 0) {
+    cerr << "Compilation halted due to lex and parse errors\n";
+    exit(1);
+  }
+
+  pass = new StatsPass("semant");
+  ctx.program->semant();
+  delete pass;
+
+  std::string output;
+  if (out_filename) {
+    output = out_filename;
+  } else {
+    output = argv[optind];
+    std::string::size_type dot = output.rfind('.');
+    if (dot != std::string::npos && output.find('/', dot) == std::string::npos)
+      output.erase(dot);
+    output += ".s";
+  }
+  ofstream s(output.c_str());
+  if (!s) {
+    cerr << "Cannot open output file " << output << endl;
+    exit(1);
+  }
+  pass = new StatsPass("cgen");
+  ctx.program->cgen(s);
+  delete pass;
+  stats_report("coolc");
+  trace_write();
+  return 0;
+}
@@ -35,6 +35,9 @@
 #define INTCONST_PREFIX      "int_const"
 #define STRCONST_PREFIX      "str_const"
 #define BOOLCONST_PREFIX     "bool_const"
+#define INLINECACHE_PREFIX   "_ic"       // _ic<n>: tag and method of call n
+#define ICLOOKUP_PREFIX      "_ic_lookup"
+#define ICMISS_PREFIX        "_ic_miss"
 
 
 #define EMPTYSLOT            0
@@ -57,6 +60,12 @@
 #define INT_SLOTS         1
 #define BOOL_SLOTS        1
 
+//
+// information about stack frames: the words saved by a method's
+// prologue, between its arguments and its temporaries
+//
+#define FRAME_SAVED       3
+
 #define GLOBAL        "\t.globl\t"
 #define ALIGN         "\t.align\t2\n"
 #define WORD          "\t.word\t"
@@ -97,6 +106,10 @@
 #define MUL   "\tmul\t"
 #define SUB   "\tsub\t"
 #define SLL   "\tsll\t"
+#define SLT   "\tslt\t"
+#define SLE   "\tsle\t"
+#define SEQ   "\tseq\t"
+#define XORI  "\txori\t"
 #define BEQZ  "\tbeqz\t"
 #define BRANCH   "\tb\t"
 #define BEQ      "\tbeq\t"
@@ -104,5 +117,6 @@
 #define BLEQ     "\tble\t"
 #define BLT      "\tblt\t"
 #define BGT      "\tbgt\t"
+#define BGE      "\tbge\t"
 
 
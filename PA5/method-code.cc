@@ -0,0 +1,654 @@
+//
+// See copyright.h for copyright notice and limitation of liability
+// and disclaimer of warranty provisions.
+//
+#include "copyright.h"
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  method-code.cc
+//
+//  The instructions of a method and the register allocation of its
+//  temporaries (see method-code.h).
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include <assert.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <map>
+#include <sstream>
+#include "method-code.h"
+#include "emit.h"
+#include "stats.h"
+
+char *MethodCode::new_temp(bool raw)
+{
+  std::ostringstream name;
+  name << "%t" << temp_raw.size();
+  temp_names.push_back(name.str());
+  temp_raw.push_back(raw);
+  return (char *) temp_names.back().c_str();
+}
+
+//
+// The number of the temporary `arg', or -1 if it is not one.
+//
+int MethodCode::temp_number(const std::string& arg)
+{
+  if (arg.size() < 3 || arg[0] != '%' || arg[1] != 't')
+    return -1;
+  return atoi(arg.c_str() + 2);
+}
+
+//
+// What an instruction does with its operands and with the flow of
+// control.  Every instruction cgen writes but a store, a branch, a jump
+// and a call puts its result in its first operand.
+//
+static bool is_call(const MipsInsn& in)
+{
+  return in.op == "jal" || in.op == "jalr";
+}
+
+static bool is_branch(const MipsInsn& in)
+{
+  return !in.op.empty() && in.op[0] == 'b';
+}
+
+static bool falls_through(const MipsInsn& in)
+{
+  return in.op != "b" && in.op != "j" && in.op != "jr";
+}
+
+static bool writes_first(const MipsInsn& in)
+{
+  return !in.op.empty() && in.op != "sw" && in.op != "sb" &&
+         !is_branch(in) && in.op[0] != 'j';
+}
+
+void MethodCode::read(const std::string& text)
+{
+  std::istringstream in(text);
+  std::string line;
+  while (std::getline(in, line)) {
+    std::istringstream words(line);
+    std::string w;
+    if (!(words >> w))
+      continue;
+    MipsInsn insn;
+    if (w[w.size() - 1] == ':')
+      insn.label = w.substr(0, w.size() - 1);
+    else {
+      insn.op = w;
+      while (words >> w)
+        insn.args.push_back(w);
+      if (is_call(insn))
+        calls = true;
+    }
+    insns.push_back(insn);
+  }
+}
+
+void MethodCode::write(ostream& s)
+{
+  for (size_t i = 0; i < insns.size(); i++) {
+    const MipsInsn& in = insns[i];
+    if (in.op.empty()) {
+      s << in.label << LABEL;
+      continue;
+    }
+    s << "\t" << in.op;
+    for (size_t k = 0; k < in.args.size(); k++)
+      s << (k == 0 ? "\t" : " ") << in.args[k];
+    s << endl;
+  }
+}
+
+//
+// The address of frame word `word', counted down from FP.
+//
+static std::string frame_word(int word)
+{
+  std::ostringstream addr;
+  addr << -(word + 1) * WORD_SIZE << "(" FP ")";
+  return addr.str();
+}
+
+void MethodCode::allocate_registers()
+{
+  size_t n = insns.size();
+  size_t ntemps = temp_raw.size();
+  if (ntemps == 0)
+    return;
+
+  // The moves that write and that read each temporary, in order.
+  std::vector<std::vector<int> > defs(ntemps), uses(ntemps);
+  std::map<std::string, size_t> labels;
+  for (size_t i = 0; i < n; i++) {
+    if (insns[i].op.empty())
+      labels[insns[i].label] = i;
+    for (size_t k = 0; k < insns[i].args.size(); k++) {
+      int t = temp_number(insns[i].args[k]);
+      if (t < 0)
+        continue;
+      assert(insns[i].op == "move");
+      if (k == 0 && writes_first(insns[i]))
+        defs[t].push_back(i);
+      else
+        uses[t].push_back(i);
+    }
+  }
+
+  // The basic blocks, which start at a label and after a branch or a
+  // jump, and the blocks that may go to each.  calls_before[i] is the
+  // number of calls before instruction i.
+  std::vector<int> block_of(n), block_start, block_end;
+  std::vector<int> calls_before(n + 1);
+  for (size_t i = 0; i < n; i++) {
+    if (i == 0 || insns[i].op.empty() || is_branch(insns[i - 1]) ||
+        !falls_through(insns[i - 1])) {
+      block_start.push_back(i);
+      block_end.push_back(i);
+    }
+    block_of[i] = block_start.size() - 1;
+    block_end.back() = i;
+    calls_before[i + 1] = calls_before[i] + (is_call(insns[i]) ? 1 : 0);
+  }
+  size_t nblocks = block_start.size();
+  std::vector<std::vector<int> > preds(nblocks);
+  for (size_t b = 0; b < nblocks; b++) {
+    const MipsInsn& last = insns[block_end[b]];
+    if (falls_through(last) && b + 1 < nblocks)
+      preds[b + 1].push_back(b);
+    if (is_branch(last) && labels.count(last.args.back()))
+      preds[block_of[labels[last.args.back()]]].push_back(b);
+  }
+
+  // The live range of each temporary, from the first instruction that
+  // writes it or where it is live to the last where it is, and whether
+  // it holds a value across a call.  A temporary is only in a few moves,
+  // so each range is found on its own: from every move that reads it,
+  // back to the last write before it in the block, or else through the
+  // blocks before, where it is live at the end.  The time taken is that
+  // of the blocks a range covers, not that of the whole method.
+  std::vector<int> start(ntemps, -1), end(ntemps, -1);
+  std::vector<bool> across_call(ntemps);
+  std::vector<size_t> live_at_end(nblocks, ntemps);  // for which temporary
+  std::vector<int> work;
+  for (size_t t = 0; t < ntemps; t++) {
+    const std::vector<int>& d = defs[t];
+
+    // Instructions from..to are in the range; the value is held across
+    // the calls among them, but for `to' unless it is live after `to'.
+    auto cover = [&](int from, int to, bool after) {
+      if (start[t] < 0 || from < start[t])
+        start[t] = from;
+      if (to > end[t])
+        end[t] = to;
+      if (calls_before[to + after] > calls_before[from])
+        across_call[t] = true;
+    };
+
+    // It is live before instruction `to' of block b, or after it.
+    auto live = [&](int b, int to, bool after) {
+      std::vector<int>::const_iterator w =
+        std::lower_bound(d.begin(), d.end(), to + after);
+      if (w != d.begin() && *(w - 1) >= block_start[b]) {
+        cover(*(w - 1), to, after);
+        return;
+      }
+      cover(block_start[b], to, after);
+      for (size_t p = 0; p < preds[b].size(); p++)
+        if (live_at_end[preds[b][p]] != t) {
+          live_at_end[preds[b][p]] = t;
+          work.push_back(preds[b][p]);
+        }
+    };
+
+    for (size_t k = 0; k < d.size(); k++)
+      cover(d[k], d[k], false);
+    for (size_t k = 0; k < uses[t].size(); k++)
+      live(block_of[uses[t][k]], uses[t][k], false);
+    while (!work.empty()) {
+      int b = work.back();
+      work.pop_back();
+      live(b, block_end[b], true);
+    }
+  }
+
+  // Linear scan.  A register or slot is free for a range that starts
+  // after the ends of all the ranges given it so far.
+  // The first seven registers are caller saved, the others callee saved.
+  static const char *regs[] = {
+    "$t0", "$t4", "$t5", "$t6", "$t7", "$t8", "$t9",
+    "$s1", "$s2", "$s3", "$s4", "$s5", "$s6", "$s7"
+  };
+  const int NREGS = 14, FIRST_CALLEE_SAVED = 7;
+  std::vector<int> reg_end(NREGS, -1), reg_owner(NREGS, -1);
+  std::vector<int> reg_of(ntemps, -1), slot_of(ntemps, -1);
+  std::vector<int> slot_end[2];                 // pointer and raw slots
+
+  std::vector<size_t> order;
+  for (size_t t = 0; t < ntemps; t++)
+    if (start[t] >= 0)
+      order.push_back(t);
+  std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+    return start[a] < start[b];
+  });
+
+  auto may_use = [&](size_t t, int r) {
+    return r >= FIRST_CALLEE_SAVED ? !across_call[t] || temp_raw[t]
+                                   : !across_call[t];
+  };
+  auto give_slot = [&](size_t t) {
+    std::vector<int>& ends = slot_end[temp_raw[t] ? 1 : 0];
+    size_t k = 0;
+    while (k < ends.size() && ends[k] >= start[t])
+      k++;
+    if (k == ends.size())
+      ends.push_back(-1);
+    ends[k] = end[t];
+    slot_of[t] = k;
+  };
+
+  for (size_t i = 0; i < order.size(); i++) {
+    size_t t = order[i];
+    int r = 0;
+    while (r < NREGS && !(may_use(t, r) && reg_end[r] < start[t]))
+      r++;
+    if (r == NREGS) {
+      // None is free: take the one of the range that goes on longest,
+      // if that is longer than this one, and give that range a slot.
+      int victim = -1;
+      for (int q = 0; q < NREGS; q++)
+        if (may_use(t, q) && reg_end[q] > end[t] &&
+            (victim < 0 || reg_end[q] > reg_end[victim]))
+          victim = q;
+      if (victim < 0) {
+        give_slot(t);
+        continue;
+      }
+      size_t v = reg_owner[victim];
+      reg_of[v] = -1;
+      give_slot(v);
+      r = victim;
+    }
+    reg_of[t] = r;
+    reg_owner[r] = t;
+    reg_end[r] = end[t];
+  }
+
+  // The frame: after the variables, the callee saved registers used,
+  // the pointer slots and the raw slots.
+  for (int r = FIRST_CALLEE_SAVED; r < NREGS; r++)
+    if (reg_owner[r] >= 0)
+      saved.push_back(regs[r]);
+  pointer_slots = slot_end[0].size();
+  slots = pointer_slots + slot_end[1].size();
+
+  int in_registers = 0;
+  for (size_t t = 0; t < ntemps; t++)
+    if (reg_of[t] >= 0)
+      in_registers++;
+  stats_count("temporaries", order.size());
+  stats_count("temporaries in registers", in_registers);
+
+  // Each temporary becomes its register, and a move to or from one in a
+  // slot a store or a load.
+  std::vector<MipsInsn> done;
+  for (size_t i = 0; i < n; i++) {
+    MipsInsn in = insns[i];
+    int slotted = -1;
+    for (size_t k = 0; k < in.args.size(); k++) {
+      int t = temp_number(in.args[k]);
+      if (t < 0)
+        continue;
+      if (reg_of[t] >= 0)
+        in.args[k] = regs[reg_of[t]];
+      else {
+        assert(slotted < 0);
+        slotted = k;
+      }
+    }
+    if (slotted >= 0) {
+      int t = temp_number(in.args[slotted]);
+      int word = locals + saved.size() + slot_of[t] +
+                 (temp_raw[t] ? pointer_slots : 0);
+      std::string reg = in.args[1 - slotted];
+      in.op = slotted == 0 ? "sw" : "lw";
+      in.args[0] = reg;
+      in.args[1] = frame_word(word);
+    }
+    if (in.op == "move" && in.args[0] == in.args[1])
+      continue;
+    done.push_back(in);
+  }
+  insns.swap(done);
+}
+
+//
+// Peephole optimization.
+//
+// The register of an offset(register) address, or else the operand.
+//
+static std::string base_register(const std::string& arg)
+{
+  size_t open = arg.find('(');
+  if (open == std::string::npos)
+    return arg;
+  return arg.substr(open + 1, arg.size() - open - 2);
+}
+
+static bool is_label(const MipsInsn& in)
+{
+  return in.op.empty();
+}
+
+//
+// Whether `in' may read register `r'.  A call or a return may read any.
+//
+static bool reads(const MipsInsn& in, const std::string& r)
+{
+  if (is_call(in) || in.op == "jr")
+    return true;
+  for (size_t k = writes_first(in) ? 1 : 0; k < in.args.size(); k++)
+    if (base_register(in.args[k]) == r)
+      return true;
+  return false;
+}
+
+//
+// Whether `in' puts a new value in `r' without reading it first.
+//
+static bool overwrites(const MipsInsn& in, const std::string& r)
+{
+  return writes_first(in) && in.args[0] == r && !reads(in, r);
+}
+
+//
+// Whether `in' only writes its first operand, which is not $sp or $fp.
+//
+static bool only_writes(const MipsInsn& in)
+{
+  return (in.op == "move" || in.op == "la" || in.op == "li" ||
+          in.op == "lw") &&
+         in.args[0] != SP && in.args[0] != FP;
+}
+
+static MipsInsn insn(const char *op, const std::string& a,
+                     const std::string& b)
+{
+  MipsInsn in;
+  in.op = op;
+  in.args.push_back(a);
+  in.args.push_back(b);
+  return in;
+}
+
+//
+// The rules.  Each looks at a window of instructions and, if it applies,
+// puts what replaces them in `out'.
+//
+
+// move r r  =>
+static bool move_to_self(const MipsInsn *w, std::vector<MipsInsn>& out)
+{
+  return w[0].op == "move" && w[0].args[0] == w[0].args[1];
+}
+
+// sw r 0($sp); addiu $sp $sp -4; lw r2 4($sp); addiu $sp $sp 4  =>
+// move r2 r
+static bool push_pop(const MipsInsn *w, std::vector<MipsInsn>& out)
+{
+  if (w[0].op != "sw" || w[0].args[1] != "0(" SP ")" ||
+      w[1].op != "addiu" || w[1].args[0] != SP || w[1].args[2] != "-4" ||
+      w[2].op != "lw" || w[2].args[1] != "4(" SP ")" ||
+      w[3].op != "addiu" || w[3].args[0] != SP || w[3].args[2] != "4")
+    return false;
+  out.push_back(insn("move", w[2].args[0], w[0].args[0]));
+  return true;
+}
+
+// sw r X; lw r2 X  =>  sw r X; move r2 r
+static bool load_of_stored(const MipsInsn *w, std::vector<MipsInsn>& out)
+{
+  if (w[0].op != "sw" || w[1].op != "lw" || w[0].args[1] != w[1].args[1])
+    return false;
+  out.push_back(w[0]);
+  out.push_back(insn("move", w[1].args[0], w[0].args[0]));
+  return true;
+}
+
+// lw r A; I; lw r A  =>  lw r A; I
+// (and so for la and li) where I leaves r and the word at A as they were.
+static bool reload(const MipsInsn *w, std::vector<MipsInsn>& out)
+{
+  if (!only_writes(w[0]) || w[0].op == "move" ||
+      w[2].op != w[0].op || w[2].args != w[0].args)
+    return false;
+  const std::string& r = w[0].args[0];
+  std::string base = w[0].op == "lw" ? base_register(w[0].args[1]) : "";
+  if (base == r)
+    return false;
+  if (w[1].op == "sw") {
+    // A store elsewhere in the same frame or object.
+    if (w[0].op == "lw" && (base_register(w[1].args[1]) != base ||
+                            w[1].args[1] == w[0].args[1]))
+      return false;
+  } else if (!writes_first(w[1]) || w[1].args[0] == r ||
+             w[1].args[0] == base)
+    return false;
+  out.push_back(w[0]);
+  out.push_back(w[1]);
+  return true;
+}
+
+// I1 r ...; I2 r ...  =>  I2 r ...
+// where I1 only writes r and I2 writes it again without reading it.
+static bool dead_write(const MipsInsn *w, std::vector<MipsInsn>& out)
+{
+  if (!only_writes(w[0]) || !overwrites(w[1], w[0].args[0]))
+    return false;
+  out.push_back(w[1]);
+  return true;
+}
+
+// I r ...; move r2 r; I3 r ...  =>  I r2 ...; I3 r ...
+// where I only writes r and I3 writes it again without reading it.
+static bool write_into_copy(const MipsInsn *w, std::vector<MipsInsn>& out)
+{
+  if (!only_writes(w[0]))
+    return false;
+  const std::string& r = w[0].args[0];
+  if (w[1].op != "move" || w[1].args[1] != r ||
+      w[1].args[0] == r || !overwrites(w[2], r))
+    return false;
+  out.push_back(w[0]);
+  out.back().args[0] = w[1].args[0];
+  out.push_back(w[2]);
+  return true;
+}
+
+// move r r2; I r ... r ...  =>  I r ... r2 ...
+// where I writes r after reading it.
+static bool copy_into_use(const MipsInsn *w, std::vector<MipsInsn>& out)
+{
+  if (w[0].op != "move" || !writes_first(w[1]) ||
+      w[1].args[0] != w[0].args[0] || !reads(w[1], w[0].args[0]))
+    return false;
+  const std::string& r = w[0].args[0];
+  MipsInsn in = w[1];
+  for (size_t k = 1; k < in.args.size(); k++) {
+    std::string& arg = in.args[k];
+    if (arg == r)
+      arg = w[0].args[1];
+    else if (base_register(arg) == r)
+      arg = arg.substr(0, arg.find('(')) + "(" + w[0].args[1] + ")";
+  }
+  out.push_back(in);
+  return true;
+}
+
+// move $a0 $s0; bne $a0 $zero L  =>  move $a0 $s0; b L
+// since self is never void.
+static bool self_void_check(const MipsInsn *w, std::vector<MipsInsn>& out)
+{
+  if (w[0].op != "move" || w[0].args[0] != ACC || w[0].args[1] != SELF ||
+      w[1].op != "bne" || w[1].args[0] != ACC || w[1].args[1] != ZERO)
+    return false;
+  out.push_back(w[0]);
+  MipsInsn b;
+  b.op = "b";
+  b.args.push_back(w[1].args[2]);
+  out.push_back(b);
+  return true;
+}
+
+// b L; I  =>  b L
+// where I is not a label.
+static bool unreachable(const MipsInsn *w, std::vector<MipsInsn>& out)
+{
+  if (is_label(w[0]) || falls_through(w[0]) || is_label(w[1]))
+    return false;
+  out.push_back(w[0]);
+  return true;
+}
+
+// b L; L:  =>  L:
+static bool branch_to_next(const MipsInsn *w, std::vector<MipsInsn>& out)
+{
+  if (!is_branch(w[0]) || !is_label(w[1]) ||
+      w[0].args.back() != w[1].label)
+    return false;
+  out.push_back(w[1]);
+  return true;
+}
+
+struct PeepholeRule {
+  const char *name;             // of its count in the statistics
+  size_t window;                // the instructions it looks at
+  bool labels;                  // whether they may be labels
+  bool (*rewrite)(const MipsInsn *w, std::vector<MipsInsn>& out);
+};
+
+static const PeepholeRule peephole_rules[] = {
+  { "peephole: moves to self",           1, false, move_to_self },
+  { "peephole: pushes popped",           4, false, push_pop },
+  { "peephole: loads of a stored word",  2, false, load_of_stored },
+  { "peephole: reloads",                 3, false, reload },
+  { "peephole: dead writes",             2, false, dead_write },
+  { "peephole: writes into a copy",      3, false, write_into_copy },
+  { "peephole: copies into a use",       2, false, copy_into_use },
+  { "peephole: void checks of self",     2, false, self_void_check },
+  { "peephole: unreachable instructions", 2, true, unreachable },
+  { "peephole: branches to the next",    2, true,  branch_to_next },
+};
+
+static const size_t NRULES = sizeof(peephole_rules) / sizeof(PeepholeRule);
+
+//
+// One pass forward: each instruction is moved to the output in turn,
+// and the rules tried on the windows that end with it.  What a rule
+// puts in place of a window goes back to the input, with the few
+// instructions before it that a window can take in, so that it is
+// looked at again.  A label that nothing branches to is dropped too,
+// so that the windows can take in the code around it; the labels
+// mipsrun counts (emit.h) are kept.  How many instructions name each
+// label is kept up to date as the rules rewrite them.
+//
+void MethodCode::peephole()
+{
+  std::vector<long> hits(NRULES);
+  long labels_dropped = 0;
+  size_t max_window = 0;
+  for (size_t r = 0; r < NRULES; r++)
+    max_window = std::max(max_window, peephole_rules[r].window);
+
+  std::map<std::string, int> uses;
+  auto count_uses = [&](const MipsInsn& in, int n) {
+    if (!is_label(in) && !in.args.empty())
+      uses[in.args.back()] += n;
+  };
+  auto unused_label = [&](const MipsInsn& in) {
+    return is_label(in) && in.label.compare(0, 5, "label") == 0 &&
+           uses[in.label] == 0;
+  };
+  for (size_t i = 0; i < insns.size(); i++)
+    count_uses(insns[i], 1);
+
+  std::vector<MipsInsn> in(insns.rbegin(), insns.rend());  // next last
+  std::vector<MipsInsn> out;
+  while (!in.empty()) {
+    out.push_back(std::move(in.back()));
+    in.pop_back();
+    if (unused_label(out.back())) {
+      out.pop_back();
+      labels_dropped++;
+      continue;
+    }
+    for (size_t r = 0; r < NRULES; r++) {
+      const PeepholeRule& rule = peephole_rules[r];
+      if (rule.window > out.size())
+        continue;
+      const MipsInsn *w = &out[out.size() - rule.window];
+      if (!rule.labels && std::any_of(w, w + rule.window, is_label))
+        continue;
+      std::vector<MipsInsn> rewritten;
+      if (!rule.rewrite(w, rewritten))
+        continue;
+      hits[r]++;
+      for (size_t k = 0; k < rule.window; k++)
+        count_uses(w[k], -1);
+      for (size_t k = 0; k < rewritten.size(); k++)
+        count_uses(rewritten[k], 1);
+      out.resize(out.size() - rule.window);
+      for (size_t k = rewritten.size(); k-- > 0; )
+        in.push_back(std::move(rewritten[k]));
+      for (size_t k = 1; k < max_window && !out.empty(); k++) {
+        in.push_back(std::move(out.back()));
+        out.pop_back();
+      }
+      break;
+    }
+  }
+
+  // The labels whose last use went after they were passed.
+  std::vector<MipsInsn> kept;
+  for (size_t i = 0; i < out.size(); i++) {
+    if (unused_label(out[i])) {
+      labels_dropped++;
+      continue;
+    }
+    kept.push_back(std::move(out[i]));
+  }
+  insns.swap(kept);
+
+  for (size_t r = 0; r < NRULES; r++)
+    stats_count(peephole_rules[r].name, hits[r]);
+  stats_count("peephole: labels never used", labels_dropped);
+}
+
+//
+// The callee saved registers the method uses are kept after the
+// variables.  The variables and the pointer slots start as void, so that
+// the collector never finds a stale word there; unless the method makes
+// no call, when no collection can happen while it runs.
+//
+void MethodCode::emit_save_registers(ostream& s)
+{
+  for (size_t i = 0; i < saved.size(); i++)
+    s << SW << saved[i] << " " << frame_word(locals + i) << endl;
+  if (!calls)
+    return;
+  for (int k = 0; k < locals; k++)
+    s << SW << ZERO << " " << frame_word(k) << endl;
+  for (int k = 0; k < pointer_slots; k++)
+    s << SW << ZERO << " " << frame_word(locals + saved.size() + k) << endl;
+}
+
+void MethodCode::emit_restore_registers(ostream& s)
+{
+  for (size_t i = 0; i < saved.size(); i++)
+    s << LW << saved[i] << " " << frame_word(locals + i) << endl;
+}
@@ -0,0 +1,113 @@
+// -*-Mode: C++;-*-
+//
+// See copyright.h for copyright notice and limitation of liability
+// and disclaimer of warranty provisions.
+//
+#include "copyright.h"
+
+#ifndef _METHOD_CODE_H_
+#define _METHOD_CODE_H_
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  method-code.h
+//
+//  The code of one method, held between the code methods of the
+//  expressions, which write it as text, and the output, so that it can
+//  be improved as a whole first.  cgen writes the body of a method to a
+//  string and MethodCode reads it back as a list of instructions.
+//
+//  The body may use temporaries, which new_temp names %t0, %t1, ...:
+//  each holds a value the code keeps for later, either a pointer (an
+//  object, or void) or a raw word, and is only ever the source or the
+//  destination of a move.  allocate_registers gives every temporary a
+//  register or a frame slot:
+//
+//    - the live range of each is found from the moves that read it,
+//      back through the basic blocks to the moves that write it, so
+//      that the time taken grows with the ranges and not with the
+//      instructions times the temporaries;
+//
+//    - the ranges are then handed out in order of their start (linear
+//      scan).  One that holds no value across a call gets a free caller
+//      saved register, $t0 or $t4-$t9, or else a free callee saved one,
+//      $s1-$s7.  A raw word held across a call gets a callee saved
+//      register.  Any other, and any for which no register is free,
+//      gets a frame slot; so does a pointer held across a call, since
+//      the collector only finds pointers on the stack;
+//
+//    - the temporaries are replaced by their registers, and a move to
+//      or from one in a slot by a store or a load.
+//
+//  The frame then has frame_words() words below the words the prologue
+//  always saves: the let and case variables, whose words cgen gave out
+//  as it wrote the body (set_locals), the callee saved registers the
+//  method uses, and the slots.
+//
+//  With -O peephole then rewrites the instructions through a window of a
+//  few at a time, by the rules of the table in method-code.cc: a push
+//  and a pop that only move a register, a load of what was just stored,
+//  a move of a register to itself, a branch to the next instruction, the
+//  code after a jump up to the next label, and so on.  Each rule counts
+//  its rewrites in the statistics (-stats).
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include <deque>
+#include <string>
+#include <vector>
+#include "cool-io.h"
+
+//
+// An instruction as cgen wrote it, or the definition of a label (op
+// empty).  The operands are registers, immediates, labels and
+// offset(register) addresses.
+//
+struct MipsInsn {
+  std::string label;
+  std::string op;
+  std::vector<std::string> args;
+};
+
+class MethodCode {
+private:
+  std::vector<MipsInsn> insns;
+  std::deque<std::string> temp_names;   // %t<n>; new_temp gives out c_str()s
+  std::vector<bool> temp_raw;           // of each temporary: not a pointer
+  bool calls;                           // whether it makes any call
+  int locals;                           // words of the let and case variables
+  std::vector<std::string> saved;       // callee saved registers it uses
+  int slots;                            // frame slots
+  int pointer_slots;                    // the first ones, which hold pointers
+
+  int temp_number(const std::string& arg);
+
+public:
+  MethodCode() : calls(false), locals(0), slots(0), pointer_slots(0) { }
+
+  // A new temporary, for a pointer unless `raw'.
+  char *new_temp(bool raw);
+
+  // Reads the instructions of `text', one per line.
+  void read(const std::string& text);
+
+  // The words at the top of the frame that hold the let and case
+  // variables (and with -r the temporaries).
+  void set_locals(int words) { locals = words; }
+
+  // Puts the temporaries in registers and frame slots.
+  void allocate_registers();
+
+  // Rewrites redundant sequences of instructions (-O).
+  void peephole();
+
+  // The words of the frame below the saved ones, and what the prologue
+  // and epilogue must do with them.
+  int frame_words() { return locals + saved.size() + slots; }
+  void emit_save_registers(ostream& s);
+  void emit_restore_registers(ostream& s);
+
+  void write(ostream& s);
+};
+
+#endif
@@ -0,0 +1,445 @@
+//
+// See copyright.h for copyright notice and limitation of liability
+// and disclaimer of warranty provisions.
+//
+#include "copyright.h"
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  microbench.cc
+//
+//  Times the data structures the phases are built on, each on its own,
+//  at sizes from 10 to 10^6:
+//
+//      microbench [-t seconds] [-m max-size] [name ...]
+//
+//  Only the benchmarks whose names contain one of the given names are
+//  run.  Each runs at sizes 10, 100, ... up to max-size (default
+//  1000000), repeating the work at a size until it has taken at least
+//  `seconds' (default 0.2), and prints the time per element:
+//
+//      benchmark                          size        ns/elem  iterations
+//      stringtable/add                      10         31.402      655360
+//      ...
+//
+//  A benchmark whose one iteration takes more than 50 times `seconds'
+//  stops there and skips its larger sizes, so that the quadratic ones
+//  finish; a line of "-" marks the sizes it skipped.  These numbers are
+//  the baseline that replacements of the data structures are measured
+//  against.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "cool-io.h"
+#include "cool-tree.h"
+#include "symtab.h"
+#include "stringtab.h"
+#include "ast-stream.h"
+
+extern void emit_string_constant(ostream& str, char *s);
+
+// not used, but needed to link with cgen.cc and handle_flags.cc
+FILE *ast_file;
+AstStreamReader *ast_class_bodies = NULL;
+int cool_yydebug;
+
+//
+// What a benchmark sees of its run: the size, and a loop that repeats
+// until enough time has passed.  As in google-benchmark, the work to
+// time goes in the body of
+//
+//      while (state.keep_running()) ...
+//
+// and setup before the loop is not timed.  pause and resume leave out
+// the setup done inside the loop.
+//
+class BenchState {
+private:
+  typedef std::chrono::steady_clock Clock;
+  long iterations;              // to run
+  long done;
+  Clock::time_point start;
+  double paused;                // seconds not to count
+  Clock::time_point pause_start;
+public:
+  long size;
+  double seconds;               // of the last run
+
+  BenchState(long n, long iters)
+    : iterations(iters), done(-1), paused(0), size(n), seconds(0) { }
+  bool keep_running() {
+    if (done < 0)
+      start = Clock::now();
+    if (++done < iterations)
+      return true;
+    seconds = std::chrono::duration<double>(Clock::now() - start).count()
+              - paused;
+    return false;
+  }
+  void pause()  { pause_start = Clock::now(); }
+  void resume() {
+    paused += std::chrono::duration<double>(Clock::now() - pause_start)
+              .count();
+  }
+};
+
+//
+// Keeps the compiler from dropping work whose result is not used.
+//
+static volatile long sink;
+
+//
+// `size' distinct strings, made once for all the benchmarks.
+//
+static std::vector<std::string> names;
+
+static void make_names(long n)
+{
+  char buf[32];
+  for (long i = names.size(); i < n; i++) {
+    snprintf(buf, sizeof(buf), "name%ld", i);
+    names.push_back(buf);
+  }
+}
+
+//
+// Symbols that are not in any string table, for the symbol table.
+//
+static std::vector<Symbol> symbols;
+
+static void make_symbols(long n)
+{
+  make_names(n);
+  for (long i = symbols.size(); i < n; i++)
+    symbols.push_back(new IdEntry((char *) names[i].c_str(),
+                                  names[i].size(), i));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  StringTable<Elem>
+//
+//////////////////////////////////////////////////////////////////////////////
+
+static void bench_stringtable_add(BenchState& state)
+{
+  make_names(state.size);
+  while (state.keep_running()) {
+    IdTable table;
+    for (long i = 0; i < state.size; i++)
+      table.add_string((char *) names[i].c_str());
+    sink = (long) table.lookup_string((char *) names[0].c_str());
+  }
+}
+
+static void bench_stringtable_lookup(BenchState& state)
+{
+  make_names(state.size);
+  IdTable table;
+  for (long i = 0; i < state.size; i++)
+    table.add_string((char *) names[i].c_str());
+  while (state.keep_running())
+    for (long i = 0; i < state.size; i++)
+      sink = (long) table.add_string((char *) names[i].c_str());
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  SymbolTable<SYM,DAT>
+//
+//////////////////////////////////////////////////////////////////////////////
+
+static void bench_symtab_add(BenchState& state)
+{
+  make_symbols(state.size);
+  int data = 0;
+  while (state.keep_running()) {
+    SymbolTable<Symbol, int> table;
+    table.enterscope();
+    for (long i = 0; i < state.size; i++)
+      table.addid(symbols[i], &data);
+    table.exitscope();
+  }
+}
+
+//
+// A lookup of every symbol in a table with one scope per ten symbols.
+//
+static void bench_symtab_lookup(BenchState& state)
+{
+  make_symbols(state.size);
+  int data = 0;
+  SymbolTable<Symbol, int> table;
+  for (long i = 0; i < state.size; i++) {
+    if (i % 10 == 0)
+      table.enterscope();
+    table.addid(symbols[i], &data);
+  }
+  while (state.keep_running())
+    for (long i = 0; i < state.size; i++)
+      sink = (long) table.lookup(symbols[i]);
+}
+
+static void bench_symtab_probe_miss(BenchState& state)
+{
+  make_symbols(state.size + 1);
+  int data = 0;
+  SymbolTable<Symbol, int> table;
+  table.enterscope();
+  for (long i = 0; i < state.size; i++)
+    table.addid(symbols[i], &data);
+  Symbol missing = symbols[state.size];
+  while (state.keep_running())
+    for (long i = 0; i < state.size; i++)
+      sink = (long) table.probe(missing);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  list_node
+//
+//////////////////////////////////////////////////////////////////////////////
+
+static Expression leaf;
+
+//
+// A list grown one element at a time with append, the way the parser
+// used to build it.
+//
+static Expressions appended_list(long n)
+{
+  Expressions l = nil_Expressions();
+  for (long i = 0; i < n; i++)
+    l = append_Expressions(l, single_Expressions(leaf));
+  return l;
+}
+
+static Expressions flat_list(long n)
+{
+  list_buffer<Expression> *b = new list_buffer<Expression>;
+  for (long i = 0; i < n; i++)
+    b = b->add(leaf);
+  return finish_list(b);
+}
+
+static void bench_list_append(BenchState& state)
+{
+  while (state.keep_running())
+    sink = (long) appended_list(state.size);
+}
+
+static void bench_list_buffer(BenchState& state)
+{
+  while (state.keep_running())
+    sink = (long) flat_list(state.size);
+}
+
+static void bench_list_len(BenchState& state)
+{
+  Expressions l = appended_list(state.size);
+  while (state.keep_running())
+    sink = l->len();
+}
+
+//
+// The loop every phase uses to walk a list.
+//
+static void iterate(BenchState& state, Expressions l)
+{
+  while (state.keep_running())
+    for (int i = l->first(); l->more(i); i = l->next(i))
+      sink = (long) l->nth(i);
+}
+
+static void bench_list_iterate_appended(BenchState& state)
+{
+  iterate(state, appended_list(state.size));
+}
+
+static void bench_list_iterate_flat(BenchState& state)
+{
+  iterate(state, flat_list(state.size));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  copy_Expression
+//
+//////////////////////////////////////////////////////////////////////////////
+
+//
+// A balanced tree of n - 1 plus nodes over n leaves, so that copying
+// it does not recurse deeper than log n.
+//
+static Expression plus_tree(long n)
+{
+  if (n <= 1)
+    return leaf->copy_Expression();
+  return plus(plus_tree(n / 2), plus_tree(n - n / 2));
+}
+
+static void bench_copy_expression(BenchState& state)
+{
+  Expression e = plus_tree(state.size);
+  while (state.keep_running())
+    sink = (long) e->copy_Expression();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  emit_string_constant
+//
+//////////////////////////////////////////////////////////////////////////////
+
+//
+// A string of `size' characters, one in ten of them escaped.
+//
+static void bench_emit_string_constant(BenchState& state)
+{
+  const char pattern[] = "Cool str\n\"";
+  std::string s;
+  for (long i = 0; i < state.size; i++)
+    s += pattern[i % 10];
+  std::ostringstream out;
+  while (state.keep_running()) {
+    state.pause();
+    out.str("");
+    state.resume();
+    emit_string_constant(out, (char *) s.c_str());
+  }
+  sink = out.str().size();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+struct Benchmark {
+  const char *name;
+  void (*run)(BenchState& state);
+};
+
+static Benchmark benchmarks[] = {
+  { "stringtable/add",             bench_stringtable_add },
+  { "stringtable/lookup",          bench_stringtable_lookup },
+  { "symtab/add",                  bench_symtab_add },
+  { "symtab/lookup",               bench_symtab_lookup },
+  { "symtab/probe_miss",           bench_symtab_probe_miss },
+  { "list/append",                 bench_list_append },
+  { "list/buffer",                 bench_list_buffer },
+  { "list/len",                    bench_list_len },
+  { "list/iterate_appended",       bench_list_iterate_appended },
+  { "list/iterate_flat",           bench_list_iterate_flat },
+  { "copy_Expression",             bench_copy_expression },
+  { "emit_string_constant",        bench_emit_string_constant },
+};
+
+#define NBENCHMARKS ((int) (sizeof(benchmarks) / sizeof(benchmarks[0])))
+
+struct BenchRun {
+  void (*run)(BenchState& state);
+  BenchState *state;
+};
+
+static void *bench_thread(void *arg)
+{
+  BenchRun *r = (BenchRun *) arg;
+  r->run(*r->state);
+  return NULL;
+}
+
+//
+// nth and len of a list built by append recurse once per element, so a
+// benchmark runs on a thread with a stack of BENCH_STACK bytes.
+//
+#define BENCH_STACK (1L << 30)
+
+static void run_on_big_stack(void (*run)(BenchState& state),
+                             BenchState& state)
+{
+  BenchRun r = { run, &state };
+  pthread_attr_t attr;
+  pthread_t thread;
+  pthread_attr_init(&attr);
+  pthread_attr_setstacksize(&attr, BENCH_STACK);
+  if (pthread_create(&thread, &attr, bench_thread, &r) != 0) {
+    cerr << "microbench: cannot start a benchmark thread\n";
+    exit(1);
+  }
+  pthread_join(thread, NULL);
+  pthread_attr_destroy(&attr);
+}
+
+static bool selected(const char *name, int nnames, char **names)
+{
+  if (nnames == 0)
+    return true;
+  for (int i = 0; i < nnames; i++)
+    if (strstr(name, names[i]))
+      return true;
+  return false;
+}
+
+int main(int argc, char **argv)
+{
+  double min_time = 0.2;
+  long max_size = 1000000;
+  int c;
+
+  while ((c = getopt(argc, argv, "t:m:")) != -1) {
+    switch (c) {
+    case 't': min_time = atof(optarg); break;
+    case 'm': max_size = atol(optarg); break;
+    default:
+      cerr << "usage: " << argv[0]
+           << " [-t seconds] [-m max-size] [name ...]\n";
+      exit(1);
+    }
+  }
+
+  leaf = int_const(inttable.add_int(0));
+  char line[200];
+  snprintf(line, sizeof(line), "%-28s %10s %14s %11s\n",
+           "benchmark", "size", "ns/elem", "iterations");
+  cout << line;
+  for (int b = 0; b < NBENCHMARKS; b++) {
+    if (!selected(benchmarks[b].name, argc - optind, argv + optind))
+      continue;
+    bool too_slow = false;
+    for (long n = 10; n <= max_size; n *= 10) {
+      if (too_slow) {
+        snprintf(line, sizeof(line), "%-28s %10ld %14s %11s\n",
+                 benchmarks[b].name, n, "-", "-");
+        cout << line;
+        cout.flush();
+        continue;
+      }
+      // Grow the iterations, by at most ten times, until the run is
+      // long enough.
+      long iters = 1;
+      BenchState state(n, iters);
+      for (;;) {
+        state = BenchState(n, iters);
+        run_on_big_stack(benchmarks[b].run, state);
+        if (state.seconds >= min_time || iters >= (1L << 30))
+          break;
+        double grow = state.seconds > 0 ? 1.4 * min_time / state.seconds : 10;
+        iters = grow > 10 ? 10 * iters : grow < 2 ? 2 * iters
+                : (long) (grow * iters);
+      }
+      snprintf(line, sizeof(line), "%-28s %10ld %14.3f %11ld\n",
+               benchmarks[b].name, n, state.seconds * 1e9 / iters / n, iters);
+      cout << line;
+      cout.flush();
+      too_slow = state.seconds / iters > 50 * min_time;
+    }
+  }
+  exit(0);
+}
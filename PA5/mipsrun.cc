@@ -0,0 +1,1122 @@
+//
+// See copyright.h for copyright notice and limitation of liability
+// and disclaimer of warranty provisions.
+//
+#include "copyright.h"
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  mipsrun.cc
+//
+//  Runs the assembly written by cgen, standing in for spim and the Cool
+//  runtime where they are not installed, and counts what the program
+//  did:
+//
+//      mipsrun [--stats[=json]] [-l limit] [-n nursery] file.s
+//
+//  The program reads standard input and writes standard output as it
+//  would under spim, ending with "COOL program successfully executed"
+//  if it returns from Main.main.  With --stats the counts are written
+//  to standard error when it stops:
+//
+//      instructions     the instructions of the program that ran
+//      runtime calls    calls of the routines of the runtime
+//      allocated        objects and bytes, eye catchers included
+//      gc cycles        collections (only with a collector, cgen -g)
+//      code size        instructions in the text segment
+//      ic lookups       calls through an inline cache, and the misses
+//                       (only with cgen --inline-cache)
+//
+//  Only the instructions cgen emits are understood, with the pseudo-
+//  instructions spim accepts for them.  The routines of trap.handler --
+//  Object.copy, the IO and String methods, equality_test, the aborts
+//  and the collector entry points -- are done here in C++; a call of
+//  one counts as one runtime call and its own instructions are not
+//  counted.  add, addi, sub and neg stop the program on overflow, as
+//  they trap in spim; addu, addiu, subu and mul wrap around.
+//
+//  When the program chose a collector, a mark and sweep collector runs
+//  whenever `nursery' bytes (default 512K) have been allocated since
+//  the last collection.  It finds the live objects from the registers
+//  and the stack, taking any word that is the address of an object as a
+//  pointer to it, and does not move them, so it needs nothing from the
+//  code besides the eye catchers.  Freed space is reused for new
+//  objects.  Without a collector the heap only grows.
+//
+//  -l stops the program after `limit' instructions.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <stdint.h>
+#include <map>
+#include <string>
+#include <vector>
+
+#define TEXT_BASE     0x00400000u
+#define RUNTIME_BASE  0x00300000u
+#define DATA_BASE     0x10000000u
+#define STACK_TOP     0x7ffffffcu
+#define STACK_SIZE    (64u << 20)
+
+//
+// The instructions, after the pseudo-instructions have been reduced to
+// the forms below.  An operand that may be a register or an immediate
+// is an immediate if `has_imm'.
+//
+enum Op {
+  OP_NOP, OP_LW, OP_SW, OP_LB, OP_LBU, OP_SB, OP_LI, OP_LA, OP_MOVE,
+  OP_NEG, OP_NOT, OP_ADD, OP_ADDU, OP_SUB, OP_SUBU, OP_MUL, OP_DIV,
+  OP_REM, OP_AND, OP_OR, OP_XOR, OP_SLL, OP_SRL, OP_SRA, OP_SLT,
+  OP_SLTU, OP_SEQ, OP_SNE, OP_SLE, OP_SGT, OP_SGE, OP_BEQ, OP_BNE,
+  OP_BLT, OP_BLE, OP_BGT, OP_BGE, OP_J, OP_JAL, OP_JR, OP_JALR
+};
+
+struct Insn {
+  Op op;
+  int rd, rs, rt;
+  bool has_imm;
+  int32_t imm;                  // immediate, offset or target address
+  int line;                     // in the .s file
+  std::string target;           // label to resolve, if any
+};
+
+//
+// The routines of trap.handler.
+//
+enum Routine {
+  RT_COPY, RT_ABORT, RT_TYPE_NAME, RT_OUT_STRING, RT_OUT_INT,
+  RT_IN_STRING, RT_IN_INT, RT_LENGTH, RT_CONCAT, RT_SUBSTR,
+  RT_EQUALITY_TEST, RT_DISPATCH_ABORT, RT_CASE_ABORT, RT_CASE_ABORT2,
+  RT_GENGC_ASSIGN, RT_GC_CHECK, RT_NOGC_INIT, RT_NOGC_COLLECT,
+  RT_GENGC_INIT, RT_GENGC_COLLECT, RT_SCNGC_INIT, RT_SCNGC_COLLECT,
+  RT_EXIT, RT_COUNT
+};
+
+static const char *routine_names[RT_COUNT] = {
+  "Object.copy", "Object.abort", "Object.type_name", "IO.out_string",
+  "IO.out_int", "IO.in_string", "IO.in_int", "String.length",
+  "String.concat", "String.substr", "equality_test", "_dispatch_abort",
+  "_case_abort", "_case_abort2", "_GenGC_Assign", "_gc_check",
+  "_NoGC_Init", "_NoGC_Collect", "_GenGC_Init", "_GenGC_Collect",
+  "_ScnGC_Init", "_ScnGC_Collect", "_cool_exit"
+};
+
+//
+// The runtime's entry: make Main, initialize it and call main.
+//
+static const char *startup =
+  "__start:\n"
+  "\tla\t$a0 Main_protObj\n"
+  "\tjal\tObject.copy\n"
+  "\tjal\tMain_init\n"
+  "\tjal\tMain.main\n"
+  "\tjal\t_cool_exit\n";
+
+static const char *program;                     // name of the .s file
+static std::vector<Insn> text;
+static std::vector<std::string> text_labels;    // the label before each
+static std::vector<uint8_t> probes;             // what each counts, if any
+static std::map<std::string, uint32_t> symbols;
+static std::vector<uint8_t> data;               // data, then the heap
+static std::vector<std::pair<uint32_t, std::string> > data_fixups;
+static uint8_t *stack;
+static uint32_t regs[32];
+
+struct Stats {
+  unsigned long long instructions;
+  unsigned long long runtime_calls;
+  unsigned long long calls[RT_COUNT];
+  unsigned long long objects;
+  unsigned long long allocated;
+  unsigned long long gc_cycles;
+  unsigned long long freed;
+  uint32_t peak_heap;
+  unsigned long long ic_lookups;        // of cgen --inline-cache
+  unsigned long long ic_misses;
+};
+static Stats stats;
+
+static void fail(const char *fmt, const char *arg = "", int line = 0)
+{
+  fprintf(stderr, "mipsrun: %s", program);
+  if (line)
+    fprintf(stderr, ":%d", line);
+  fprintf(stderr, ": ");
+  fprintf(stderr, fmt, arg);
+  fprintf(stderr, "\n");
+  exit(2);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  Loading
+//
+//////////////////////////////////////////////////////////////////////////////
+
+static int reg_number(const std::string& r, int line)
+{
+  static const char *names[32] = {
+    "zero", "at", "v0", "v1", "a0", "a1", "a2", "a3",
+    "t0", "t1", "t2", "t3", "t4", "t5", "t6", "t7",
+    "s0", "s1", "s2", "s3", "s4", "s5", "s6", "s7",
+    "t8", "t9", "k0", "k1", "gp", "sp", "fp", "ra"
+  };
+  if (r.size() < 2 || r[0] != '$')
+    fail("register expected, not `%s'", r.c_str(), line);
+  std::string n = r.substr(1);
+  if (isdigit(n[0]))
+    return atoi(n.c_str()) & 31;
+  for (int i = 0; i < 32; i++)
+    if (n == names[i])
+      return i;
+  fail("unknown register `%s'", r.c_str(), line);
+  return 0;
+}
+
+static bool is_number(const std::string& s)
+{
+  size_t i = (s[0] == '-' || s[0] == '+') ? 1 : 0;
+  return i < s.size() && isdigit(s[i]);
+}
+
+//
+// Splits an instruction or directive into its words, at blanks and
+// commas.
+//
+static std::vector<std::string> split(const std::string& s)
+{
+  std::vector<std::string> words;
+  std::string w;
+  for (size_t i = 0; i < s.size(); i++) {
+    if (isspace(s[i]) || s[i] == ',') {
+      if (!w.empty())
+        words.push_back(w);
+      w.clear();
+    } else
+      w += s[i];
+  }
+  if (!w.empty())
+    words.push_back(w);
+  return words;
+}
+
+static void put_word(uint32_t addr, uint32_t w)
+{
+  memcpy(&data[addr - DATA_BASE], &w, 4);
+}
+
+static void data_word(const std::string& v)
+{
+  uint32_t addr = DATA_BASE + data.size();
+  data.resize(data.size() + 4);
+  if (is_number(v))
+    put_word(addr, (uint32_t) strtol(v.c_str(), NULL, 0));
+  else
+    data_fixups.push_back(std::make_pair(addr, v));
+}
+
+static void data_ascii(const std::string& line, size_t start, int lineno)
+{
+  size_t i = line.find('"', start);
+  if (i == std::string::npos)
+    fail("string expected", "", lineno);
+  for (i++; i < line.size() && line[i] != '"'; i++) {
+    char c = line[i];
+    if (c == '\\' && i + 1 < line.size()) {
+      c = line[++i];
+      switch (c) {
+      case 'n': c = '\n'; break;
+      case 't': c = '\t'; break;
+      case 'b': c = '\b'; break;
+      case 'f': c = '\f'; break;
+      case '0': c = '\0'; break;
+      }
+    }
+    data.push_back((uint8_t) c);
+  }
+}
+
+//
+// The operands of the instructions that take a register, or an
+// immediate, as their last source.
+//
+static void reg_or_imm(Insn& in, const std::string& s, int line)
+{
+  if (s[0] == '$')
+    in.rt = reg_number(s, line);
+  else {
+    in.has_imm = true;
+    in.imm = (int32_t) strtol(s.c_str(), NULL, 0);
+  }
+}
+
+static Insn parse_insn(const std::vector<std::string>& w, int line)
+{
+  static std::map<std::string, Op> ops;
+  if (ops.empty()) {
+    const char *names[] = {
+      "nop", "lw", "sw", "lb", "lbu", "sb", "li", "la", "move", "neg",
+      "not", "add", "addu", "sub", "subu", "mul", "div", "rem", "and",
+      "or", "xor", "sll", "srl", "sra", "slt", "sltu", "seq", "sne",
+      "sle", "sgt", "sge", "beq", "bne", "blt", "ble", "bgt", "bge", "j",
+      "jal", "jr", "jalr"
+    };
+    for (int i = 0; i <= OP_JALR; i++)
+      ops[names[i]] = (Op) i;
+    ops["addi"] = OP_ADD;
+    ops["addiu"] = OP_ADDU;
+    ops["andi"] = OP_AND;
+    ops["ori"] = OP_OR;
+    ops["xori"] = OP_XOR;
+    ops["slti"] = OP_SLT;
+    ops["sltiu"] = OP_SLTU;
+    ops["b"] = OP_J;
+  }
+
+  Insn in;
+  in.rd = in.rs = in.rt = 0;
+  in.has_imm = false;
+  in.imm = 0;
+  in.line = line;
+  std::string name = w[0];
+  size_t n = w.size();
+
+  // The branches that compare with zero are beq, bne, ... with $zero.
+  static const char *zero_branches[][2] = {
+    { "beqz", "beq" }, { "bnez", "bne" }, { "bltz", "blt" },
+    { "blez", "ble" }, { "bgtz", "bgt" }, { "bgez", "bge" }
+  };
+  for (int i = 0; i < 6; i++)
+    if (name == zero_branches[i][0]) {
+      if (n != 3)
+        fail("%s takes a register and a label", name.c_str(), line);
+      in.op = ops[zero_branches[i][1]];
+      in.rs = reg_number(w[1], line);
+      in.rt = 0;
+      in.target = w[2];
+      return in;
+    }
+
+  std::map<std::string, Op>::iterator op = ops.find(name);
+  if (op == ops.end())
+    fail("unknown instruction `%s'", name.c_str(), line);
+  in.op = op->second;
+
+  switch (in.op) {
+  case OP_NOP:
+    break;
+  case OP_LW: case OP_SW: case OP_LB: case OP_LBU: case OP_SB: {
+    if (n != 3)
+      fail("%s takes a register and an address", name.c_str(), line);
+    in.rt = reg_number(w[1], line);
+    size_t paren = w[2].find('(');
+    if (paren == std::string::npos)
+      fail("offset(register) expected", "", line);
+    in.imm = (int32_t) strtol(w[2].substr(0, paren).c_str(), NULL, 0);
+    in.rs = reg_number(w[2].substr(paren + 1, w[2].size() - paren - 2), line);
+    break;
+  }
+  case OP_LI:
+    if (n != 3)
+      fail("li takes a register and a number", "", line);
+    in.rd = reg_number(w[1], line);
+    in.imm = (int32_t) strtoll(w[2].c_str(), NULL, 0);
+    break;
+  case OP_LA:
+    if (n != 3)
+      fail("la takes a register and a label", "", line);
+    in.rd = reg_number(w[1], line);
+    in.target = w[2];
+    break;
+  case OP_MOVE: case OP_NEG: case OP_NOT:
+    if (n != 3)
+      fail("%s takes two registers", name.c_str(), line);
+    in.rd = reg_number(w[1], line);
+    in.rs = reg_number(w[2], line);
+    break;
+  case OP_BEQ: case OP_BNE: case OP_BLT: case OP_BLE: case OP_BGT:
+  case OP_BGE:
+    if (n != 4)
+      fail("%s takes two operands and a label", name.c_str(), line);
+    in.rs = reg_number(w[1], line);
+    reg_or_imm(in, w[2], line);
+    in.target = w[3];
+    if (in.has_imm) {
+      // the target goes in imm, the immediate in rd's place
+      in.rd = in.imm;
+      in.imm = 0;
+    }
+    break;
+  case OP_J: case OP_JAL:
+    if (n != 2)
+      fail("%s takes a label", name.c_str(), line);
+    in.target = w[1];
+    break;
+  case OP_JR: case OP_JALR:
+    if (n != 2)
+      fail("%s takes a register", name.c_str(), line);
+    in.rs = reg_number(w[1], line);
+    break;
+  default:
+    if (n != 4)
+      fail("%s takes three operands", name.c_str(), line);
+    in.rd = reg_number(w[1], line);
+    in.rs = reg_number(w[2], line);
+    reg_or_imm(in, w[3], line);
+    break;
+  }
+  return in;
+}
+
+static void load_line(const std::string& raw, int lineno, bool& in_text,
+                      std::string& label)
+{
+  // Drop the comment, if the # is not in a string.
+  std::string line;
+  bool quoted = false;
+  for (size_t i = 0; i < raw.size(); i++) {
+    if (raw[i] == '"' && (i == 0 || raw[i - 1] != '\\'))
+      quoted = !quoted;
+    if (raw[i] == '#' && !quoted)
+      break;
+    line += raw[i];
+  }
+
+  // A label may come before the instruction or directive.
+  size_t start = line.find_first_not_of(" \t");
+  if (start == std::string::npos)
+    return;
+  size_t colon = line.find(':', start);
+  size_t quote = line.find('"', start);
+  if (colon != std::string::npos && (quote == std::string::npos || colon < quote)
+      && line.find_first_of(" \t", start) > colon) {
+    std::string name = line.substr(start, colon - start);
+    if (symbols.count(name))
+      fail("label `%s' defined twice", name.c_str(), lineno);
+    if (in_text) {
+      symbols[name] = TEXT_BASE + 4 * text.size();
+      label = name;
+    } else
+      symbols[name] = DATA_BASE + data.size();
+    start = line.find_first_not_of(" \t", colon + 1);
+    if (start == std::string::npos)
+      return;
+  }
+
+  std::vector<std::string> w = split(line.substr(start));
+  if (w[0] == ".data")
+    in_text = false;
+  else if (w[0] == ".text")
+    in_text = true;
+  else if (w[0] == ".globl")
+    ;
+  else if (w[0] == ".align") {
+    size_t align = 1u << atoi(w[1].c_str());
+    data.resize((data.size() + align - 1) / align * align);
+  } else if (w[0] == ".word") {
+    for (size_t i = 1; i < w.size(); i++)
+      data_word(w[i]);
+  } else if (w[0] == ".byte") {
+    for (size_t i = 1; i < w.size(); i++)
+      data.push_back((uint8_t) strtol(w[i].c_str(), NULL, 0));
+  } else if (w[0] == ".ascii" || w[0] == ".asciiz") {
+    data_ascii(line, start, lineno);
+    if (w[0] == ".asciiz")
+      data.push_back(0);
+  } else if (w[0] == ".space") {
+    data.resize(data.size() + atoi(w[1].c_str()));
+  } else if (w[0][0] == '.')
+    fail("unknown directive `%s'", w[0].c_str(), lineno);
+  else {
+    if (!in_text)
+      fail("instruction in the data segment", "", lineno);
+    text.push_back(parse_insn(w, lineno));
+    text_labels.push_back(label);
+  }
+}
+
+static void load_text(const char *s, bool& in_text, std::string& label)
+{
+  int lineno = 0;
+  while (*s) {
+    const char *nl = strchr(s, '\n');
+    size_t len = nl ? (size_t) (nl - s) : strlen(s);
+    load_line(std::string(s, len), ++lineno, in_text, label);
+    s += len + (nl ? 1 : 0);
+  }
+}
+
+static uint32_t resolve(const std::string& name, int line)
+{
+  std::map<std::string, uint32_t>::iterator sym = symbols.find(name);
+  if (sym == symbols.end())
+    fail("undefined label `%s'", name.c_str(), line);
+  return sym->second;
+}
+
+//
+// The instructions at _ic_lookup<n> and _ic_miss<n> begin the lookup in
+// and the refill of the inline cache of a call (cgen --inline-cache).
+//
+enum Probe { PROBE_NONE, PROBE_IC_LOOKUP, PROBE_IC_MISS };
+
+static void find_probes()
+{
+  probes.assign(text.size(), PROBE_NONE);
+  std::map<std::string, uint32_t>::iterator sym;
+  for (sym = symbols.begin(); sym != symbols.end(); ++sym) {
+    uint32_t addr = sym->second;
+    if (addr < TEXT_BASE || addr >= TEXT_BASE + 4 * text.size())
+      continue;
+    if (sym->first.compare(0, 10, "_ic_lookup") == 0)
+      probes[(addr - TEXT_BASE) / 4] = PROBE_IC_LOOKUP;
+    else if (sym->first.compare(0, 8, "_ic_miss") == 0)
+      probes[(addr - TEXT_BASE) / 4] = PROBE_IC_MISS;
+  }
+}
+
+static void load(FILE *f)
+{
+  for (int r = 0; r < RT_COUNT; r++)
+    symbols[routine_names[r]] = RUNTIME_BASE + 4 * r;
+
+  bool in_text = true;
+  std::string label;
+  load_text(startup, in_text, label);
+
+  char buf[4096];
+  int lineno = 0;
+  std::string line;
+  while (fgets(buf, sizeof(buf), f)) {
+    line += buf;
+    if (line.empty() || line[line.size() - 1] != '\n')
+      continue;
+    line.erase(line.size() - 1);
+    load_line(line, ++lineno, in_text, label);
+    line.clear();
+  }
+  if (!line.empty())
+    load_line(line, ++lineno, in_text, label);
+
+  for (size_t i = 0; i < text.size(); i++)
+    if (!text[i].target.empty())
+      text[i].imm = (int32_t) resolve(text[i].target, text[i].line);
+  for (size_t i = 0; i < data_fixups.size(); i++)
+    put_word(data_fixups[i].first, resolve(data_fixups[i].second, 0));
+  find_probes();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  Memory
+//
+//////////////////////////////////////////////////////////////////////////////
+
+static uint32_t heap_start;             // first byte of the heap in `data'
+static uint32_t stack_low = STACK_TOP + 4 - STACK_SIZE;
+
+static uint8_t *mem(uint32_t addr, uint32_t size)
+{
+  if (addr >= DATA_BASE && addr - DATA_BASE + size <= data.size())
+    return &data[addr - DATA_BASE];
+  if (addr >= stack_low && addr - stack_low + size <= STACK_SIZE)
+    return &stack[addr - stack_low];
+  char a[32];
+  snprintf(a, sizeof(a), "0x%08x", addr);
+  fail("bad address %s", a);
+  return NULL;
+}
+
+static uint32_t load_word(uint32_t addr)
+{
+  if (addr & 3) {
+    char a[32];
+    snprintf(a, sizeof(a), "0x%08x", addr);
+    fail("unaligned address %s", a);
+  }
+  uint32_t w;
+  memcpy(&w, mem(addr, 4), 4);
+  return w;
+}
+
+static void store_word(uint32_t addr, uint32_t w)
+{
+  if (addr & 3) {
+    char a[32];
+    snprintf(a, sizeof(a), "0x%08x", addr);
+    fail("unaligned address %s", a);
+  }
+  memcpy(mem(addr, 4), &w, 4);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  Objects and the collector
+//
+//  The heap is a sequence of blocks, each an eye catcher and an object.
+//  A free block has FREE_CATCHER as its eye catcher and its size in words
+//  less one where an object keeps its size.  The sweep joins neighbouring
+//  free blocks, and an allocation may take the front of a larger one.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#define EYE_CATCHER   0xffffffffu
+#define FREE_CATCHER  0xfffffffeu
+
+static uint32_t int_tag, bool_tag, string_tag;
+static bool collecting;                 // the program chose a collector
+static uint32_t nursery = 512 * 1024;
+static uint32_t since_collect;          // bytes allocated since then
+static std::vector<bool> block_start;   // per heap word
+static std::vector<bool> marked;        // per heap word
+static std::map<uint32_t, std::vector<uint32_t> > free_blocks;  // by size
+
+static uint32_t obj_tag(uint32_t obj)   { return load_word(obj); }
+static uint32_t obj_size(uint32_t obj)  { return load_word(obj + 4); }
+
+static size_t heap_index(uint32_t addr)
+{
+  return (addr - DATA_BASE - heap_start) / 4;
+}
+
+//
+// True if `w' is the address of an object in the heap that is not free.
+//
+static bool is_object(uint32_t w)
+{
+  if (w & 3 || w < DATA_BASE + heap_start + 4 ||
+      w - DATA_BASE >= data.size())
+    return false;
+  return block_start[heap_index(w - 4)] && load_word(w - 4) == EYE_CATCHER;
+}
+
+static void collect();
+
+//
+// Makes the `size' + 1 words at `block' a free block.
+//
+static void free_block(uint32_t block, uint32_t size)
+{
+  store_word(block, FREE_CATCHER);
+  store_word(block + 8, size);
+  block_start[heap_index(block)] = true;
+  free_blocks[size].push_back(block);
+}
+
+//
+// A free block of `size' words, or the rest of a larger one when what
+// is left over is big enough to be a block of its own.  0 if none fits.
+//
+static uint32_t take_free_block(uint32_t size)
+{
+  std::map<uint32_t, std::vector<uint32_t> >::iterator f;
+  for (f = free_blocks.lower_bound(size); f != free_blocks.end(); ) {
+    if (f->second.empty())
+      free_blocks.erase(f++);
+    else if (f->first != size && f->first < size + 3)
+      ++f;
+    else
+      break;
+  }
+  if (f == free_blocks.end())
+    return 0;
+  uint32_t block = f->second.back(), found = f->first;
+  f->second.pop_back();
+  if (found > size)
+    free_block(block + 4 * (size + 1), found - size - 1);
+  return block;
+}
+
+//
+// A new object of `size' words, uninitialized but for its eye catcher
+// and size.  Collects first if it is time.
+//
+static uint32_t allocate(uint32_t size)
+{
+  uint32_t bytes = 4 * (size + 1);
+  uint32_t block = take_free_block(size);
+  if (block == 0) {
+    block = DATA_BASE + data.size();
+    data.resize(data.size() + bytes);
+    block_start.resize((data.size() - heap_start) / 4);
+    marked.resize(block_start.size());
+    block_start[heap_index(block)] = true;
+    if (data.size() - heap_start > stats.peak_heap)
+      stats.peak_heap = data.size() - heap_start;
+  }
+  store_word(block, EYE_CATCHER);
+  store_word(block + 8, size);
+  stats.objects++;
+  stats.allocated += bytes;
+  since_collect += bytes;
+  return block + 4;
+}
+
+//
+// Called by the runtime routines before they allocate, so that what
+// they allocate is not collected before they return it.
+//
+static void gc_point()
+{
+  if (collecting && since_collect >= nursery)
+    collect();
+}
+
+static void mark_from(uint32_t root)
+{
+  std::vector<uint32_t> todo;
+  if (is_object(root) && !marked[heap_index(root - 4)]) {
+    marked[heap_index(root - 4)] = true;
+    todo.push_back(root);
+  }
+  while (!todo.empty()) {
+    uint32_t obj = todo.back();
+    todo.pop_back();
+    uint32_t tag = obj_tag(obj), size = obj_size(obj), first = 3, end = size;
+    if (tag == int_tag || tag == bool_tag)
+      continue;
+    if (tag == string_tag)
+      end = 4;
+    for (uint32_t i = first; i < end; i++) {
+      uint32_t w = load_word(obj + 4 * i);
+      if (is_object(w) && !marked[heap_index(w - 4)]) {
+        marked[heap_index(w - 4)] = true;
+        todo.push_back(w);
+      }
+    }
+  }
+}
+
+static void collect()
+{
+  stats.gc_cycles++;
+  since_collect = 0;
+  for (int r = 1; r < 32; r++)
+    mark_from(regs[r]);
+  for (uint32_t a = regs[29] & ~3u; a >= stack_low && a <= STACK_TOP; a += 4)
+    mark_from(load_word(a));
+
+  // Sweep, joining each run of unmarked blocks into one free block.
+  free_blocks.clear();
+  uint32_t end = DATA_BASE + data.size(), run = 0;
+  for (uint32_t block = DATA_BASE + heap_start; block < end; ) {
+    uint32_t size = load_word(block + 8);
+    size_t i = heap_index(block);
+    if (marked[i]) {
+      marked[i] = false;
+      if (run)
+        free_block(run, (block - run) / 4 - 1);
+      run = 0;
+    } else {
+      if (load_word(block) == EYE_CATCHER)
+        stats.freed += 4 * (size + 1);
+      if (run)
+        block_start[i] = false;
+      else
+        run = block;
+    }
+    block += 4 * (size + 1);
+  }
+  if (run)
+    free_block(run, (end - run) / 4 - 1);
+}
+
+static uint32_t copy_object(uint32_t obj)
+{
+  uint32_t size = obj_size(obj);
+  uint32_t copy = allocate(size);
+  memcpy(mem(copy, 4 * size), mem(obj, 4 * size), 4 * size);
+  return copy;
+}
+
+static uint32_t new_int(int32_t v)
+{
+  uint32_t i = copy_object(symbols["Int_protObj"]);
+  store_word(i + 12, v);
+  return i;
+}
+
+static uint32_t string_length(uint32_t s)
+{
+  return load_word(load_word(s + 12) + 12);
+}
+
+static uint32_t new_string(const char *chars, uint32_t len)
+{
+  uint32_t proto = symbols["String_protObj"];
+  uint32_t size = 3 + 1 + (len + 4) / 4;
+  uint32_t length = new_int(len);
+  uint32_t s = allocate(size);
+  store_word(s, obj_tag(proto));
+  store_word(s + 8, load_word(proto + 8));
+  store_word(s + 12, length);
+  uint8_t *p = mem(s + 16, 4 * (size - 4));
+  memset(p, 0, 4 * (size - 4));
+  memcpy(p, chars, len);
+  return s;
+}
+
+static std::string string_chars(uint32_t s)
+{
+  uint32_t len = string_length(s);
+  return std::string((char *) mem(s + 16, len + 1), len);
+}
+
+static std::string class_name(uint32_t obj)
+{
+  return string_chars(load_word(symbols["class_nameTab"] + 4 * obj_tag(obj)));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  The runtime
+//
+//////////////////////////////////////////////////////////////////////////////
+
+static void report(bool json);
+static bool stats_wanted, stats_json;
+
+static void stop(int status)
+{
+  fflush(stdout);
+  if (stats_wanted)
+    report(stats_json);
+  exit(status);
+}
+
+static std::string read_line()
+{
+  std::string s;
+  int c;
+  while ((c = getchar()) != EOF && c != '\n')
+    s += (char) c;
+  return s;
+}
+
+//
+// Runs runtime routine `r' and returns the address to continue at.
+//
+static uint32_t run_routine(int r)
+{
+  stats.runtime_calls++;
+  stats.calls[r]++;
+  uint32_t& a0 = regs[4];
+  uint32_t& sp = regs[29];
+  switch (r) {
+  case RT_COPY:
+    gc_point();
+    a0 = copy_object(a0);
+    break;
+  case RT_ABORT:
+    printf("Abort called from class %s\n", class_name(a0).c_str());
+    stop(0);
+    break;
+  case RT_TYPE_NAME:
+    a0 = load_word(symbols["class_nameTab"] + 4 * obj_tag(a0));
+    break;
+  case RT_OUT_STRING:
+    fputs(string_chars(load_word(sp + 4)).c_str(), stdout);
+    sp += 4;
+    break;
+  case RT_OUT_INT:
+    printf("%d", (int32_t) load_word(load_word(sp + 4) + 12));
+    sp += 4;
+    break;
+  case RT_IN_STRING: {
+    gc_point();
+    std::string s = read_line();
+    if (s.find('\0') != std::string::npos)
+      s = "";
+    a0 = new_string(s.c_str(), s.size());
+    break;
+  }
+  case RT_IN_INT: {
+    gc_point();
+    a0 = new_int((int32_t) strtol(read_line().c_str(), NULL, 10));
+    break;
+  }
+  case RT_LENGTH:
+    a0 = load_word(a0 + 12);
+    break;
+  case RT_CONCAT: {
+    gc_point();
+    std::string s = string_chars(a0) + string_chars(load_word(sp + 4));
+    a0 = new_string(s.data(), s.size());
+    sp += 4;
+    break;
+  }
+  case RT_SUBSTR: {
+    gc_point();
+    int32_t i = load_word(load_word(sp + 8) + 12);
+    int32_t l = load_word(load_word(sp + 4) + 12);
+    int32_t len = string_length(a0);
+    if (i < 0 || l < 0 || i > len || l > len - i) {
+      printf("Index to substr is %s\n", i < 0 || l < 0 ? "negative" : "too big");
+      printf("Execution aborted.\n");
+      stop(0);
+    }
+    std::string s = string_chars(a0).substr(i, l);
+    a0 = new_string(s.data(), s.size());
+    sp += 8;
+    break;
+  }
+  case RT_EQUALITY_TEST: {
+    uint32_t x = regs[9], y = regs[10];
+    bool equal = x == y;
+    if (!equal && x && y && obj_tag(x) == obj_tag(y)) {
+      if (obj_tag(x) == int_tag || obj_tag(x) == bool_tag)
+        equal = load_word(x + 12) == load_word(y + 12);
+      else if (obj_tag(x) == string_tag)
+        equal = string_chars(x) == string_chars(y);
+    }
+    if (!equal)
+      a0 = regs[5];
+    break;
+  }
+  case RT_DISPATCH_ABORT:
+    printf("%s:%d: Dispatch to void.\n", string_chars(a0).c_str(),
+           (int) regs[9]);
+    stop(0);
+    break;
+  case RT_CASE_ABORT:
+    printf("No match in case statement for Class %s\n",
+           class_name(a0).c_str());
+    stop(0);
+    break;
+  case RT_CASE_ABORT2:
+    printf("%s:%d: Match on void in case statement.\n",
+           string_chars(a0).c_str(), (int) regs[9]);
+    stop(0);
+    break;
+  case RT_EXIT:
+    printf("COOL program successfully executed\n");
+    stop(0);
+    break;
+  default:
+    // the collector's entry points, which need do nothing here
+    break;
+  }
+  return regs[31];
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  The machine
+//
+//////////////////////////////////////////////////////////////////////////////
+
+//
+// Stops the program at instruction `in' with the message `what'.
+//
+static void fault(const Insn& in, const char *what, uint32_t addr = 0)
+{
+  fflush(stdout);
+  fprintf(stderr, "mipsrun: %s:%d: in %s: ", program, in.line,
+          text_labels[&in - &text[0]].c_str());
+  fprintf(stderr, what, addr);
+  fprintf(stderr, "\n");
+  stop(1);
+}
+
+static void run(unsigned long long limit)
+{
+  size_t pc = 0;                // index in text
+  size_t ntext = text.size();
+  regs[29] = STACK_TOP;
+  regs[30] = STACK_TOP;
+
+  for (;;) {
+    if (pc >= ntext)
+      fault(text.back(), "ran off the end of the text");
+    const Insn& in = text[pc];
+    if (++stats.instructions > limit) {
+      stats.instructions--;
+      fault(in, "stopped after the limit of instructions");
+    }
+    if (probes[pc] == PROBE_IC_LOOKUP)
+      stats.ic_lookups++;
+    else if (probes[pc] == PROBE_IC_MISS)
+      stats.ic_misses++;
+    uint32_t *r = regs;
+    uint32_t b = in.has_imm ? (uint32_t) in.imm : r[in.rt];
+    uint32_t next = 0;          // jump target address, if not 0
+    bool taken = false;
+    switch (in.op) {
+    case OP_NOP: break;
+    case OP_LW: r[in.rt] = load_word(r[in.rs] + in.imm); break;
+    case OP_SW: store_word(r[in.rs] + in.imm, r[in.rt]); break;
+    case OP_LB: r[in.rt] = (int32_t) (int8_t) *mem(r[in.rs] + in.imm, 1); break;
+    case OP_LBU: r[in.rt] = *mem(r[in.rs] + in.imm, 1); break;
+    case OP_SB: *mem(r[in.rs] + in.imm, 1) = (uint8_t) r[in.rt]; break;
+    case OP_LI: case OP_LA: r[in.rd] = in.imm; break;
+    case OP_MOVE: r[in.rd] = r[in.rs]; break;
+    case OP_NEG:
+      if (r[in.rs] == 0x80000000u)
+        fault(in, "arithmetic overflow");
+      r[in.rd] = -r[in.rs];
+      break;
+    case OP_NOT: r[in.rd] = ~r[in.rs]; break;
+    case OP_ADD: case OP_SUB: {
+      int64_t v = in.op == OP_ADD ? (int64_t) (int32_t) r[in.rs] + (int32_t) b
+                                  : (int64_t) (int32_t) r[in.rs] - (int32_t) b;
+      if (v != (int32_t) v)
+        fault(in, "arithmetic overflow");
+      r[in.rd] = (uint32_t) v;
+      break;
+    }
+    case OP_ADDU: r[in.rd] = r[in.rs] + b; break;
+    case OP_SUBU: r[in.rd] = r[in.rs] - b; break;
+    case OP_MUL: r[in.rd] = (uint32_t) ((int32_t) r[in.rs] * (int64_t) (int32_t) b); break;
+    case OP_DIV: case OP_REM: {
+      int32_t x = r[in.rs], y = b;
+      if (y == 0)
+        fault(in, "division by zero");
+      if (x == INT32_MIN && y == -1)
+        r[in.rd] = in.op == OP_DIV ? (uint32_t) x : 0;
+      else
+        r[in.rd] = in.op == OP_DIV ? x / y : x % y;
+      break;
+    }
+    case OP_AND: r[in.rd] = r[in.rs] & b; break;
+    case OP_OR: r[in.rd] = r[in.rs] | b; break;
+    case OP_XOR: r[in.rd] = r[in.rs] ^ b; break;
+    case OP_SLL: r[in.rd] = r[in.rs] << (b & 31); break;
+    case OP_SRL: r[in.rd] = r[in.rs] >> (b & 31); break;
+    case OP_SRA: r[in.rd] = (int32_t) r[in.rs] >> (b & 31); break;
+    case OP_SLT: r[in.rd] = (int32_t) r[in.rs] < (int32_t) b; break;
+    case OP_SLTU: r[in.rd] = r[in.rs] < b; break;
+    case OP_SEQ: r[in.rd] = r[in.rs] == b; break;
+    case OP_SNE: r[in.rd] = r[in.rs] != b; break;
+    case OP_SLE: r[in.rd] = (int32_t) r[in.rs] <= (int32_t) b; break;
+    case OP_SGT: r[in.rd] = (int32_t) r[in.rs] > (int32_t) b; break;
+    case OP_SGE: r[in.rd] = (int32_t) r[in.rs] >= (int32_t) b; break;
+    case OP_BEQ: case OP_BNE: case OP_BLT: case OP_BLE: case OP_BGT:
+    case OP_BGE: {
+      int32_t x = r[in.rs], y = in.has_imm ? in.rd : (int32_t) r[in.rt];
+      switch (in.op) {
+      case OP_BEQ: taken = x == y; break;
+      case OP_BNE: taken = x != y; break;
+      case OP_BLT: taken = x < y; break;
+      case OP_BLE: taken = x <= y; break;
+      case OP_BGT: taken = x > y; break;
+      default:     taken = x >= y; break;
+      }
+      if (taken)
+        next = in.imm;
+      break;
+    }
+    case OP_J: next = in.imm; break;
+    case OP_JAL: r[31] = TEXT_BASE + 4 * (pc + 1); next = in.imm; break;
+    case OP_JR: next = r[in.rs]; break;
+    case OP_JALR: next = r[in.rs]; r[31] = TEXT_BASE + 4 * (pc + 1); break;
+    }
+    r[0] = 0;
+
+    if (!next) {
+      pc++;
+      continue;
+    }
+    // A runtime routine returns at once, maybe to another.  The
+    // routines of trap.handler may change any caller saved register but
+    // $a0; these change them all, so that code which counts on one
+    // surviving a call fails here too.
+    while (next >= RUNTIME_BASE && next < RUNTIME_BASE + 4 * RT_COUNT) {
+      next = run_routine((next - RUNTIME_BASE) / 4);
+      for (int k = 2; k < 26; k++)
+        if (k != 4 && (k < 16 || k > 23))
+          r[k] = 0xdeadbeef;
+    }
+    if (next < TEXT_BASE || next >= TEXT_BASE + 4 * ntext || (next & 3))
+      fault(in, "jump to bad address 0x%08x", next);
+    pc = (next - TEXT_BASE) / 4;
+  }
+}
+
+static void report(bool json)
+{
+  if (json) {
+    fprintf(stderr, "{\"program\": \"%s\", \"instructions\": %llu, "
+            "\"runtime_calls\": %llu, \"objects\": %llu, "
+            "\"allocated_bytes\": %llu, \"gc_cycles\": %llu, "
+            "\"freed_bytes\": %llu, \"peak_heap_bytes\": %u, "
+            "\"code_size\": %lu, \"ic_lookups\": %llu, \"ic_misses\": %llu, "
+            "\"calls\": {", program,
+            stats.instructions, stats.runtime_calls, stats.objects,
+            stats.allocated, stats.gc_cycles, stats.freed, stats.peak_heap,
+            (unsigned long) text.size(), stats.ic_lookups, stats.ic_misses);
+    const char *sep = "";
+    for (int r = 0; r < RT_COUNT; r++)
+      if (stats.calls[r]) {
+        fprintf(stderr, "%s\"%s\": %llu", sep, routine_names[r], stats.calls[r]);
+        sep = ", ";
+      }
+    fprintf(stderr, "}}\n");
+    return;
+  }
+  fprintf(stderr, "%-20s %14llu\n", "instructions", stats.instructions);
+  fprintf(stderr, "%-20s %14llu\n", "runtime calls", stats.runtime_calls);
+  for (int r = 0; r < RT_COUNT; r++)
+    if (stats.calls[r])
+      fprintf(stderr, "  %-18s %14llu\n", routine_names[r], stats.calls[r]);
+  fprintf(stderr, "%-20s %14llu\n", "objects allocated", stats.objects);
+  fprintf(stderr, "%-20s %14llu\n", "bytes allocated", stats.allocated);
+  fprintf(stderr, "%-20s %14llu\n", "gc cycles", stats.gc_cycles);
+  fprintf(stderr, "%-20s %14llu\n", "bytes freed", stats.freed);
+  fprintf(stderr, "%-20s %14u\n", "peak heap bytes", stats.peak_heap);
+  fprintf(stderr, "%-20s %14lu\n", "code size", (unsigned long) text.size());
+  if (stats.ic_lookups) {
+    fprintf(stderr, "%-20s %14llu\n", "ic lookups", stats.ic_lookups);
+    fprintf(stderr, "%-20s %14llu\n", "ic misses", stats.ic_misses);
+  }
+}
+
+static void usage(char *prog)
+{
+  fprintf(stderr, "usage: %s [--stats[=json]] [-l limit] [-n nursery] file.s\n",
+          prog);
+  exit(2);
+}
+
+int main(int argc, char **argv)
+{
+  unsigned long long limit = ~0ULL;
+  int i;
+  for (i = 1; i < argc && argv[i][0] == '-'; i++) {
+    if (strcmp(argv[i], "--stats") == 0)
+      stats_wanted = true;
+    else if (strcmp(argv[i], "--stats=json") == 0)
+      stats_wanted = stats_json = true;
+    else if (strcmp(argv[i], "-l") == 0 && i + 1 < argc)
+      limit = strtoull(argv[++i], NULL, 10);
+    else if (strcmp(argv[i], "-n") == 0 && i + 1 < argc)
+      nursery = strtoul(argv[++i], NULL, 10);
+    else
+      usage(argv[0]);
+  }
+  if (i != argc - 1)
+    usage(argv[0]);
+  program = argv[i];
+  FILE *f = fopen(program, "r");
+  if (!f) {
+    perror(program);
+    exit(2);
+  }
+  load(f);
+  fclose(f);
+
+  data.resize((data.size() + 7) & ~7u);
+  heap_start = data.size();
+  int_tag = load_word(resolve("_int_tag", 0));
+  bool_tag = load_word(resolve("_bool_tag", 0));
+  string_tag = load_word(resolve("_string_tag", 0));
+  uint32_t init = load_word(resolve("_MemMgr_INITIALIZER", 0));
+  collecting = init == symbols["_GenGC_Init"] || init == symbols["_ScnGC_Init"];
+  stack = (uint8_t *) calloc(STACK_SIZE, 1);
+
+  run(limit);
+  return 0;
+}
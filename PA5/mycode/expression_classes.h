@@ -0,0 +1,28 @@
+#pragma once
+
+enum class expr_type {
+  EXP_ASSIGN,
+  EXP_STATIC_DISPATCH,
+  EXP_DISPATCH,
+  EXP_COND,
+  EXP_LOOP,
+  EXP_TYPCASE,
+  EXP_BLOCK,
+  EXP_LET,
+  EXP_PLUS,
+  EXP_SUB,
+  EXP_MUL,
+  EXP_DIVIDE,
+  EXP_NEG,
+  EXP_LT,
+  EXP_EQ,
+  EXP_LEQ,
+  EXP_COMP,
+  EXP_INT_CONST,
+  EXP_BOOL_CONST,
+  EXP_STRING_CONST,
+  EXP_NEW_,
+  EXP_ISVOID,
+  EXP_NO_EXPR,
+  EXP_OBJECT
+};